@@ -71,6 +71,7 @@ SOURCES += qlogo_main.cpp\
     editorwindow.cpp \
     help.cpp \
     kernel_controlstructures.cpp \
+    kernel_bytecode.cpp \
     error.cpp \
     library.cpp \
     datum_word.cpp \
@@ -79,6 +80,9 @@ SOURCES += qlogo_main.cpp\
     datum_array.cpp \
     datum_datump.cpp \
     datum_iterator.cpp \
+    datum_pool.cpp \
+    datum_collector.cpp \
+    workspaceimage.cpp \
     message.cpp
 
 
@@ -98,6 +102,7 @@ HEADERS  += mainwindow.h \
     help.h \
     error.h \
     library.h \
+    workspaceimage.h \
     message.h
 
 FORMS    += mainwindow.ui \
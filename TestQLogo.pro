@@ -73,6 +73,7 @@ SOURCES += testqlogo.cpp \
     procedurehelper.cpp \
     help.cpp \
     kernel_controlstructures.cpp \
+    kernel_bytecode.cpp \
     error.cpp \
     library.cpp \
     datum_word.cpp \
@@ -80,7 +81,10 @@ SOURCES += testqlogo.cpp \
     datum_list.cpp \
     datum_array.cpp \
     datum_datump.cpp \
-    datum_iterator.cpp
+    datum_iterator.cpp \
+    datum_pool.cpp \
+    datum_collector.cpp \
+    workspaceimage.cpp
 
 HEADERS  +=  datum.h \
     test_controller.h \
@@ -92,7 +96,8 @@ HEADERS  +=  datum.h \
     workspace.h \
     procedurehelper.h \
     help.h \
-    error.h
+    error.h \
+    workspaceimage.h
 
 CONFIG += c++11
 
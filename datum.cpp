@@ -31,6 +31,29 @@
 int countOfNodes = 0;
 int maxCountOfNodes = 0;
 
+// The memory statistics of one DatumType.
+struct DatumTypeStats {
+  const char *name;
+  quint64 bytes;
+  quint64 maxBytes;
+  int live;
+  int maxLive;
+  quint64 created;
+  int recentlyCreated;
+};
+
+static DatumTypeStats typeStats[] = {
+    {"nothing", 0, 0, 0, 0, 0, 0},   {"word", 0, 0, 0, 0, 0, 0},
+    {"list", 0, 0, 0, 0, 0, 0},      {"listnode", 0, 0, 0, 0, 0, 0},
+    {"array", 0, 0, 0, 0, 0, 0},     {"astnode", 0, 0, 0, 0, 0, 0},
+    {"procedure", 0, 0, 0, 0, 0, 0}, {"error", 0, 0, 0, 0, 0, 0}};
+
+const int countOfDatumTypes = sizeof(typeStats) / sizeof(typeStats[0]);
+
+#ifdef MAKE_TEST
+quint64 Datum::countOfRetains = 0;
+#endif
+
 DatumP nodes() {
   int a = countOfNodes;
   int b = maxCountOfNodes;
@@ -40,18 +63,110 @@ DatumP nodes() {
   List *retval = new List;
   retval->append(DatumP(new Word(a)));
   retval->append(DatumP(new Word(b)));
+  for (int i = 0; i < DatumPool::countOfPools; ++i) {
+    DatumPool &pool = datumPool((DatumPool::PoolId)i);
+    List *poolStats = new List;
+    poolStats->append(DatumP(new Word(pool.name)));
+    poolStats->append(DatumP(new Word(pool.countOfBlocksInUse())));
+    poolStats->append(DatumP(new Word(pool.maxCountOfBlocksInUse())));
+    poolStats->append(DatumP(new Word(pool.countOfBlocksAllocated())));
+    pool.resetMaxBlocksInUse();
+    retval->append(DatumP(poolStats));
+  }
+  return DatumP(retval);
+}
+
+// The statistics reported for each type, in order.
+static const char *const statNames[] = {"live",    "maxlive", "bytes",
+                                        "maxbytes", "created", "recent"};
+const int countOfStats = sizeof(statNames) / sizeof(statNames[0]);
+
+// Copy the statistics of each type into stats and restart the maximums and
+// recent counts.
+static void takeTypeStats(double stats[][countOfStats]) {
+  for (int i = Datum::wordType; i < countOfDatumTypes; ++i) {
+    DatumTypeStats &s = typeStats[i];
+    stats[i][0] = s.live;
+    stats[i][1] = s.maxLive;
+    stats[i][2] = s.bytes;
+    stats[i][3] = s.maxBytes;
+    stats[i][4] = s.created;
+    stats[i][5] = s.recentlyCreated;
+    s.maxLive = s.live;
+    s.maxBytes = s.bytes;
+    s.recentlyCreated = 0;
+  }
+}
+
+DatumP nodeStats() {
+  double stats[countOfDatumTypes][countOfStats];
+  takeTypeStats(stats);
+
+  List *retval = new List;
+  for (int i = Datum::wordType; i < countOfDatumTypes; ++i) {
+    List *typeList = new List;
+    for (int j = 0; j < countOfStats; ++j) {
+      typeList->append(DatumP(new Word(statNames[j])));
+      typeList->append(DatumP(new Word(stats[i][j])));
+    }
+    retval->append(DatumP(new Word(typeStats[i].name)));
+    retval->append(DatumP(typeList));
+  }
   return DatumP(retval);
 }
 
+QString nodeStatsJSON() {
+  double stats[countOfDatumTypes][countOfStats];
+  takeTypeStats(stats);
+
+  QString retval = "{";
+  for (int i = Datum::wordType; i < countOfDatumTypes; ++i) {
+    if (i > Datum::wordType)
+      retval += ",";
+    retval += QString("\"%1\":{").arg(QString(typeStats[i].name));
+    for (int j = 0; j < countOfStats; ++j) {
+      if (j > 0)
+        retval += ",";
+      retval += QString("\"%1\":").arg(QString(statNames[j]));
+      retval += formatNumber(stats[i][j]);
+    }
+    retval += "}";
+  }
+  retval += "}";
+  return retval;
+}
+
+void Datum::setDatumType(DatumType aType, size_t aSize) {
+  datumType = aType;
+  datumSize = aSize;
+  DatumTypeStats &s = typeStats[aType];
+  s.bytes += aSize;
+  if (s.bytes > s.maxBytes)
+    s.maxBytes = s.bytes;
+  ++s.created;
+  ++s.recentlyCreated;
+  ++s.live;
+  if (s.live > s.maxLive)
+    s.maxLive = s.live;
+}
 
 Datum::Datum() {
   retainCount = 0;
+  datumType = noType;
   ++countOfNodes;
   if (countOfNodes > maxCountOfNodes)
     maxCountOfNodes = countOfNodes;
 }
 
-Datum::~Datum() { --countOfNodes; }
+Datum::~Datum() {
+  --countOfNodes;
+  if (datumType != noType) {
+    --typeStats[datumType].live;
+    typeStats[datumType].bytes -= datumSize;
+  }
+  if (isCycleCandidate)
+    forgetCycleCandidate(this);
+}
 
 QString Datum::printValue(bool, int, int) { return name(); }
 
@@ -62,7 +177,7 @@ QString Datum::name(void) {
 
 QString Datum::showValue(bool, int, int) { return name(); }
 
-bool Datum::isEqual(DatumP other, bool) {
+bool Datum::isEqual(const DatumP &other, bool) {
   return (other.isa() == Datum::noType);
 }
 
@@ -92,17 +207,17 @@ void Datum::setButfirstItem(DatumP) { Q_ASSERT(false); }
 
 void Datum::setFirstItem(DatumP) { Q_ASSERT(false); }
 
-bool Datum::containsDatum(DatumP, bool) {
+bool Datum::containsDatum(const DatumP &, bool) {
   Q_ASSERT(false);
   return false;
 }
 
-bool Datum::isMember(DatumP, bool) {
+bool Datum::isMember(const DatumP &, bool) {
   Q_ASSERT(false);
   return false;
 }
 
-DatumP Datum::fromMember(DatumP, bool) {
+DatumP Datum::fromMember(const DatumP &, bool) {
   Q_ASSERT(false);
   return nothing;
 }
@@ -117,13 +232,15 @@ bool Datum::isIndexInRange(int) {
   return false;
 }
 
+void Datum::appendChildren(QVector<Datum *> &) {}
+
+void Datum::clearChildren() {}
+
 Datum &Datum::operator=(const Datum &) {
   Q_ASSERT(false);
   return *this;
 }
 
-Datum::DatumType Datum::isa() { return noType; }
-
 int Datum::size() {
   Q_ASSERT(false);
   return 0;
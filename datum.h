@@ -33,6 +33,7 @@
 #include <QVector>
 #include <QList>
 
+class Datum;
 class ASTNode;
 class Word;
 class List;
@@ -41,6 +42,7 @@ class Array;
 class Error;
 class DatumP;
 class Procedure;
+struct ProcedureCell;
 
 class Iterator;
 class WordIterator;
@@ -48,7 +50,7 @@ class ListIterator;
 class ArrayIterator;
 
 class Kernel;
-typedef DatumP (Kernel::*KernelMethod)(DatumP);
+typedef DatumP (Kernel::*KernelMethod)(const DatumP &);
 
 /// Convert "raw" encoding to Char encoding.
 QChar rawToChar(const QChar &src);
@@ -59,24 +61,199 @@ QChar charToRaw(const QChar &src);
 /// Convert a string from "raw" encoding to Char. In place.
 void rawToChar(QString &src);
 
+/// \brief Convert aString to a number.
+///
+/// Plain decimal numbers that can be converted exactly with a single multiply
+/// or divide are handled directly. Anything else is given to
+/// QString::toDouble(). Returns true and sets aNumber if aString is a number,
+/// otherwise sets aNumber to zero and returns false.
+bool parseNumber(const QString &aString, double &aNumber);
+
+/// \brief Return the shortest string that converts back to exactly aNumber.
+///
+/// Integers are written without an exponent if they have fewer than 16
+/// digits. Other numbers are written in the 'g' format with the fewest digits
+/// (at most 17) that preserve their value.
+QString formatNumber(double aNumber);
+
+/// \brief An interned name.
+///
+/// Procedure, variable, and property list names are compared by their key
+/// value (see Word::keyValue()). Each distinct key value is given a small
+/// integer, its Symbol, so that name tables can be indexed directly instead of
+/// hashing strings.
+typedef int Symbol;
+
+/// The value of findSymbol() for a key value that has no Symbol.
+const Symbol noSymbol = -1;
+
+/// Return the Symbol for a key value, creating it if needed.
+Symbol symbolForKey(const QString &key);
+
+/// Return the Symbol for a key value, or noSymbol if it has none. Use this
+/// for lookups, so that asking about a name doesn't intern it.
+Symbol findSymbol(const QString &key);
+
+/// Return the key value that a Symbol was created from.
+const QString &keyForSymbol(Symbol aSymbol);
+
+/// Return the number of Symbols created so far.
+int countOfSymbols();
+
+/// \brief A size-class allocator for the small Datum subclasses.
+///
+/// Words, Lists, ListNodes, Arrays, and ASTNodes are created and destroyed at a
+/// very high rate. Each of these classes allocates from its own DatumPool.
+/// Blocks are carved out of large slabs, and freed blocks are kept on a free
+/// list to be reused by the next allocation. There is one free list and one set
+/// of statistics per pool for the whole process. They are not locked: the
+/// Kernel is only used by one thread at a time, and a Datum may be freed by a
+/// different thread than the one that created it. Slabs are never returned to
+/// the system.
+class DatumPool {
+public:
+  /// The pools, one per Datum subclass.
+  enum PoolId {
+    wordPool,
+    listPool,
+    listNodePool,
+    smallListNodePool,
+    arrayPool,
+    astnodePool,
+    countOfPools
+  };
+
+  /// Create a pool of blocks of aBlockSize bytes. Pools are constant
+  /// initialized so that they may be used by other static objects.
+  constexpr DatumPool(PoolId aId, const char *aName, size_t aBlockSize)
+      : id(aId), name(aName), blockSize(aBlockSize) {}
+
+  /// Return a block of at least aSize bytes. Requests larger than the pool's
+  /// block size (e.g. from a subclass) are passed on to the system allocator.
+  void *allocate(size_t aSize);
+
+  /// Return a block to the pool. aSize must be the size given to allocate().
+  void deallocate(void *aBlock, size_t aSize);
+
+  /// The number of blocks in use in this pool.
+  int countOfBlocksInUse();
+
+  /// The maximum number of blocks in use since the last call to
+  /// resetMaxBlocksInUse().
+  int maxCountOfBlocksInUse();
+
+  void resetMaxBlocksInUse();
+
+  /// The number of blocks in all of this pool's slabs.
+  int countOfBlocksAllocated();
+
+  const PoolId id;
+  const char *const name;
+  const size_t blockSize;
+};
+
+/// Return the pool for the given id.
+DatumPool &datumPool(DatumPool::PoolId aId);
+
+/// Declare the class-specific operator new and operator delete that allocate
+/// the objects of a Datum subclass from the given pool.
+#define DATUM_POOL_ALLOCATED(poolId)                                           \
+  static void *operator new(size_t size) {                                     \
+    return datumPool(DatumPool::poolId).allocate(size);                        \
+  }                                                                            \
+  static void operator delete(void *p, size_t size) {                          \
+    datumPool(DatumPool::poolId).deallocate(p, size);                          \
+  }
+
 /// \brief Return a list of two words for the NODES command.
 ///
 /// Returns a list of two words (numbers). The first represents the number of Datums
 /// currently in use. The second shows the maximum number of Datums in use at any one
-/// time since the last invocation of this function.
+/// time since the last invocation of this function. These are followed by a list
+/// for each DatumPool containing the pool's name, the number of blocks in use, the
+/// maximum number of blocks in use, and the number of blocks allocated.
 ///
 /// Each Word, List, and Array is a node. So, for example, a list of two words is three
 /// nodes (1 List + 2 Words). Furthermore, if the list is "RUN" (e.g. "RUN [forward 100]")
 /// then ASTNodes will be created, adding to the number of nodes.
 DatumP nodes();
 
+/// \brief Return memory statistics for each type of Datum, for NODESTATS.
+///
+/// Returns a property list of the form [word [live 12 maxlive 40 ...] list
+/// [...] ...] with an entry for each DatumType. Each entry holds the number of
+/// objects alive, the most alive at once, the bytes those occupy (not counting
+/// the storage of their strings and vectors), the number created since the
+/// program started, and the number created recently. The maximums and recent
+/// counts restart after each call to nodeStats() or nodeStatsJSON().
+DatumP nodeStats();
+
+/// Return the statistics of nodeStats() as a JSON object, for NODESJSON.
+QString nodeStatsJSON();
+
+/// \brief Delete Datums whose retain counts have fallen to zero.
+///
+/// When the last reference to a Datum is released the Datum is not deleted
+/// immediately. Instead it is put on a release queue. Deleting a Datum releases
+/// the Datums it refers to, which are put on the same queue, so even a very
+/// long list is freed iteratively instead of recursively. The queue is drained
+/// in bounded batches between instructions, or entirely when it grows too
+/// large. A Datum that was retained again while it waited in the queue is
+/// left alone.
+///
+/// \param aLimit the maximum number of Datums to delete. A negative limit
+/// empties the queue.
+/// \return the number of Datums deleted.
+int drainReleaseQueue(int aLimit = -1);
+
+/// \brief Note that aDatum may now be part of a circular structure.
+///
+/// .SETFIRST, .SETBF, and .SETITEM can make a List, ListNode, or Array refer
+/// to itself, and reference counting alone can never free such a structure.
+/// The modified Datums are kept as candidates for collectCycles(), which runs
+/// automatically once enough candidates have been added.
+void addCycleCandidate(Datum *aDatum);
+
+/// Remove aDatum from the cycle candidates. Called when aDatum is destroyed.
+void forgetCycleCandidate(Datum *aDatum);
+
+/// Add aDatum, which collectCycles() once found in a live structure and which
+/// has just lost a reference, back to the candidates. Unlike
+/// addCycleCandidate(), this never starts a collection.
+void suspectCycleCandidate(Datum *aDatum);
+
+/// \brief Free the circular structures that can no longer be reached.
+///
+/// Uses trial deletion: the Lists, ListNodes, and Arrays reachable from the
+/// candidates are collected, and the references each receives from within that
+/// set are counted. Any Datum whose retain count is higher is referred to from
+/// outside, so it and everything it refers to are live. The references held by
+/// the rest are released, and the release queue is drained to destroy them.
+/// Returns the number of Datums deleted, which includes the Words and other
+/// Datums that only the circular structures referred to.
+///
+/// The candidates are cleared after each collection. The live Datums are
+/// remembered instead, and each becomes a candidate again when it loses a
+/// reference.
+int collectCycles();
+
 /// The unit of data for QLogo. The base class for Word, List, Array, ASTNode, etc.
 class Datum {
   friend class Iterator;
 
+  friend void addCycleCandidate(Datum *aDatum);
+  friend void forgetCycleCandidate(Datum *aDatum);
+  friend void suspectCycleCandidate(Datum *aDatum);
+  friend int collectCycles();
+  friend int drainReleaseQueue(int aLimit);
+  friend class DatumP;
+
 protected:
   int retainCount;
   bool isDestroyable = true; // trueWord, falseWord, and notADatum are internal constants and cannot be destroyed.
+  bool isCycleCandidate = false; // True while this is in the cycle candidates.
+  bool mayBeInCycle = false; // True once collectCycles() has found this live.
+  bool isQueuedForRelease = false; // True while this is in the release queue.
 
 public:
   /// Value returned by isa().
@@ -91,6 +268,20 @@ public:
     errorType
   };
 
+protected:
+  /// The type of this object, set by the constructor of each subclass. Kept
+  /// as a field so that type checks don't need a virtual call.
+  DatumType datumType;
+
+  /// The size given to setDatumType(), for the byte statistics.
+  unsigned int datumSize = 0;
+
+  /// Set datumType and count this object in the statistics for its type.
+  /// Called once by the constructor of each subclass, which gives its size.
+  void setDatumType(DatumType aType, size_t aSize);
+
+public:
+
   /// \brief Constructs a Datum
   ///
   /// The Datum class is the superclass for all model objects.
@@ -103,7 +294,18 @@ public:
   Datum &operator=(const Datum &);
 
   /// Increment the retain count.
-  void retain() { ++retainCount; }
+  void retain() {
+    ++retainCount;
+#ifdef MAKE_TEST
+    ++countOfRetains;
+#endif
+  }
+
+#ifdef MAKE_TEST
+  /// The number of calls to retain() since the program started. Only kept in
+  /// the test build, where it is used to measure reference counting traffic.
+  static quint64 countOfRetains;
+#endif
 
   /// Decrement the retain count.
   void release() { --retainCount; }
@@ -112,7 +314,7 @@ public:
   bool shouldDelete() { return (retainCount <= 0) && isDestroyable; }
 
   /// Return type of this object.
-  virtual DatumType isa();
+  DatumType isa() { return datumType; }
 
   /// For debugging.
   virtual QString name();
@@ -156,7 +358,7 @@ public:
   virtual DatumP butlast(void);
 
   /// Determine if the object pointed to by other is equal to this object.
-  virtual bool isEqual(DatumP other, bool);
+  virtual bool isEqual(const DatumP &other, bool);
 
   /// return the number of elements in the object.
   virtual int size();
@@ -180,13 +382,21 @@ public:
   virtual void setButfirstItem(DatumP aValue);
 
   /// recursively search this object for an instance of a Datum.
-  virtual bool containsDatum(DatumP, bool);
+  virtual bool containsDatum(const DatumP &, bool);
 
   /// nonrecursively search this object for an instance of a Datum.
-  virtual bool isMember(DatumP aDatum, bool);
+  virtual bool isMember(const DatumP &aDatum, bool);
 
   /// return a new Datum beginning with the first occurrence of aDatum.
-  virtual DatumP fromMember(DatumP aDatum, bool ignoreCase);
+  virtual DatumP fromMember(const DatumP &aDatum, bool ignoreCase);
+
+  /// Append each Datum this object refers to, once per reference. Used by
+  /// collectCycles().
+  virtual void appendChildren(QVector<Datum *> &aChildren);
+
+  /// Release every reference this object holds. Used by collectCycles() to
+  /// break a circular structure that is no longer reachable.
+  virtual void clearChildren();
 };
 
 /// A pointer to a Datum. Incorporates convenience methods, reference-counting, and automatic destruction.
@@ -202,6 +412,10 @@ public:
   /// Copy constructor. Increases retain count of the referred object.
   DatumP(const DatumP &other) noexcept;
 
+  /// Move constructor. Takes over the reference held by other, leaving other
+  /// pointing to notADatum. The retain count is unchanged.
+  DatumP(DatumP &&other) noexcept;
+
   /// Default constructor. Points to notADatum (like NULL)
   DatumP();
 
@@ -228,87 +442,157 @@ public:
   ~DatumP();
 
   /// Returns a pointer to the referred Datum or any of Datum's subclasses.
-  Datum *datumValue() { return d; }
+  Datum *datumValue() const { return d; }
 
   /// Returns a pointer to the referred Datum as a Word.
-  Word *wordValue();
+  Word *wordValue() const;
 
   /// Returns a pointer to the referred Datum as a List.
-  List *listValue();
+  List *listValue() const;
 
   /// Returns a pointer to the referred Datum as a ListNodeValue.
-  ListNode *listNodeValue();
+  ListNode *listNodeValue() const;
 
   /// Returns a pointer to the referred Datum as a Procedure.
-  Procedure *procedureValue();
+  Procedure *procedureValue() const;
 
   /// Returns a pointer to the referred Datum as an ASTNode.
-  ASTNode *astnodeValue();
+  ASTNode *astnodeValue() const;
 
   /// Returns a pointer to the referred Datum as an Array.
-  Array *arrayValue();
+  Array *arrayValue() const;
 
   /// Returns a pointer to the referred Datum as an Error.
-  Error *errorValue();
+  Error *errorValue() const;
 
   /// Returns true if the referred Datum is a Word, false otherwise.
-  bool isWord();
+  bool isWord() const;
 
   /// Returns true if the referred Datum is a List, false otherwise.
-  bool isList();
+  bool isList() const;
 
   /// Returns true if the referred Datum is an ASTNode, false otherwise.
-  bool isASTNode();
+  bool isASTNode() const;
 
   /// Returns true if the referred Datum is an Array, false otherwise.
-  bool isArray();
+  bool isArray() const;
 
   /// Returns true if the referred Datum is an Error, false otherwise.
-  bool isError();
+  bool isError() const;
 
   /// Returns true if the referred Datum is a notADatum, false otherwise.
-  bool isNothing();
+  bool isNothing() const;
 
   /// Reassign the pointer to refer to the other object.
   DatumP &operator=(const DatumP &other) noexcept;
 
+  /// Take over the reference held by other, leaving other pointing to
+  /// notADatum.
+  DatumP &operator=(DatumP &&other) noexcept;
+
   /// Reassign the pointer to refer to the other object.
   DatumP &operator=(DatumP *other) noexcept;
 
   /// Return true if and only if other points to the same object as this.
-  bool operator==(DatumP *other);
+  bool operator==(DatumP *other) const;
 
   /// Return true if and only if other points to the same object as this.
-  bool operator==(const DatumP &other);
+  bool operator==(const DatumP &other) const;
 
   /// Return true if and only if other does not point to the same object as this.
-  bool operator!=(DatumP *other);
+  bool operator!=(DatumP *other) const;
 
   /// Return true if and only if other does not point to the same object as this.
-  bool operator!=(const DatumP &other);
+  bool operator!=(const DatumP &other) const;
 
   /// Return true if and only if the other object is equal to this in the manner suitable for EQUALP.
-  bool isEqual(DatumP other, bool ignoreCase);
+  bool isEqual(const DatumP &other, bool ignoreCase) const;
 
   /// Return true if and only if the other object is equal to this in the manner suitable for .EQ.
-  bool isDotEqual(DatumP other);
+  bool isDotEqual(const DatumP &other) const;
 
   /// Return a string suitable for the PRINT command
   QString printValue(bool fullPrintp = false, int printDepthLimit = -1,
-                     int printWidthLimit = -1);
+                     int printWidthLimit = -1) const;
 
   /// Return a string suitable for the SHOW command
   QString showValue(bool fullPrintp = false, int printDepthLimit = -1,
-                    int printWidthLimit = -1);
+                    int printWidthLimit = -1) const;
 
   /// returns a DatumType enumerated value which is the DatumType of the referenced object.
-  Datum::DatumType isa();
+  Datum::DatumType isa() const;
 };
 
 // If/when List is implemented using QList, this will increase efficiency.
 // Since we're using linked lists, this is a noop for now.
 Q_DECLARE_TYPEINFO(DatumP, Q_MOVABLE_TYPE);
 
+/// \brief A single instruction of the optional bytecode engine.
+///
+/// Runlists and OUTPUT expressions may be compiled from their ASTNodes into a
+/// flat sequence of Instructions which the Kernel runs on an operand stack.
+/// See kernel_bytecode.cpp.
+struct Instruction {
+  enum Opcode {
+    opStatement,       // Start of a statement: check the previous result
+    opEndStatement,    // Pop the statement's result
+    opLiteral,         // Push datum
+    opValueOf,         // Push the value of the variable named in datum
+    opCall,            // Call the ASTNode in datum with count prepared inputs
+    opEval,            // Call the ASTNode in datum; it evaluates its own inputs
+    opEnterProcedure,  // Create the variable scope for a procedure call
+    opCallProcedure,   // Run procedure datum with count inputs; leave the scope
+    opTailProcedure,   // Run procedure datum with count inputs in current scope
+    opHalt,            // End of a runlist
+    opReturn,          // End of an expression: return the top of the stack
+    opJump,            // Continue at count
+    opTest,            // Pop the condition of IF or IFELSE; if false, jump to count
+    opRepeat,          // Pop the count of REPEAT and start the loop; if zero,
+                       // jump to count
+    opRepeatNext,      // End of a REPEAT body: jump to count to run it again
+    opBody,            // Start of an inlined runlist; if its AST has changed,
+                       // run it with runList() and jump to count
+    opEndBody,         // End of an inlined runlist: handle queued events
+    opExit             // STOP, OUTPUT, or .MAYBEOUTPUT: the statement's result is
+                       // datum
+  };
+
+  Opcode opcode;
+
+  /// The number of prepared inputs consumed by a call, or the target of a
+  /// jump.
+  int count;
+
+  /// The literal, or the ASTNode to execute.
+  DatumP datum;
+
+  /// The ASTNode held by datum, if any.
+  ASTNode *node;
+
+  /// If not NULL, the result of this instruction is an input to parent and
+  /// must be checked the same way ProcedureHelper checks its inputs.
+  ASTNode *parent;
+
+  /// For opBody, the astBuildNumber of the runlist in datum when it was
+  /// compiled.
+  quint64 buildNumber;
+
+  Instruction(Opcode aOpcode, DatumP aDatum = DatumP(), int aCount = 0,
+              ASTNode *aParent = NULL)
+      : opcode(aOpcode), count(aCount), datum(aDatum),
+        node(aDatum.isASTNode() ? aDatum.astnodeValue() : NULL),
+        parent(aParent), buildNumber(0) {}
+  Instruction()
+      : opcode(opHalt), count(0), node(NULL), parent(NULL), buildNumber(0) {}
+};
+
+/// A List whose statements were compiled in place of a runlist input of IF,
+/// IFELSE, or REPEAT, and the value of its astBuildNumber at the time.
+struct InlinedList {
+  DatumP list;
+  quint64 buildNumber;
+};
+
 /// \brief A node of QLogo's Abstract Syntax Tree.
 ///
 /// Before execution, a list is parsed into a list of executable nodes. Each node
@@ -319,6 +603,7 @@ protected:
   std::vector<DatumP> children;
 
 public:
+  DATUM_POOL_ALLOCATED(astnodePool)
 
   /// A human-readable string. Usually the command name.
   DatumP nodeName;
@@ -328,11 +613,22 @@ public:
   /// A pointer to the kernel method that should be called when executing this node.
   KernelMethod kernel;
 
+  /// The compiled form of this node when it is evaluated as the expression of
+  /// OUTPUT. Empty until the bytecode engine first needs it.
+  QVector<Instruction> bytecode;
+
+  /// For a call of a user-defined procedure, the cell that holds the current
+  /// definition of its name. NULL for anything else.
+  ProcedureCell *procedureCell = NULL;
+
   /// Add a child to the node.
   void addChild(DatumP aChild);
 
+  /// Replace the child at the specified index.
+  void setChildAtIndex(unsigned index, DatumP aChild);
+
   /// Returns the child at the specified index.
-  DatumP childAtIndex(unsigned index);
+  const DatumP &childAtIndex(unsigned index);
 
   /// Returns the number of children that this node owns.
   int countOfChildren();
@@ -340,7 +636,6 @@ public:
   ASTNode(DatumP aNodeName);
   ASTNode(const char *aNodeName);
   ~ASTNode();
-  DatumType isa();
 
   /// For debugging. To be used when printing out the AST.
   QString name();
@@ -367,8 +662,10 @@ public:
 ///
 /// e.g. "SUM WORD 3 4 2" outputs "36".
 class Word : public Datum {
-protected:
+public:
+  DATUM_POOL_ALLOCATED(wordPool)
 
+protected:
   friend class WordIterator;
 
   // TODO: the nomenclature assumes words are mutable. They are not.
@@ -381,6 +678,11 @@ protected:
   double number;
   bool numberConversionSucceeded;
 
+  /// True once the string has been found not to be a number, so that the
+  /// conversion isn't tried again.
+  bool isKnownNotANumber = false;
+  Symbol keySymbol = noSymbol;
+
 public:
 
   bool isForeverSpecial = false;
@@ -403,7 +705,6 @@ public:
   /// returns the number representation of the Word. Use didNumberConversionSucceed() to check.
   double numberValue(void);
 
-  DatumType isa();
   QString name();
 
   // print() and show() will convert encoded chars to their displayable
@@ -416,13 +717,20 @@ public:
   /// Returns a string that can be used as the name of a procedure, variable, or property list.
   QString keyValue(); // for use as key for procedure names and variable names
 
+  /// Returns the Symbol of keyValue(). Cached after the first call.
+  Symbol symbolValue();
+
+  /// Returns the Symbol of keyValue() if it already has one, otherwise
+  /// noSymbol. Unlike symbolValue(), never creates a Symbol.
+  Symbol existingSymbolValue();
+
   /// Returns the string with the special character encoding intact.
   QString rawValue();
 
   /// Returns true if the value pointed to by other is equal to this Word's value.
   /// \param other the value to be tested against.
   /// \param ignoreCase if true use case-insensitive compare.
-  bool isEqual(DatumP other, bool ignoreCase);
+  bool isEqual(const DatumP &other, bool ignoreCase);
 
   /// Returns the first character of the string value.
   DatumP first(void);
@@ -449,42 +757,224 @@ public:
   bool isIndexInRange(int anIndex);
 
   /// Returns true if aDatum is a substring.
-  bool containsDatum(DatumP aDatum, bool ignoreCase);
+  bool containsDatum(const DatumP &aDatum, bool ignoreCase);
 
   /// Returns true if aDatum is a substring.
-  bool isMember(DatumP aDatum, bool ignoreCase);
+  bool isMember(const DatumP &aDatum, bool ignoreCase);
 
   /// Returns a substring starting at the first occurrence of aDatum to the end of the string.
-  DatumP fromMember(DatumP aDatum, bool ignoreCase);
+  DatumP fromMember(const DatumP &aDatum, bool ignoreCase);
 
   Iterator newIterator(void);
 };
 
-/// An element of a List.
+/// The Lists or Arrays between the outermost datum of a comparison or print
+/// and the one currently being visited, used to detect circular structures.
+class VisitedPath {
+  friend class PathEntry;
+  QHash<const Datum *, int> depths;
+
+public:
+  /// Returns the depth at which aDatum was entered, or -1 if aDatum is not on
+  /// the path.
+  int depthOf(const Datum *aDatum) const { return depths.value(aDatum, -1); }
+
+  bool contains(const Datum *aDatum) const { return depths.contains(aDatum); }
+};
+
+/// Puts a datum on a VisitedPath for the lifetime of the PathEntry.
+class PathEntry {
+  VisitedPath &path;
+  const Datum *datum;
+
+public:
+  PathEntry(VisitedPath &aPath, const Datum *aDatum)
+      : path(aPath), datum(aDatum) {
+    path.depths.insert(aDatum, path.depths.size());
+  }
+  ~PathEntry() { path.depths.remove(datum); }
+};
+
+/// The number of items that a ListNode can hold.
+const int listNodeCapacity = 8;
+
+/// \brief A block of consecutive elements of a List.
+///
+/// A List is stored as a chain of ListNodes, each of which holds up to
+/// capacity items in items[begin] through items[end - 1]. The item that
+/// follows items[end - 1] is next->items[nextIndex]. A List refers to its first
+/// item by a node and an index, so that BUTFIRST can share the rest of the
+/// chain.
+///
+/// The unused slots below begin are claimed by FPUT, and the slots above end
+/// by append, when they extend a list at that point, so that a list built one
+/// item at a time fills its nodes. A List is read from its first item to the
+/// end of the chain, so claiming a slot below begin doesn't change any List
+/// that shares the node. append only claims a slot above end for a List that
+/// isn't shared.
+///
+/// The slots are kept by the subclasses: FullListNode for lists that are being
+/// built, and SmallListNode for an FPUT that can't be extended further.
 class ListNode : public Datum {
+protected:
+  ListNode(DatumP *someItems, int aCapacity, size_t aSize);
+
 public:
-    DatumType isa() { return listNodeType; }
+  /// Links made by .SETBF that replace the successor of an item that is not
+  /// the last item in the node.
+  struct Splice {
+    int index;
+    DatumP node;
+    int nodeIndex;
+  };
+
+  ~ListNode();
 
-    /// The item at this position in the list.
-    DatumP item;
+  /// The items held by this node.
+  DatumP *const items;
 
-    /// A pointer to the next ListNode.
-    DatumP next;
+  /// The number of slots in items.
+  const qint8 capacity;
+
+  /// The index of the first used slot of items.
+  qint8 begin;
+
+  /// One past the index of the last used slot of items.
+  qint8 end;
+
+  /// The index of the item in next that follows items[end - 1].
+  qint8 nextIndex;
+
+  /// Bit i is set if items[i] has an entry in splices, so that advance()
+  /// only searches splices for those items.
+  quint8 splicedItems;
+
+  /// The node holding the item that follows items[end - 1].
+  DatumP next;
+
+  /// NULL unless .SETBF has been applied to an item in the middle of this
+  /// node.
+  QVector<Splice> *splices;
+
+  /// Move aNode and aIndex to the item that follows items[aIndex] of aNode.
+  /// aNode becomes NULL at the end of the chain.
+  static void advance(ListNode *&aNode, int &aIndex);
+
+  /// Make aNode->items[aNodeIndex] the item that follows items[anIndex].
+  void linkAfter(int anIndex, DatumP aNode, int aNodeIndex);
+
+  /// Returns true if nothing follows items[anIndex], so that another item may
+  /// be placed after it without changing any list that shares this node.
+  bool isEndOfChain(int anIndex);
+
+  void appendChildren(QVector<Datum *> &aChildren);
+  void clearChildren();
 };
 
-/// The container for data. The QLogo List is implemented as a linked list.
+/// A ListNode with listNodeCapacity slots.
+class FullListNode : public ListNode {
+  DatumP storage[listNodeCapacity];
+
+public:
+  DATUM_POOL_ALLOCATED(listNodePool)
+
+  FullListNode() : ListNode(storage, listNodeCapacity, sizeof(FullListNode)) {}
+};
+
+/// A ListNode with one slot, for an FPUT in front of an item that isn't the
+/// first in its node, such as FPUT X BUTFIRST :L. No other item can be put in
+/// front of that item, so a FullListNode would only waste its other slots.
+class SmallListNode : public ListNode {
+  DatumP storage[1];
+
+public:
+  DATUM_POOL_ALLOCATED(smallListNodePool)
+
+  SmallListNode() : ListNode(storage, 1, sizeof(SmallListNode)) {}
+};
+
+/// The container for data. The QLogo List is implemented as a chain of
+/// ListNodes, each holding several items.
 class List : public Datum {
   friend class ListIterator;
   friend class Array; // TODO: See if we can remove this.
-  friend class Parser; // Parser needs access to astList and astParseTimeStamp
+  friend class Parser; // Parser needs access to the AST cache
+  friend class Kernel; // Kernel needs access to the bytecode cache
+
+public:
+  DATUM_POOL_ALLOCATED(listPool)
 
 protected:
   DatumP head;
+  int headIndex;
   DatumP lastNode;
+  int lastIndex;
   int listSize;
+
+  /// The value of structureGeneration when listSize, lastNode, and lastIndex
+  /// were last known to describe the chain from head.
+  quint64 shapeGeneration;
   QList<DatumP> astList;
-  qint64 astParseTimeStamp;
-  void setListSize();
+
+  /// The procedure generation at which astList was last known to be valid.
+  /// Zero means astList must be rebuilt.
+  quint64 astParseGeneration;
+
+  /// The command names resolved while building astList, with the generation
+  /// each name had at that time.
+  QHash<Symbol, quint64> astDependencies;
+
+  /// The compiled form of astList. Empty until the bytecode engine first runs
+  /// this list, and cleared whenever astList is rebuilt.
+  QVector<Instruction> bytecode;
+
+  /// The position in bytecode of each TAG in this list.
+  QHash<QString, int> bytecodeTags;
+
+  /// The runlists compiled into bytecode. The bytecode is only valid while
+  /// each of their ASTs is the one it was compiled from.
+  QVector<InlinedList> bytecodeInlinedLists;
+
+  /// Set to a new value each time astList is rebuilt.
+  quint64 astBuildNumber;
+
+  /// Add element after the last item of this List, claiming a free slot or
+  /// linking a new node.
+  void appendAfterLast(DatumP element);
+
+  /// The node, slot, and item number of the item most recently reached by
+  /// datumAtIndex() or setItem(), so that sequential access doesn't walk the
+  /// List from the head each time.
+  DatumP cursorNode;
+  int cursorIndex;
+  int cursorPosition;
+
+  /// The value of structureGeneration when the cursor was set.
+  quint64 cursorGeneration;
+
+  /// Incremented whenever .SETBF relinks any node, which may move items of
+  /// every List that shares that node.
+  static quint64 structureGeneration;
+
+  /// Set aNode and aIndex to the item at anIndex, starting from the cursor
+  /// when it is valid and not past anIndex. Updates the cursor.
+  void seek(int anIndex, ListNode *&aNode, int &aIndex);
+
+  /// Forget the cursor.
+  void invalidateCursor() { cursorPosition = 0; }
+
+  /// Count the chain from head again if .SETBF may have changed it since
+  /// listSize, lastNode, and lastIndex were set.
+  void updateShape() {
+    if (shapeGeneration != structureGeneration)
+      countShape();
+  }
+
+  /// Set listSize, lastNode, and lastIndex by walking the chain from head.
+  void countShape();
+
+  /// Make the next updateShape() walk the chain.
+  void forgetShape() { shapeGeneration = structureGeneration - 1; }
 
 public:
 
@@ -498,13 +988,12 @@ public:
   List(Array *source);
 
   ~List();
-  DatumType isa();
   QString name();
   QString printValue(bool fullPrintp = false, int printDepthLimit = -1,
                      int printWidthLimit = -1);
   QString showValue(bool fullPrintp = false, int printDepthLimit = -1,
                     int printWidthLimit = -1);
-  bool isEqual(DatumP other, bool ignoreCase);
+  bool isEqual(const DatumP &other, bool ignoreCase);
 
   /// Return the first item of the List.
   DatumP first(void);
@@ -520,7 +1009,10 @@ public:
   void append(DatumP element);
 
   /// Returns the count of elements in the List.
-  int size() { return listSize; }
+  int size() {
+    updateShape();
+    return listSize;
+  }
 
   /// Returns the last elements of the List.
   DatumP last();
@@ -534,6 +1026,10 @@ public:
   /// Creates a new List by adding an element to the head of this List.
   DatumP fput(DatumP item);
 
+  /// Creates a new List by adding an element to the end of a copy of this
+  /// List.
+  DatumP lput(DatumP item);
+
   /// Returns the element pointed to by anIndex.
   DatumP datumAtIndex(int anIndex);
 
@@ -550,14 +1046,17 @@ public:
   void setButfirstItem(DatumP aValue);
 
   /// Recursively searches List for aDatum. Returns true if found.
-  bool containsDatum(DatumP aDatum, bool ignoreCase);
+  bool containsDatum(const DatumP &aDatum, bool ignoreCase);
 
   /// Returns true if aDatum is a member of this List.
-  bool isMember(DatumP aDatum, bool ignoreCase);
+  bool isMember(const DatumP &aDatum, bool ignoreCase);
+
+  void appendChildren(QVector<Datum *> &aChildren);
+  void clearChildren();
 
   /// Non-recursively searches this List for aDatum. Returns a new List starting
   /// from where aDaum was found to the end of this List.
-  DatumP fromMember(DatumP aDatum, bool ignoreCase);
+  DatumP fromMember(const DatumP &aDatum, bool ignoreCase);
 
   ListIterator newIterator(void);
 };
@@ -570,6 +1069,7 @@ protected:
   QVector<DatumP> array;
 
 public:
+  DATUM_POOL_ALLOCATED(arrayPool)
 
   /// Create an Array containing aSize empty List with starting index at aOrigin.
   Array(int aOrigin, int aSize);
@@ -577,7 +1077,6 @@ public:
   /// Create an Array containing items copied from source with index starting at aOrigin.
   Array(int aOrigin, List *source);
   ~Array();
-  DatumType isa();
   QString name();
   QString printValue(bool fullPrintp = false, int printDepthLimit = -1,
                      int printWidthLimit = -1);
@@ -585,7 +1084,7 @@ public:
                     int printWidthLimit = -1);
 
   /// Returns true if items in other Array are equal to this Array's items.
-  bool isEqual(DatumP other, bool ignoreCase);
+  bool isEqual(const DatumP &other, bool ignoreCase);
 
   /// The starting index of this Array.
   int origin = 1;
@@ -609,13 +1108,16 @@ public:
   void setButfirstItem(DatumP aValue);
 
   /// Recursively searches Array for aDatum. Returns true if found.
-  bool containsDatum(DatumP aDatum, bool ignoreCase);
+  bool containsDatum(const DatumP &aDatum, bool ignoreCase);
 
   /// Returns true if aDatum is a member of Array.
-  bool isMember(DatumP aDatum, bool ignoreCase);
+  bool isMember(const DatumP &aDatum, bool ignoreCase);
 
   /// Returns a new Array beginning with the first occurrence of aDatum to the end of the Array.
-  DatumP fromMember(DatumP aDatum, bool ignoreCase);
+  DatumP fromMember(const DatumP &aDatum, bool ignoreCase);
+
+  void appendChildren(QVector<Datum *> &aChildren);
+  void clearChildren();
 
   /// Returns the first element of the Array.
   DatumP first();
@@ -645,12 +1147,14 @@ public:
 class ListIterator : public Iterator {
 protected:
     DatumP ptr;
+    int index;
 
 public:
   ListIterator();
 
-  /// Create a new ListIterator pointing to the head of the List.
-  ListIterator(DatumP head);
+  /// Create a new ListIterator pointing to the item at anIndex of the ListNode
+  /// head. It returns the items up to the end of the chain.
+  ListIterator(DatumP head, int anIndex);
 
   /// Return the element at the current location. Advance Iterator to the next location.
   DatumP element();
@@ -702,4 +1206,43 @@ extern Datum notADatum;
 /// A pointer to notADatum, like NULL.
 extern DatumP nothing;
 
+// The type checks and casts of DatumP are used by nearly every primitive, so
+// they are defined here where they can be inlined.
+
+inline Datum::DatumType DatumP::isa() const { return d->isa(); }
+
+inline bool DatumP::isASTNode() const { return d->isa() == Datum::astnodeType; }
+
+inline bool DatumP::isList() const { return d->isa() == Datum::listType; }
+
+inline bool DatumP::isArray() const { return d->isa() == Datum::arrayType; }
+
+inline bool DatumP::isWord() const { return d->isa() == Datum::wordType; }
+
+inline bool DatumP::isError() const { return d->isa() == Datum::errorType; }
+
+inline Word *DatumP::wordValue() const {
+  Q_ASSERT(d->isa() == Datum::wordType);
+  return static_cast<Word *>(d);
+}
+
+inline List *DatumP::listValue() const {
+  Q_ASSERT(d->isa() == Datum::listType);
+  return static_cast<List *>(d);
+}
+
+inline ListNode *DatumP::listNodeValue() const {
+  Q_ASSERT(d->isa() == Datum::listNodeType);
+  return static_cast<ListNode *>(d);
+}
+
+inline Array *DatumP::arrayValue() const {
+  Q_ASSERT(d->isa() == Datum::arrayType);
+  return static_cast<Array *>(d);
+}
+
+inline ASTNode *DatumP::astnodeValue() const {
+  return static_cast<ASTNode *>(d);
+}
+
 #endif // DATUM_H
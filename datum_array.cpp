@@ -28,10 +28,11 @@
 #include "datum.h"
 #include <qdebug.h>
 
-QList<void *> aryVisited;
-QList<void *> otherAryVisited;
+static VisitedPath aryVisited;
+static VisitedPath otherAryVisited;
 
 Array::Array(int aOrigin, int aSize) {
+  setDatumType(arrayType, sizeof(Array));
   origin = aOrigin;
   array.reserve(aSize);
   for (int i = 0; i < aSize; ++i) {
@@ -40,19 +41,17 @@ Array::Array(int aOrigin, int aSize) {
 }
 
 Array::Array(int aOrigin, List *source) {
+  setDatumType(arrayType, sizeof(Array));
   origin = aOrigin;
   array.reserve(source->size());
-  DatumP ptr = source->head;
-  while (ptr != nothing) {
-      array.push_back(ptr.listNodeValue()->item);
-      ptr = ptr.listNodeValue()->next;
+  ListIterator iter = source->newIterator();
+  while (iter.elementExists()) {
+      array.push_back(iter.element());
   }
 }
 
 Array::~Array() {}
 
-Datum::DatumType Array::isa() { return Datum::arrayType; }
-
 QString Array::name() {
   static const QString retval("Array");
   return retval;
@@ -86,55 +85,45 @@ QString Array::printValue(bool fullPrintp, int printDepthLimit,
 QString Array::showValue(bool fullPrintp, int printDepthLimit,
                          int printWidthLimit) {
   if (!aryVisited.contains(this)) {
-    aryVisited.push_back(this);
+    PathEntry entry(aryVisited, this);
     QString retval = "{";
     retval.append(printValue(fullPrintp, printDepthLimit, printWidthLimit));
     retval.append("}");
-    aryVisited.removeOne(this);
     return retval;
   }
   return "...";
 }
 
-bool Array::isEqual(DatumP other, bool ignoreCase) {
-  ArrayIterator iter;
-  ArrayIterator otherIter;
+bool Array::isEqual(const DatumP &other, bool ignoreCase) {
   Array *o = other.arrayValue();
-  int myIndex = aryVisited.indexOf(this);
-  int otherIndex = otherAryVisited.indexOf(o);
-  if (myIndex != otherIndex)
-    goto exit_false;
+  int myDepth = aryVisited.depthOf(this);
+  int otherDepth = otherAryVisited.depthOf(o);
+  if (myDepth != otherDepth)
+    return false;
 
-  if (myIndex > -1)
+  if (myDepth > -1)
     return true;
 
   if (size() != o->size())
-    goto exit_false;
+    return false;
 
-  iter = newIterator();
-  otherIter = o->newIterator();
-  aryVisited.push_back(this);
-  otherAryVisited.push_back(o);
+  ArrayIterator iter = newIterator();
+  ArrayIterator otherIter = o->newIterator();
+  PathEntry entry(aryVisited, this);
+  PathEntry otherEntry(otherAryVisited, o);
 
   while (iter.elementExists()) {
     DatumP value = iter.element();
     DatumP otherValue = otherIter.element();
     if (!value.isEqual(otherValue, ignoreCase))
-      goto exit_false;
+      return false;
   }
-  aryVisited.pop_back();
-  otherAryVisited.pop_back();
   return true;
-
-exit_false:
-  aryVisited.clear();
-  otherAryVisited.clear();
-  return false;
 }
 
 int Array::size() { return array.size(); }
 
-void Array::append(DatumP value) { array.append(value); }
+void Array::append(DatumP value) { array.append(std::move(value)); }
 
 bool Array::isIndexInRange(int anIndex) {
   int index = anIndex - origin;
@@ -143,7 +132,9 @@ bool Array::isIndexInRange(int anIndex) {
 
 void Array::setItem(int anIndex, DatumP aValue) {
   int index = anIndex - origin;
-  array[index] = aValue;
+  if (aValue.isList() || aValue.isArray())
+    addCycleCandidate(this);
+  array[index] = std::move(aValue);
 }
 
 void Array::setButfirstItem(DatumP aValue) {
@@ -153,11 +144,24 @@ void Array::setButfirstItem(DatumP aValue) {
   array.erase(estart, array.end());
   array.reserve(aValue.arrayValue()->size() + 1);
   array.append(aValue.arrayValue()->array);
+  addCycleCandidate(this);
+}
+
+void Array::setFirstItem(DatumP aValue) {
+  if (aValue.isList() || aValue.isArray())
+    addCycleCandidate(this);
+  array[0] = std::move(aValue);
+}
+
+void Array::appendChildren(QVector<Datum *> &aChildren) {
+  for (auto &e : array) {
+    aChildren.push_back(e.datumValue());
+  }
 }
 
-void Array::setFirstItem(DatumP aValue) { array[0] = aValue; }
+void Array::clearChildren() { array.clear(); }
 
-bool Array::containsDatum(DatumP aDatum, bool ignoreCase) {
+bool Array::containsDatum(const DatumP &aDatum, bool ignoreCase) {
   for (int i = 0; i < array.size(); ++i) {
     DatumP e = array[i];
     if (e == aDatum)
@@ -168,7 +172,7 @@ bool Array::containsDatum(DatumP aDatum, bool ignoreCase) {
   return false;
 }
 
-bool Array::isMember(DatumP aDatum, bool ignoreCase) {
+bool Array::isMember(const DatumP &aDatum, bool ignoreCase) {
   for (int i = 0; i < array.size(); ++i) {
     if (array[i].isEqual(aDatum, ignoreCase))
       return true;
@@ -176,7 +180,7 @@ bool Array::isMember(DatumP aDatum, bool ignoreCase) {
   return false;
 }
 
-DatumP Array::fromMember(DatumP aDatum, bool ignoreCase) {
+DatumP Array::fromMember(const DatumP &aDatum, bool ignoreCase) {
   for (int i = 0; i < array.size(); ++i) {
     if (array[i].isEqual(aDatum, ignoreCase)) {
       Array *retval = new Array(origin, 0);
@@ -28,25 +28,32 @@
 #include "datum.h"
 #include <qdebug.h>
 
-void ASTNode::addChild(DatumP aChild) { children.push_back(aChild); }
+void ASTNode::addChild(DatumP aChild) {
+  children.push_back(std::move(aChild));
+}
 
 int ASTNode::countOfChildren() { return (int)children.size(); }
 
-DatumP ASTNode::childAtIndex(unsigned index) { return children.at(index); }
+const DatumP &ASTNode::childAtIndex(unsigned index) {
+  return children.at(index);
+}
 
-ASTNode::ASTNode(DatumP aNodeName) {
-  nodeName = aNodeName;
+void ASTNode::setChildAtIndex(unsigned index, DatumP aChild) {
+  children.at(index) = std::move(aChild);
+}
+
+ASTNode::ASTNode(DatumP aNodeName) : nodeName(std::move(aNodeName)) {
+  setDatumType(astnodeType, sizeof(ASTNode));
 }
 
 ASTNode::ASTNode(const char *aNodeName) {
+  setDatumType(astnodeType, sizeof(ASTNode));
   nodeName = DatumP(new Word(aNodeName));
 }
 
 ASTNode::~ASTNode() {
 }
 
-Datum::DatumType ASTNode::isa() { return astnodeType; }
-
 QString ASTNode::name(void) {
   static const QString retval("ASTNode");
   return retval;
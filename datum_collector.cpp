@@ -0,0 +1,159 @@
+//===-- qlogo/datum_collector.cpp - Cycle collector implementation -------*- C++ -*-===//
+//
+// This file is part of QLogo.
+//
+// QLogo is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 2 of the License, or
+// (at your option) any later version.
+//
+// QLogo is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with QLogo.  If not, see <http://www.gnu.org/licenses/>.
+//
+//===----------------------------------------------------------------------===//
+///
+/// \file
+/// This file contains the implementation of the cycle collector, which frees
+/// the circular structures that reference counting cannot.
+///
+//===----------------------------------------------------------------------===//
+
+#include "datum.h"
+
+#include <QSet>
+
+// Collect automatically once there are this many candidates.
+const int minCycleCandidateThreshold = 10000;
+
+static QSet<Datum *> cycleCandidates;
+static int cycleCandidateThreshold = minCycleCandidateThreshold;
+static bool isCollectingCycles = false;
+
+// The number of candidates found to be live by the last collection.
+static int countOfLiveCandidates = 0;
+
+// Only these types can refer to other Datums through .SETFIRST, .SETBF, and
+// .SETITEM.
+static bool isCollectable(Datum *aDatum) {
+  Datum::DatumType type = aDatum->isa();
+  return (type == Datum::listType) || (type == Datum::listNodeType) ||
+         (type == Datum::arrayType);
+}
+
+void addCycleCandidate(Datum *aDatum) {
+  if (aDatum->isCycleCandidate)
+    return;
+  aDatum->isCycleCandidate = true;
+  cycleCandidates.insert(aDatum);
+  if (cycleCandidates.size() >= cycleCandidateThreshold) {
+    collectCycles();
+    // Don't rescan the survivors too often.
+    cycleCandidateThreshold =
+        qMax(minCycleCandidateThreshold, countOfLiveCandidates * 2);
+  }
+}
+
+void forgetCycleCandidate(Datum *aDatum) {
+  aDatum->isCycleCandidate = false;
+  cycleCandidates.remove(aDatum);
+}
+
+void suspectCycleCandidate(Datum *aDatum) {
+  aDatum->isCycleCandidate = true;
+  cycleCandidates.insert(aDatum);
+}
+
+int collectCycles() {
+  if (isCollectingCycles)
+    return 0;
+  isCollectingCycles = true;
+
+  // The number of references each Datum receives from within the graph.
+  QHash<Datum *, int> internalRefs;
+  QVector<Datum *> members;
+  QVector<Datum *> stack;
+  QVector<Datum *> children;
+
+  // A Datum whose retain count has fallen to zero is already waiting in the
+  // release queue, and its destruction will release what it refers to.
+  for (Datum *candidate : cycleCandidates) {
+    if (candidate->retainCount > 0) {
+      internalRefs.insert(candidate, 0);
+      members.push_back(candidate);
+      stack.push_back(candidate);
+    }
+  }
+
+  while (!stack.isEmpty()) {
+    Datum *d = stack.takeLast();
+    children.clear();
+    d->appendChildren(children);
+    for (Datum *child : children) {
+      if (!isCollectable(child))
+        continue;
+      auto iter = internalRefs.find(child);
+      if (iter == internalRefs.end()) {
+        iter = internalRefs.insert(child, 0);
+        members.push_back(child);
+        stack.push_back(child);
+      }
+      ++iter.value();
+    }
+  }
+
+  // Anything referred to from outside the graph is live, and so is everything
+  // it refers to.
+  QSet<Datum *> live;
+  for (Datum *d : members) {
+    if ((d->retainCount > internalRefs.value(d)) && !live.contains(d)) {
+      live.insert(d);
+      stack.push_back(d);
+    }
+  }
+  while (!stack.isEmpty()) {
+    Datum *d = stack.takeLast();
+    children.clear();
+    d->appendChildren(children);
+    for (Datum *child : children) {
+      if (isCollectable(child) && !live.contains(child)) {
+        live.insert(child);
+        stack.push_back(child);
+      }
+    }
+  }
+
+  countOfLiveCandidates = 0;
+  for (Datum *candidate : cycleCandidates) {
+    if (live.contains(candidate))
+      ++countOfLiveCandidates;
+  }
+
+  // A live structure can only become garbage by losing a reference, so its
+  // Datums are no longer suspect until one of them does.
+  for (Datum *d : live)
+    d->mayBeInCycle = true;
+  for (Datum *candidate : cycleCandidates)
+    candidate->isCycleCandidate = false;
+  cycleCandidates.clear();
+
+  // Hold on to the garbage while its references are released, so that none of
+  // it is destroyed before all of it has been cleared.
+  QVector<DatumP> garbage;
+  for (Datum *d : members) {
+    if (!live.contains(d))
+      garbage.push_back(DatumP(d));
+  }
+  for (auto &d : garbage) {
+    d.datumValue()->clearChildren();
+  }
+  garbage.clear();
+  int retval = drainReleaseQueue();
+
+  isCollectingCycles = false;
+  return retval;
+}
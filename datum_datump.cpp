@@ -27,11 +27,35 @@
 //===----------------------------------------------------------------------===//
 
 #include "datum.h"
-#include <qdebug.h>
 
 Word trueWord("true", false, false);
 Word falseWord("false", false, false);
 
+// The queue is emptied immediately once it holds this many Datums.
+const int maxReleaseQueueSize = 100000;
+
+static QVector<Datum *> releaseQueue;
+static bool isDrainingReleaseQueue = false;
+
+int drainReleaseQueue(int aLimit) {
+  if (isDrainingReleaseQueue)
+    return 0;
+  isDrainingReleaseQueue = true;
+  int count = 0;
+  while (!releaseQueue.isEmpty() && (aLimit != 0)) {
+    Datum *d = releaseQueue.takeLast();
+    d->isQueuedForRelease = false;
+    if (!d->shouldDelete())
+      continue;
+    delete d;
+    ++count;
+    if (aLimit > 0)
+      --aLimit;
+  }
+  isDrainingReleaseQueue = false;
+  return count;
+}
+
 
 DatumP::DatumP() { d = &notADatum; }
 
@@ -49,13 +73,23 @@ DatumP::DatumP(const DatumP &other) noexcept {
   }
 }
 
+DatumP::DatumP(DatumP &&other) noexcept {
+  d = other.d;
+  other.d = &notADatum;
+}
+
 DatumP::DatumP(bool b) { d = b ? &trueWord : &falseWord; }
 
 void DatumP::destroy() {
   if (d != &notADatum) {
     d->release();
-    if (d->shouldDelete()) {
-      delete d;
+    if (d->shouldDelete() && !d->isQueuedForRelease) {
+      d->isQueuedForRelease = true;
+      releaseQueue.push_back(d);
+      if (releaseQueue.size() >= maxReleaseQueueSize)
+        drainReleaseQueue();
+    } else if (d->mayBeInCycle && !d->isCycleCandidate) {
+      suspectCycleCandidate(d);
     }
   }
 }
@@ -73,6 +107,15 @@ DatumP &DatumP::operator=(const DatumP &other) noexcept {
   return *this;
 }
 
+DatumP &DatumP::operator=(DatumP &&other) noexcept {
+  if (&other != this) {
+    destroy();
+    d = other.d;
+    other.d = &notADatum;
+  }
+  return *this;
+}
+
 DatumP &DatumP::operator=(DatumP *other) noexcept {
   if (other != this) {
     destroy();
@@ -82,16 +125,16 @@ DatumP &DatumP::operator=(DatumP *other) noexcept {
   return *this;
 }
 
-bool DatumP::operator==(DatumP *other) { return d == other->d; }
+bool DatumP::operator==(DatumP *other) const { return d == other->d; }
 
-bool DatumP::operator==(const DatumP &other) { return d == other.d; }
+bool DatumP::operator==(const DatumP &other) const { return d == other.d; }
 
-bool DatumP::operator!=(DatumP *other) { return d != other->d; }
+bool DatumP::operator!=(DatumP *other) const { return d != other->d; }
 
-bool DatumP::operator!=(const DatumP &other) { return d != other.d; }
+bool DatumP::operator!=(const DatumP &other) const { return d != other.d; }
 
 // This is true IFF EQUALP is true
-bool DatumP::isEqual(DatumP other, bool ignoreCase) {
+bool DatumP::isEqual(const DatumP &other, bool ignoreCase) const {
   if (d->isa() != other.isa())
     return false;
   if (d == other.d)
@@ -99,72 +142,24 @@ bool DatumP::isEqual(DatumP other, bool ignoreCase) {
   return d->isEqual(other, ignoreCase);
 }
 
-bool DatumP::isDotEqual(DatumP other) { return (d == other.d); }
-
-bool DatumP::isASTNode() { return d->isa() == Datum::astnodeType; }
-
-bool DatumP::isList() { return d->isa() == Datum::listType; }
-
-bool DatumP::isArray() { return d->isa() == Datum::arrayType; }
-
-bool DatumP::isWord() { return d->isa() == Datum::wordType; }
+bool DatumP::isDotEqual(const DatumP &other) const { return (d == other.d); }
 
-bool DatumP::isError() { return d->isa() == Datum::errorType; }
-
-Word *DatumP::wordValue() {
-  Q_ASSERT(d->isa() == Datum::wordType);
-  return (Word *)d;
-}
-
-List *DatumP::listValue() {
-  if (d->isa() != Datum::listType) {
-    qDebug() << "Hello";
-  }
-  Q_ASSERT(d->isa() == Datum::listType);
-  return (List *)d;
-}
-
-ListNode *DatumP::listNodeValue() {
-  if (d->isa() != Datum::listNodeType) {
-    qDebug() << "Hello";
-  }
-  Q_ASSERT(d->isa() == Datum::listNodeType);
-  return (ListNode *)d;
-}
-
-Array *DatumP::arrayValue() {
-  Q_ASSERT(d->isa() == Datum::arrayType);
-  return (Array *)d;
-}
-
-Procedure *DatumP::procedureValue() {
-  if (d->isa() != Datum::procedureType) {
-    qDebug() << "Hello";
-  }
+Procedure *DatumP::procedureValue() const {
   Q_ASSERT(d->isa() == Datum::procedureType);
   return (Procedure *)d;
 }
 
-ASTNode *DatumP::astnodeValue() {
-  if (d->isa() != Datum::astnodeType) {
-    qDebug() << "Error here";
-  }
-  return (ASTNode *)d;
-}
-
-Error *DatumP::errorValue() {
+Error *DatumP::errorValue() const {
   Q_ASSERT(d->isa() == Datum::errorType);
   return (Error *)d;
 }
 
-Datum::DatumType DatumP::isa() { return d->isa(); }
-
 QString DatumP::printValue(bool fullPrintp, int printDepthLimit,
-                           int printWidthLimit) {
+                           int printWidthLimit) const {
   return d->printValue(fullPrintp, printDepthLimit, printWidthLimit);
 }
 
 QString DatumP::showValue(bool fullPrintp, int printDepthLimit,
-                          int printWidthLimit) {
+                          int printWidthLimit) const {
   return d->showValue(fullPrintp, printDepthLimit, printWidthLimit);
 }
@@ -50,15 +50,20 @@ bool Iterator::elementExists() {
  *
  ******************************************/
 
-ListIterator::ListIterator() {}
+ListIterator::ListIterator() { index = 0; }
 
-ListIterator::ListIterator(DatumP head) {
-    ptr = head;
-}
+ListIterator::ListIterator(DatumP head, int anIndex)
+    : ptr(std::move(head)), index(anIndex) {}
 
 DatumP ListIterator::element() {
-    DatumP retval = ptr.listNodeValue()->item;
-    ptr = ptr.listNodeValue()->next;
+    ListNode *node = ptr.listNodeValue();
+    DatumP retval = node->items[index];
+    ListNode *nextNode = node;
+    ListNode::advance(nextNode, index);
+    if (nextNode == NULL)
+      ptr = nothing;
+    else if (nextNode != node)
+      ptr = DatumP(nextNode);
     return retval;
 }
 
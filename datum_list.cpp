@@ -22,51 +22,187 @@
 /// \file
 /// This file contains the implementation of the List class, which is the general
 /// container of sequence data. A list may contain words, lists or arrays.
-/// Is is implemented by using a linked list.
+/// Is is implemented by using a linked list of ListNodes, each of which holds
+/// several items.
 ///
 //===----------------------------------------------------------------------===//
 
 #include "datum.h"
 #include <qdebug.h>
 
-QList<void *> listVisited;
-QList<void *> otherListVisited;
+static VisitedPath listVisited;
+static VisitedPath otherListVisited;
 
 
+ListNode::ListNode(DatumP *someItems, int aCapacity, size_t aSize)
+    : items(someItems), capacity(aCapacity) {
+  setDatumType(listNodeType, aSize);
+  begin = 0;
+  end = 0;
+  nextIndex = 0;
+  splicedItems = 0;
+  splices = NULL;
+}
+
+ListNode::~ListNode() { delete splices; }
+
+void ListNode::advance(ListNode *&aNode, int &aIndex) {
+  if (aNode->splicedItems & (1 << aIndex)) {
+    for (auto &splice : *aNode->splices) {
+      if (splice.index == aIndex) {
+        aIndex = splice.nodeIndex;
+        aNode = (splice.node == nothing) ? NULL : splice.node.listNodeValue();
+        return;
+      }
+    }
+  }
+  if (aIndex + 1 < aNode->end) {
+    ++aIndex;
+    return;
+  }
+  aIndex = aNode->nextIndex;
+  aNode = (aNode->next == nothing) ? NULL : aNode->next.listNodeValue();
+}
+
+void ListNode::linkAfter(int anIndex, DatumP aNode, int aNodeIndex) {
+  if (anIndex == end - 1) {
+    next = std::move(aNode);
+    nextIndex = aNodeIndex;
+    return;
+  }
+  if (splicedItems & (1 << anIndex)) {
+    for (auto &splice : *splices) {
+      if (splice.index == anIndex) {
+        splice.node = std::move(aNode);
+        splice.nodeIndex = aNodeIndex;
+        return;
+      }
+    }
+  }
+  if (splices == NULL)
+    splices = new QVector<Splice>;
+  splices->push_back({anIndex, std::move(aNode), aNodeIndex});
+  splicedItems |= (1 << anIndex);
+}
+
+void ListNode::appendChildren(QVector<Datum *> &aChildren) {
+  for (int i = begin; i < end; ++i) {
+    aChildren.push_back(items[i].datumValue());
+  }
+  aChildren.push_back(next.datumValue());
+  if (splices != NULL) {
+    for (auto &splice : *splices) {
+      aChildren.push_back(splice.node.datumValue());
+    }
+  }
+}
+
+void ListNode::clearChildren() {
+  for (int i = begin; i < end; ++i) {
+    items[i] = nothing;
+  }
+  next = nothing;
+  delete splices;
+  splices = NULL;
+  splicedItems = 0;
+}
+
+bool ListNode::isEndOfChain(int anIndex) {
+  return (anIndex == end - 1) && (next == nothing);
+}
+
+// Move aNode and aIndex forward by count items.
+static void skipItems(ListNode *&aNode, int &aIndex, int count) {
+  while (count > 0) {
+    if (aNode->splicedItems == 0) {
+      // Skip to the last item in this node in one step.
+      int available = aNode->end - 1 - aIndex;
+      if (count <= available) {
+        aIndex += count;
+        return;
+      }
+      aIndex += available;
+      count -= available;
+    }
+    ListNode::advance(aNode, aIndex);
+    --count;
+  }
+}
+
+quint64 List::structureGeneration = 0;
+
 List::List() {
-    astParseTimeStamp = 0;
-    listSize = 0;
+  setDatumType(listType, sizeof(List));
+  astParseGeneration = 0;
+  astBuildNumber = 0;
+  headIndex = 0;
+  lastIndex = 0;
+  listSize = 0;
+  shapeGeneration = structureGeneration;
+  cursorPosition = 0;
 }
 
 List::List(Array *source) {
-  astParseTimeStamp = 0;
-  listSize = source->size();
+  setDatumType(listType, sizeof(List));
+  astParseGeneration = 0;
+  astBuildNumber = 0;
+  headIndex = 0;
+  lastIndex = 0;
+  listSize = 0;
+  shapeGeneration = structureGeneration;
+  cursorPosition = 0;
   auto aryIter = source->newIterator();
-  DatumP prev;
-  if (aryIter.elementExists()) {
-      head = new ListNode;
-      lastNode = head;
-      head.listNodeValue()->item = aryIter.element();
-      prev = head;
-  }
   while (aryIter.elementExists()) {
-      lastNode = new ListNode;
-      prev.listNodeValue()->next = lastNode;
-      lastNode.listNodeValue()->item = aryIter.element();
-      prev = lastNode;
+    append(aryIter.element());
   }
 }
 
 List::~List() {}
 
 List::List(List *source) {
-  astParseTimeStamp = 0;
+  setDatumType(listType, sizeof(List));
+  astParseGeneration = 0;
+  astBuildNumber = 0;
+  source->updateShape();
   head = source->head;
+  headIndex = source->headIndex;
   lastNode = source->lastNode;
-  listSize = source->size();
+  lastIndex = source->lastIndex;
+  listSize = source->listSize;
+  shapeGeneration = source->shapeGeneration;
+  cursorPosition = 0;
 }
 
-Datum::DatumType List::isa() { return listType; }
+// A List is read to the end of its chain, which .SETBF on another List that
+// shares a node can lengthen or shorten. A .SETBF that makes the chain
+// circular leaves the old values.
+void List::countShape() {
+  shapeGeneration = structureGeneration;
+  if (head == nothing)
+    return;
+  ListNode *node = head.listNodeValue();
+  int index = headIndex;
+  ListNode *last = node;
+  int indexOfLast = index;
+  // Moves at half the speed of node, so node meets it if the chain is a
+  // circle.
+  ListNode *slowNode = node;
+  int slowIndex = index;
+  int count = 0;
+  while (node != NULL) {
+    last = node;
+    indexOfLast = index;
+    ++count;
+    ListNode::advance(node, index);
+    if ((count & 1) == 0)
+      ListNode::advance(slowNode, slowIndex);
+    if ((node == slowNode) && (index == slowIndex))
+      return;
+  }
+  lastNode = last;
+  lastIndex = indexOfLast;
+  listSize = count;
+}
 
 QString List::name() {
   static const QString retval("List");
@@ -75,25 +211,28 @@ QString List::name() {
 
 QString List::printValue(bool fullPrintp, int printDepthLimit,
                          int printWidthLimit) {
-  DatumP iter = head;
-  if (iter == nothing) {
+  if (head == nothing) {
     return "";
   }
   if ((printDepthLimit == 0) || (printWidthLimit == 0)) {
     return "...";
   }
   int printWidth = printWidthLimit - 1;
-  QString retval = iter.listNodeValue()->item.showValue(fullPrintp, printDepthLimit - 1, printWidthLimit);
-  while (iter.listNodeValue()->next != nothing) {
-      iter = iter.listNodeValue()->next;
+  ListNode *node = head.listNodeValue();
+  int index = headIndex;
+  QString retval = node->items[index].showValue(fullPrintp, printDepthLimit - 1,
+                                                printWidthLimit);
+  ListNode::advance(node, index);
+  while (node != NULL) {
     retval.append(QString(" "));
     if (printWidth == 0) {
       retval.append("...");
       break;
     }
-    retval.append(
-        iter.listNodeValue()->item.showValue(fullPrintp, printDepthLimit - 1, printWidthLimit));
+    retval.append(node->items[index].showValue(fullPrintp, printDepthLimit - 1,
+                                               printWidthLimit));
     --printWidth;
+    ListNode::advance(node, index);
   }
   return retval;
 }
@@ -101,88 +240,124 @@ QString List::printValue(bool fullPrintp, int printDepthLimit,
 QString List::showValue(bool fullPrintp, int printDepthLimit,
                         int printWidthLimit) {
   if (!listVisited.contains(this)) {
-    listVisited.push_back(this);
+    PathEntry entry(listVisited, this);
     QString retval = "[";
     retval.append(printValue(fullPrintp, printDepthLimit, printWidthLimit));
     retval.append("]");
-    listVisited.removeOne(this);
     return retval;
   }
   return "...";
 }
 
-bool List::isEqual(DatumP other, bool ignoreCase) {
-  ListIterator iter;
-  ListIterator otherIter;
+bool List::isEqual(const DatumP &other, bool ignoreCase) {
   List *o = other.listValue();
-  int myIndex = listVisited.indexOf(this);
-  int otherIndex = otherListVisited.indexOf(o);
-  if (myIndex != otherIndex)
-    goto exit_false;
+  int myDepth = listVisited.depthOf(this);
+  int otherDepth = otherListVisited.depthOf(o);
+  if (myDepth != otherDepth)
+    return false;
 
-  if (myIndex > -1)
+  if (myDepth > -1)
     return true;
 
   if (size() != o->size())
-    goto exit_false;
+    return false;
 
-  iter = newIterator();
-  otherIter = o->newIterator();
-  listVisited.push_back(this);
-  otherListVisited.push_back(o);
+  ListIterator iter = newIterator();
+  ListIterator otherIter = o->newIterator();
+  PathEntry entry(listVisited, this);
+  PathEntry otherEntry(otherListVisited, o);
 
-  while (iter.elementExists()) {
+  while (iter.elementExists() && otherIter.elementExists()) {
     DatumP value = iter.element();
     DatumP otherValue = otherIter.element();
     if (!value.isEqual(otherValue, ignoreCase))
-      goto exit_false;
+      return false;
   }
-
-  listVisited.pop_back();
-  otherListVisited.pop_back();
-  return true;
-
-exit_false:
-  listVisited.clear();
-  otherListVisited.clear();
-  return false;
+  return !iter.elementExists() && !otherIter.elementExists();
 }
 
 DatumP List::first() {
   Q_ASSERT(head != nothing);
-  return head.listNodeValue()->item;
+  return head.listNodeValue()->items[headIndex];
 }
 
 bool List::isIndexInRange(int anIndex) {
-    return (anIndex >= 1) && (anIndex <= listSize);
+    return (anIndex >= 1) && (anIndex <= size());
+}
+
+void List::seek(int anIndex, ListNode *&aNode, int &aIndex) {
+  if (anIndex == size()) {
+    aNode = lastNode.listNodeValue();
+    aIndex = lastIndex;
+    return;
+  }
+  int position;
+  if ((cursorPosition > 0) && (cursorPosition <= anIndex) &&
+      (cursorGeneration == structureGeneration)) {
+    aNode = cursorNode.listNodeValue();
+    aIndex = cursorIndex;
+    position = cursorPosition;
+  } else {
+    aNode = head.listNodeValue();
+    aIndex = headIndex;
+    position = 1;
+  }
+  skipItems(aNode, aIndex, anIndex - position);
+  cursorNode = aNode;
+  cursorIndex = aIndex;
+  cursorPosition = anIndex;
+  cursorGeneration = structureGeneration;
 }
 
 void List::setItem(int anIndex, DatumP aValue) {
-    DatumP ptr = head;
-    while (anIndex > 1) {
-        --anIndex;
-        ptr = ptr.listNodeValue()->next;
-    }
-  ptr.listNodeValue()->item = aValue;
-  astParseTimeStamp = 0;
+  ListNode *node;
+  int index;
+  seek(anIndex, node, index);
+  if (aValue.isList() || aValue.isArray())
+    addCycleCandidate(node);
+  node->items[index] = std::move(aValue);
+  astParseGeneration = 0;
 }
 
 void List::setButfirstItem(DatumP aValue) {
   Q_ASSERT(head != nothing);
   Q_ASSERT(aValue.isList());
-    head.listNodeValue()->next = aValue.listValue()->head;
-    astParseTimeStamp = 0;
-    listSize = aValue.listValue()->size() + 1;
+  List *source = aValue.listValue();
+  source->updateShape();
+  head.listNodeValue()->linkAfter(headIndex, source->head, source->headIndex);
+  addCycleCandidate(head.datumValue());
+  invalidateCursor();
+  if (source->head == nothing) {
+    lastNode = head;
+    lastIndex = headIndex;
+  } else {
+    lastNode = source->lastNode;
+    lastIndex = source->lastIndex;
+  }
+  astParseGeneration = 0;
+  listSize = source->listSize + 1;
+  ++structureGeneration;
+  shapeGeneration = structureGeneration;
 }
 
 void List::setFirstItem(DatumP aValue) {
-    Q_ASSERT(head != nothing);
-    head.listNodeValue()->item = aValue;
-  astParseTimeStamp = 0;
+  Q_ASSERT(head != nothing);
+  if (aValue.isList() || aValue.isArray())
+    addCycleCandidate(head.datumValue());
+  head.listNodeValue()->items[headIndex] = std::move(aValue);
+  astParseGeneration = 0;
 }
 
+void List::appendChildren(QVector<Datum *> &aChildren) {
+  aChildren.push_back(head.datumValue());
+  aChildren.push_back(lastNode.datumValue());
+  aChildren.push_back(cursorNode.datumValue());
+}
+
+void List::clearChildren() { clear(); }
+
 // TODO: Check for cyclic list structures.
-bool List::containsDatum(DatumP aDatum, bool ignoreCase) {
+bool List::containsDatum(const DatumP &aDatum, bool ignoreCase) {
     ListIterator iter = newIterator();
     while (iter.elementExists()) {
         DatumP e = iter.element();
@@ -194,127 +369,210 @@ bool List::containsDatum(DatumP aDatum, bool ignoreCase) {
   return false;
 }
 
-bool List::isMember(DatumP aDatum, bool ignoreCase) {
-    ListIterator iter = newIterator();
-    while (iter.elementExists()) {
-        if (aDatum.isEqual(iter.element(), ignoreCase))
-            return true;
-    }
+bool List::isMember(const DatumP &aDatum, bool ignoreCase) {
+  if (head == nothing)
+    return false;
+  ListNode *node = head.listNodeValue();
+  int index = headIndex;
+  while (node != NULL) {
+    if (aDatum.isEqual(node->items[index], ignoreCase))
+      return true;
+    ListNode::advance(node, index);
+  }
   return false;
 }
 
-DatumP List::fromMember(DatumP aDatum, bool ignoreCase) {
+DatumP List::fromMember(const DatumP &aDatum, bool ignoreCase) {
   List *retval = new List;
-  DatumP ptr = head;
-  while (ptr != nothing) {
-      DatumP e = ptr.listNodeValue()->item;
-      if (e.isEqual(aDatum, ignoreCase)) {
-          retval->head = ptr;
-          retval->lastNode = lastNode;
-          break;
-      }
-      ptr = ptr.listNodeValue()->next;
+  if (head == nothing)
+    return DatumP(retval);
+  ListNode *node = head.listNodeValue();
+  int index = headIndex;
+  while ((node != NULL) && !node->items[index].isEqual(aDatum, ignoreCase))
+    ListNode::advance(node, index);
+  if (node != NULL) {
+    retval->head = node;
+    retval->headIndex = index;
+    retval->forgetShape();
   }
-  retval->setListSize();
   return DatumP(retval);
 }
 
 DatumP List::datumAtIndex(int anIndex) {
   Q_ASSERT(isIndexInRange(anIndex));
-    DatumP ptr = head;
-    while (anIndex > 1) {
-        --anIndex;
-        ptr = ptr.listNodeValue()->next;
-    }
-  return ptr.listNodeValue()->item;
+  ListNode *node;
+  int index;
+  seek(anIndex, node, index);
+  return node->items[index];
 }
 
 DatumP List::butfirst() {
-    Q_ASSERT(head != nothing);
+  Q_ASSERT(head != nothing);
   List *retval = new List;
-    retval->head = head.listNodeValue()->next;
-    retval->listSize = listSize - 1;
+  ListNode *node = head.listNodeValue();
+  int index = headIndex;
+  ListNode::advance(node, index);
+  if (node != NULL) {
+    updateShape();
+    retval->head = node;
+    retval->headIndex = index;
     retval->lastNode = lastNode;
+    retval->lastIndex = lastIndex;
+    retval->listSize = listSize - 1;
+    retval->shapeGeneration = shapeGeneration;
+  }
   return DatumP(retval);
 }
 
 void List::clear() {
   head = nothing;
+  headIndex = 0;
   lastNode = nothing;
+  lastIndex = 0;
   listSize = 0;
+  shapeGeneration = structureGeneration;
+  cursorNode = nothing;
+  invalidateCursor();
   astList.clear();
-  astParseTimeStamp = 0;
+  astDependencies.clear();
+  bytecode.clear();
+  bytecodeTags.clear();
+  bytecodeInlinedLists.clear();
+  astParseGeneration = 0;
+}
+
+void List::appendAfterLast(DatumP element) {
+  updateShape();
+  ++listSize;
+  if (head == nothing) {
+    ListNode *newNode = new FullListNode;
+    newNode->items[0] = std::move(element);
+    newNode->end = 1;
+    head = newNode;
+    headIndex = 0;
+    lastNode = head;
+    lastIndex = 0;
+    return;
+  }
+
+  // Use the next free slot of the last node, if there is one.
+  ListNode *last = lastNode.listNodeValue();
+  if (last->isEndOfChain(lastIndex) && (last->end < last->capacity)) {
+    last->items[last->end] = std::move(element);
+    lastIndex = last->end;
+    ++last->end;
+    return;
+  }
+
+  ListNode *newNode = new FullListNode;
+  newNode->items[0] = std::move(element);
+  newNode->end = 1;
+  DatumP newNodeP(newNode);
+  last->linkAfter(lastIndex, newNodeP, 0);
+  lastNode = newNodeP;
+  lastIndex = 0;
 }
 
 // This should NOT be used in cases where a list may be shared
 void List::append(DatumP element) {
-    ListNode *newNode = new ListNode;
-    ++listSize;
-    newNode->item = element;
-    if (head == nothing) {
-        head = newNode;
-        lastNode = newNode;
-        return;
-    }
-    lastNode.listNodeValue()->next = newNode;
-    lastNode = newNode;
-  astParseTimeStamp = 0;
+  astParseGeneration = 0;
+  appendAfterLast(std::move(element));
+}
+
+// LPUT and BUTLAST copy their input. Sharing its nodes would let .SETFIRST,
+// .SETITEM, and .SETBF on either List change the other, and a List that ends
+// before the end of its chain can't be told apart from one that .SETBF has
+// extended.
+DatumP List::lput(DatumP item) {
+  List *retval = new List;
+  ListIterator iter = newIterator();
+  while (iter.elementExists()) {
+    retval->appendAfterLast(iter.element());
+  }
+  retval->appendAfterLast(std::move(item));
+  return DatumP(retval);
 }
 
 DatumP List::last() {
-    Q_ASSERT(lastNode != nothing);
-    return lastNode.listNodeValue()->item;
+  updateShape();
+  Q_ASSERT(lastNode != nothing);
+  return lastNode.listNodeValue()->items[lastIndex];
 }
 
 DatumP List::butlast() {
   List *retval = new List;
-  retval->listSize = listSize - 1;
-  if (head.listNodeValue()->next != nothing) {
-      DatumP src = head;
-      while (src.listNodeValue()->next != nothing) {
-          ListNode *newnode = new ListNode;
-          newnode->item = src.listNodeValue()->item;
-          if (retval->head == nothing) {
-              retval->head = newnode;
-              retval->lastNode = newnode;
-          } else {
-            retval->lastNode.listNodeValue()->next = newnode;
-            retval->lastNode = newnode;
-          }
-          src = src.listNodeValue()->next;
-      }
+  ListIterator iter = newIterator();
+  while (iter.elementExists()) {
+    DatumP element = iter.element();
+    if (!iter.elementExists())
+      break;
+    retval->appendAfterLast(element);
   }
   return DatumP(retval);
 }
 
+// Put element in front of the item at aIndex of aNode. Claims the free slot
+// before it if there is one. Otherwise a new node is created, filled from
+// its end so that later FPUTs can claim the slots below it. Nothing can be put
+// in front of an item that isn't the first in its node, so that gets a node
+// with a single slot.
+static void insertBefore(DatumP &aNode, int &aIndex, DatumP element) {
+  bool canExtend = true;
+  if (aNode != nothing) {
+    ListNode *node = aNode.listNodeValue();
+    if ((aIndex == node->begin) && (node->begin > 0)) {
+      --node->begin;
+      node->items[node->begin] = std::move(element);
+      aIndex = node->begin;
+      return;
+    }
+    canExtend = (aIndex == node->begin);
+  }
+  ListNode *newNode;
+  if (canExtend)
+    newNode = new FullListNode;
+  else
+    newNode = new SmallListNode;
+  newNode->begin = newNode->capacity - 1;
+  newNode->end = newNode->capacity;
+  newNode->items[newNode->begin] = std::move(element);
+  newNode->next = aNode;
+  newNode->nextIndex = aIndex;
+  aNode = newNode;
+  aIndex = newNode->begin;
+}
+
 void List::prepend(DatumP element) {
-    ListNode *newnode = new ListNode;
-    newnode->item = element;
-    newnode->next = head;
-    head = newnode;
-    ++listSize;
-  astParseTimeStamp = 0;
+  updateShape();
+  insertBefore(head, headIndex, std::move(element));
+  if (lastNode == nothing) {
+    lastNode = head;
+    lastIndex = headIndex;
+  }
+  ++listSize;
+  invalidateCursor();
+  astParseGeneration = 0;
 }
 
 DatumP List::fput(DatumP item)
 {
-    ListNode *newnode = new ListNode;
-    List *retval = new List;
-    newnode->item = item;
-    newnode->next = head;
-    retval->head = newnode;
-    retval->listSize = listSize + 1;
-    return retval;
+  updateShape();
+  List *retval = new List;
+  retval->head = head;
+  retval->headIndex = headIndex;
+  insertBefore(retval->head, retval->headIndex, std::move(item));
+  if (lastNode == nothing) {
+    retval->lastNode = retval->head;
+    retval->lastIndex = retval->headIndex;
+  } else {
+    retval->lastNode = lastNode;
+    retval->lastIndex = lastIndex;
+  }
+  retval->listSize = listSize + 1;
+  retval->shapeGeneration = shapeGeneration;
+  return retval;
 }
 
-void List::setListSize()
-{
-    listSize = 0;
-    DatumP ptr = head;
-    while (ptr != nothing) {
-        ++listSize;
-        ptr = ptr.listNodeValue()->next;
-    }
+ListIterator List::newIterator() {
+  return ListIterator(head, headIndex);
 }
-
-ListIterator List::newIterator() { return ListIterator(head); }
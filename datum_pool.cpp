@@ -0,0 +1,117 @@
+//===-- qlogo/datum_pool.cpp - DatumPool class implementation -------*- C++ -*-===//
+//
+// This file is part of QLogo.
+//
+// QLogo is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 2 of the License, or
+// (at your option) any later version.
+//
+// QLogo is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with QLogo.  If not, see <http://www.gnu.org/licenses/>.
+//
+//===----------------------------------------------------------------------===//
+///
+/// \file
+/// This file contains the implementation of the DatumPool class, the
+/// allocator used by the Datum subclasses.
+///
+//===----------------------------------------------------------------------===//
+
+#include "datum.h"
+
+#include <cstddef>
+#include <new>
+
+// The approximate size of each slab, in bytes.
+const size_t slabSize = 64 * 1024;
+
+// A free block holds a pointer to the next free block.
+struct FreeBlock {
+  FreeBlock *next;
+};
+
+// The free list and statistics of a pool.
+struct PoolState {
+  FreeBlock *freeList;
+  int blocksInUse;
+  int maxBlocksInUse;
+  int blocksAllocated;
+};
+
+static PoolState poolStates[DatumPool::countOfPools];
+
+// Round a block size up so that every block is suitably aligned.
+static constexpr size_t alignedSize(size_t size) {
+  return (size + alignof(std::max_align_t) - 1) &
+         ~(alignof(std::max_align_t) - 1);
+}
+
+static DatumPool pools[DatumPool::countOfPools] = {
+    DatumPool(DatumPool::wordPool, "word", alignedSize(sizeof(Word))),
+    DatumPool(DatumPool::listPool, "list", alignedSize(sizeof(List))),
+    DatumPool(DatumPool::listNodePool, "listnode",
+              alignedSize(sizeof(FullListNode))),
+    DatumPool(DatumPool::smallListNodePool, "smalllistnode",
+              alignedSize(sizeof(SmallListNode))),
+    DatumPool(DatumPool::arrayPool, "array", alignedSize(sizeof(Array))),
+    DatumPool(DatumPool::astnodePool, "astnode", alignedSize(sizeof(ASTNode))),
+};
+
+DatumPool &datumPool(DatumPool::PoolId aId) { return pools[aId]; }
+
+void *DatumPool::allocate(size_t aSize) {
+  if (aSize > blockSize)
+    return ::operator new(aSize);
+
+  PoolState &state = poolStates[id];
+  if (state.freeList == NULL) {
+    // Carve a new slab into blocks and put them all on the free list.
+    size_t count = slabSize / blockSize;
+    char *slab = static_cast<char *>(::operator new(count * blockSize));
+    for (size_t i = count; i > 0; --i) {
+      FreeBlock *block =
+          reinterpret_cast<FreeBlock *>(slab + (i - 1) * blockSize);
+      block->next = state.freeList;
+      state.freeList = block;
+    }
+    state.blocksAllocated += count;
+  }
+
+  FreeBlock *retval = state.freeList;
+  state.freeList = retval->next;
+  ++state.blocksInUse;
+  if (state.blocksInUse > state.maxBlocksInUse)
+    state.maxBlocksInUse = state.blocksInUse;
+  return retval;
+}
+
+void DatumPool::deallocate(void *aBlock, size_t aSize) {
+  if (aSize > blockSize) {
+    ::operator delete(aBlock);
+    return;
+  }
+
+  PoolState &state = poolStates[id];
+  FreeBlock *block = static_cast<FreeBlock *>(aBlock);
+  block->next = state.freeList;
+  state.freeList = block;
+  --state.blocksInUse;
+}
+
+int DatumPool::countOfBlocksInUse() { return poolStates[id].blocksInUse; }
+
+int DatumPool::maxCountOfBlocksInUse() { return poolStates[id].maxBlocksInUse; }
+
+void DatumPool::resetMaxBlocksInUse() {
+  poolStates[id].maxBlocksInUse = poolStates[id].blocksInUse;
+}
+
+int DatumPool::countOfBlocksAllocated() {
+  return poolStates[id].blocksAllocated;
+}
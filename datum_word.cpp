@@ -27,6 +27,28 @@
 
 #include "datum.h"
 #include <qdebug.h>
+#include <cmath>
+
+static QHash<QString, Symbol> symbolTable;
+static QVector<QString> symbolKeys;
+
+Symbol symbolForKey(const QString &key) {
+  auto result = symbolTable.find(key);
+  if (result != symbolTable.end())
+    return *result;
+  Symbol retval = symbolKeys.size();
+  symbolKeys.push_back(key);
+  symbolTable.insert(key, retval);
+  return retval;
+}
+
+Symbol findSymbol(const QString &key) {
+  return symbolTable.value(key, noSymbol);
+}
+
+const QString &keyForSymbol(Symbol aSymbol) { return symbolKeys[aSymbol]; }
+
+int countOfSymbols() { return symbolKeys.size(); }
 
 QChar rawToChar(const QChar &src) {
   const ushort rawToAsciiMap[] = {
@@ -67,9 +89,115 @@ QChar charToRaw(const QChar &src) {
   return src;
 }
 
-Word::Word() { dirtyFlag = stringIsDirty; }
+// The powers of ten that can be represented exactly as doubles.
+static const double exactPowersOfTen[] = {
+    1e0,  1e1,  1e2,  1e3,  1e4,  1e5,  1e6,  1e7,  1e8,  1e9,  1e10, 1e11,
+    1e12, 1e13, 1e14, 1e15, 1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22};
+const int maxExactPowerOfTen = 22;
+
+// Integers below 10^15 are exact and format the same with or without the
+// integer shortcut.
+const int maxFastDigits = 15;
+
+bool parseNumber(const QString &aString, double &aNumber) {
+  const QChar *c = aString.constData();
+  const QChar *end = c + aString.size();
+  bool isNegative = false;
+  if ((c != end) && ((*c == '-') || (*c == '+'))) {
+    isNegative = (*c == '-');
+    ++c;
+  }
+
+  // Collect the significant digits as an integer, and the power of ten to
+  // scale it by.
+  qint64 mantissa = 0;
+  int countOfDigits = 0;
+  int exponent = 0;
+  bool hasDigit = false;
+  for (; (c != end) && (c->unicode() >= '0') && (c->unicode() <= '9'); ++c) {
+    hasDigit = true;
+    if ((mantissa == 0) && (*c == '0'))
+      continue;
+    if (countOfDigits < maxFastDigits + 1)
+      mantissa = mantissa * 10 + (c->unicode() - '0');
+    ++countOfDigits;
+  }
+  if ((c != end) && (*c == '.')) {
+    ++c;
+    for (; (c != end) && (c->unicode() >= '0') && (c->unicode() <= '9');
+         ++c) {
+      hasDigit = true;
+      --exponent;
+      if ((mantissa == 0) && (*c == '0'))
+        continue;
+      if (countOfDigits < maxFastDigits + 1)
+        mantissa = mantissa * 10 + (c->unicode() - '0');
+      ++countOfDigits;
+    }
+  }
+  if (hasDigit && (c != end) && ((*c == 'e') || (*c == 'E'))) {
+    ++c;
+    bool isExponentNegative = false;
+    if ((c != end) && ((*c == '-') || (*c == '+'))) {
+      isExponentNegative = (*c == '-');
+      ++c;
+    }
+    int explicitExponent = 0;
+    bool hasExponentDigit = false;
+    for (; (c != end) && (c->unicode() >= '0') && (c->unicode() <= '9') &&
+           (explicitExponent < 1000);
+         ++c) {
+      hasExponentDigit = true;
+      explicitExponent = explicitExponent * 10 + (c->unicode() - '0');
+    }
+    if (!hasExponentDigit)
+      hasDigit = false;
+    exponent += isExponentNegative ? -explicitExponent : explicitExponent;
+  }
+
+  if (hasDigit && (c == end) && (countOfDigits <= maxFastDigits) &&
+      (exponent >= -maxExactPowerOfTen) && (exponent <= maxExactPowerOfTen)) {
+    // Both the mantissa and the power of ten are exact, so a single operation
+    // gives the correctly rounded result.
+    double value = (double)mantissa;
+    if (exponent < 0)
+      value /= exactPowersOfTen[-exponent];
+    else
+      value *= exactPowersOfTen[exponent];
+    aNumber = isNegative ? -value : value;
+    return true;
+  }
+
+  bool retval;
+  aNumber = aString.toDouble(&retval);
+  return retval;
+}
+
+QString formatNumber(double aNumber) {
+  if ((aNumber == std::trunc(aNumber)) && (std::fabs(aNumber) < 1e15) &&
+      !((aNumber == 0) && std::signbit(aNumber))) {
+    return QString::number((qint64)aNumber);
+  }
+  if (!std::isfinite(aNumber))
+    return QString::number(aNumber);
+
+  // Seventeen significant digits are always enough to preserve a double.
+  QString retval;
+  for (int precision = maxFastDigits; precision <= 17; ++precision) {
+    retval = QString::number(aNumber, 'g', precision);
+    if (retval.toDouble() == aNumber)
+      break;
+  }
+  return retval;
+}
+
+Word::Word() {
+  setDatumType(wordType, sizeof(Word));
+  dirtyFlag = stringIsDirty;
+}
 
 Word::Word(const QString other, bool aIsForeverSpecial, bool canBeDestroyed) {
+  setDatumType(wordType, sizeof(Word));
   dirtyFlag = stringIsDirty;
   isForeverSpecial = aIsForeverSpecial;
   isDestroyable = canBeDestroyed;
@@ -85,12 +213,11 @@ Word::Word(const QString other, bool aIsForeverSpecial, bool canBeDestroyed) {
 }
 
 Word::Word(double other) {
+  setDatumType(wordType, sizeof(Word));
   number = other;
   dirtyFlag = numberIsDirty;
 }
 
-Datum::DatumType Word::isa() { return wordType; }
-
 QString Word::name() {
   static QString retval("Word");
   return retval;
@@ -113,9 +240,21 @@ QString Word::keyValue() {
   return keyString;
 }
 
+Symbol Word::symbolValue() {
+  if (keySymbol == noSymbol)
+    keySymbol = symbolForKey(keyValue());
+  return keySymbol;
+}
+
+Symbol Word::existingSymbolValue() {
+  if (keySymbol == noSymbol)
+    keySymbol = findSymbol(keyValue());
+  return keySymbol;
+}
+
 QString Word::rawValue() {
   if (dirtyFlag == numberIsDirty) {
-    rawString.setNum(number);
+    rawString = formatNumber(number);
     printableString = rawString;
     dirtyFlag = allClean;
   }
@@ -123,10 +262,12 @@ QString Word::rawValue() {
 }
 
 double Word::numberValue() {
-  if (dirtyFlag == stringIsDirty) {
-    number = printableString.toDouble(&numberConversionSucceeded);
+  if ((dirtyFlag == stringIsDirty) && !isKnownNotANumber) {
+    numberConversionSucceeded = parseNumber(printableString, number);
     if (numberConversionSucceeded)
       dirtyFlag = allClean;
+    else
+      isKnownNotANumber = true;
   }
   return number;
 }
@@ -192,7 +333,7 @@ int Word::size() {
   return rawString.size();
 }
 
-bool Word::isEqual(DatumP other, bool ignoreCase) {
+bool Word::isEqual(const DatumP &other, bool ignoreCase) {
   if (dirtyFlag != stringIsDirty) {
     bool answer = (number == other.wordValue()->numberValue());
     if (!other.wordValue()->didNumberConversionSucceed())
@@ -223,7 +364,7 @@ DatumP Word::datumAtIndex(int anIndex) {
   return DatumP(new Word(rawString.mid(anIndex, 1)));
 }
 
-bool Word::containsDatum(DatumP aDatum, bool ignoreCase) {
+bool Word::containsDatum(const DatumP &aDatum, bool ignoreCase) {
   if (!aDatum.isWord())
     return false;
   rawValue();
@@ -231,11 +372,11 @@ bool Word::containsDatum(DatumP aDatum, bool ignoreCase) {
   return rawString.contains(aDatum.wordValue()->rawValue(), cs);
 }
 
-bool Word::isMember(DatumP aDatum, bool ignoreCase) {
+bool Word::isMember(const DatumP &aDatum, bool ignoreCase) {
   return containsDatum(aDatum, ignoreCase);
 }
 
-DatumP Word::fromMember(DatumP aDatum, bool ignoreCase) {
+DatumP Word::fromMember(const DatumP &aDatum, bool ignoreCase) {
   rawValue();
   Qt::CaseSensitivity cs = ignoreCase ? Qt::CaseInsensitive : Qt::CaseSensitive;
   const QString &searchString = aDatum.wordValue()->rawValue();
@@ -31,11 +31,13 @@
 Kernel *mainKernel;
 
 Error::Error(Error::errorCode aNumber, const QString &aErrorText) {
+  setDatumType(errorType, sizeof(Error));
   code = aNumber;
   errorText = DatumP(new Word(aErrorText));
 }
 
 Error::Error(Error::errorCode aNumber, DatumP aErrorText) {
+  setDatumType(errorType, sizeof(Error));
   code = aNumber;
   errorText = aErrorText;
 }
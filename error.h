@@ -101,8 +101,6 @@ public:
   DatumP procedure;
   DatumP instructionLine; // The Word/List where the error occurred.
 
-  DatumType isa() { return errorType; }
-
   static void setKernel(Kernel *aKernel);
 
   // Throwers for all the error messages
@@ -28,32 +28,34 @@
 #include <QHash>
 #include <QStringList>
 
-QHash<QString, DatumP> rsrc;
+// The help text is kept in read-only tables of string literals. A Word is only
+// made for a keyword when its help is asked for.
+struct HelpEntry {
+  const char *name;
+  // The help text, or NULL if this name shares the text of aliasOf.
+  const char *text;
+  const char *aliasOf;
+};
 
-Help::Help() {
-  if (rsrc.size() == 0)
-    initRsrc();
-}
+// Maps each keyword to its help text. Built the first time help is needed.
+static QHash<QString, const char *> helpIndex;
 
-void Help::set(const QString &name, const QString &text) {
-  DatumP textP(new Word(text));
-  rsrc[name] = textP;
-}
+static void buildHelpIndex();
 
-void Help::alt(const QString &newName, const QString &oldName) {
-  rsrc[newName] = rsrc[oldName];
-}
+Help::Help() {}
 
 DatumP Help::helpForKeyword(const QString &keyWord) {
-  if (rsrc.contains(keyWord)) {
-    return rsrc[keyWord];
-  }
-  return nothing;
+  buildHelpIndex();
+  const char *text = helpIndex.value(keyWord, NULL);
+  if (text == NULL)
+    return nothing;
+  return DatumP(new Word(QString::fromUtf8(text)));
 }
 
 DatumP Help::allKeywords() {
+  buildHelpIndex();
   List *retval = new List;
-  QStringList keys = rsrc.keys();
+  QStringList keys = helpIndex.keys();
   keys.sort();
   for (auto key : keys) {
     retval->append(DatumP(new Word(key)));
@@ -61,56 +63,47 @@ DatumP Help::allKeywords() {
   return DatumP(retval);
 }
 
-void Help::initRsrc() {
-  setDataStructurePrimitives();
-  setCommunication();
-  setArithmetic();
-  setGraphics();
-  setWorkspaceManagement();
-  setControlStructures();
-}
-
-void Help::setDataStructurePrimitives() {
+static const HelpEntry dataStructurePrimitivesHelp[] = {
   //    CONSTRUCTORS
   //    ------------
 
-  set("WORD", "WORD word1 word2\n"
-              "(WORD word1 word2 word3 ...)\n"
-              "\n"
-              "        outputs a word formed by concatenating its inputs.\n"
-              "\n");
+  {"WORD", "WORD word1 word2\n"
+           "(WORD word1 word2 word3 ...)\n"
+           "\n"
+           "        outputs a word formed by concatenating its inputs.\n"
+           "\n"},
 
-  set("LIST",
+  {"LIST",
       "LIST thing1 thing2\n"
       "(LIST thing1 thing2 thing3 ...)\n"
       "\n"
       "        outputs a list whose members are its inputs, which can be any\n"
       "        Logo datum (word, list, or array).\n"
-      "\n");
-
-  set("SENTENCE", "SENTENCE thing1 thing2\n"
-                  "SE thing1 thing2\n"
-                  "(SENTENCE thing1 thing2 thing3 ...)\n"
-                  "(SE thing1 thing2 thing3 ...)\n"
-                  "\n"
-                  "        outputs a list whose members are its inputs, if "
-                  "those inputs are\n"
-                  "        not lists, or the members of its inputs, if those "
-                  "inputs are lists.\n"
-                  "\n");
-
-  alt("SE", "SENTENCE");
+      "\n"},
 
-  set("FPUT", "FPUT thing list\n"
-              "\n"
-              "        outputs a list equal to its second input with one extra "
-              "member,\n"
-              "        the first input, at the beginning.  If the second input "
-              "is a word,\n"
-              "        then FPUT is equivalent to WORD.\n"
-              "\n");
-
-  set("LPUT",
+  {"SENTENCE", "SENTENCE thing1 thing2\n"
+               "SE thing1 thing2\n"
+               "(SENTENCE thing1 thing2 thing3 ...)\n"
+               "(SE thing1 thing2 thing3 ...)\n"
+               "\n"
+               "        outputs a list whose members are its inputs, if "
+               "those inputs are\n"
+               "        not lists, or the members of its inputs, if those "
+               "inputs are lists.\n"
+               "\n"},
+
+  {"SE", NULL, "SENTENCE"},
+
+  {"FPUT", "FPUT thing list\n"
+           "\n"
+           "        outputs a list equal to its second input with one extra "
+           "member,\n"
+           "        the first input, at the beginning.  If the second input "
+           "is a word,\n"
+           "        then FPUT is equivalent to WORD.\n"
+           "\n"},
+
+  {"LPUT",
       "LPUT thing list\n"
       "\n"
       "        outputs a list equal to its second input with one extra "
@@ -118,89 +111,89 @@ void Help::setDataStructurePrimitives() {
       "        the first input, at the end.  If the second input is a word,\n"
       "        then LPUT is equivalent to WORD with its inputs in the other "
       "order.\n"
-      "\n");
+      "\n"},
 
-  set("ARRAY", "ARRAY size\n"
-               "(ARRAY size origin)\n"
-               "\n"
-               "        outputs an array of \"size\" members (must be a "
-               "positive integer),\n"
-               "        each of which initially is an empty list.  Array "
-               "members can be\n"
-               "        selected with ITEM and changed with SETITEM.  The "
-               "first member of\n"
-               "        the array is member number 1 unless an \"origin\" "
-               "input (must be an\n"
-               "        integer) is given, in which case the first member of "
-               "the array has\n"
-               "        that number as its index.  (Typically 0 is used as the "
-               "origin if\n"
-               "        anything.)  Arrays are printed by PRINT and friends, "
-               "and can be\n"
-               "        typed in, inside curly braces; indicate an origin with "
-               "{a b c}@0.\n"
-               "\n");
-
-  set("MDARRAY", "MDARRAY sizelist                                        "
-                 "(library procedure)\n"
-                 "(MDARRAY sizelist origin)\n"
-                 "\n"
-                 "        outputs a multi-dimensional array.  The first input "
-                 "must be a list\n"
-                 "        of one or more positive integers.  The second input, "
-                 "if present,\n"
-                 "        must be a single integer that applies to every "
-                 "dimension of the array.\n"
-                 "        Ex: (MDARRAY [3 5] 0) outputs a two-dimensional "
-                 "array whose members\n"
-                 "        range from [0 0] to [2 4].\n"
-                 "\n");
-
-  set("LISTTOARRAY", "LISTTOARRAY list\n"
-                     "(LISTTOARRAY list origin)\n"
-                     "\n"
-                     "        outputs an array of the same size as the input "
-                     "list, whose members\n"
-                     "        are the members of the input list.\n"
-                     "\n");
-
-  set("ARRAYTOLIST", "ARRAYTOLIST array\n"
-                     "\n"
-                     "        outputs a list whose members are the members of "
-                     "the input array.\n"
-                     "        The first member of the output is the first "
-                     "member of the array,\n"
-                     "        regardless of the array's origin.\n"
-                     "\n");
-
-  set("COMBINE", "COMBINE thing1 thing2                                   "
-                 "(library procedure)\n"
-                 "\n"
-                 "        if thing2 is a word, outputs WORD thing1 thing2.  If "
-                 "thing2 is a list,\n"
-                 "        outputs FPUT thing1 thing2.\n"
-                 "\n");
+  {"ARRAY", "ARRAY size\n"
+            "(ARRAY size origin)\n"
+            "\n"
+            "        outputs an array of \"size\" members (must be a "
+            "positive integer),\n"
+            "        each of which initially is an empty list.  Array "
+            "members can be\n"
+            "        selected with ITEM and changed with SETITEM.  The "
+            "first member of\n"
+            "        the array is member number 1 unless an \"origin\" "
+            "input (must be an\n"
+            "        integer) is given, in which case the first member of "
+            "the array has\n"
+            "        that number as its index.  (Typically 0 is used as the "
+            "origin if\n"
+            "        anything.)  Arrays are printed by PRINT and friends, "
+            "and can be\n"
+            "        typed in, inside curly braces; indicate an origin with "
+            "{a b c}@0.\n"
+            "\n"},
+
+  {"MDARRAY", "MDARRAY sizelist                                        "
+              "(library procedure)\n"
+              "(MDARRAY sizelist origin)\n"
+              "\n"
+              "        outputs a multi-dimensional array.  The first input "
+              "must be a list\n"
+              "        of one or more positive integers.  The second input, "
+              "if present,\n"
+              "        must be a single integer that applies to every "
+              "dimension of the array.\n"
+              "        Ex: (MDARRAY [3 5] 0) outputs a two-dimensional "
+              "array whose members\n"
+              "        range from [0 0] to [2 4].\n"
+              "\n"},
+
+  {"LISTTOARRAY", "LISTTOARRAY list\n"
+                  "(LISTTOARRAY list origin)\n"
+                  "\n"
+                  "        outputs an array of the same size as the input "
+                  "list, whose members\n"
+                  "        are the members of the input list.\n"
+                  "\n"},
 
-  set("REVERSE", "REVERSE list                                            "
-                 "(library procedure)\n"
-                 "\n"
-                 "        outputs a list whose members are the members of the "
-                 "input list, in\n"
-                 "        reverse order.\n"
-                 "\n");
+  {"ARRAYTOLIST", "ARRAYTOLIST array\n"
+                  "\n"
+                  "        outputs a list whose members are the members of "
+                  "the input array.\n"
+                  "        The first member of the output is the first "
+                  "member of the array,\n"
+                  "        regardless of the array's origin.\n"
+                  "\n"},
+
+  {"COMBINE", "COMBINE thing1 thing2                                   "
+              "(library procedure)\n"
+              "\n"
+              "        if thing2 is a word, outputs WORD thing1 thing2.  If "
+              "thing2 is a list,\n"
+              "        outputs FPUT thing1 thing2.\n"
+              "\n"},
 
-  set("GENSYM", "GENSYM                                                  "
-                "(library procedure)\n"
-                "\n"
-                "        outputs a unique word each time it's invoked.  The "
-                "words are of the\n"
-                "        form G1, G2, etc.\n"
-                "\n");
+  {"REVERSE", "REVERSE list                                            "
+              "(library procedure)\n"
+              "\n"
+              "        outputs a list whose members are the members of the "
+              "input list, in\n"
+              "        reverse order.\n"
+              "\n"},
+
+  {"GENSYM", "GENSYM                                                  "
+             "(library procedure)\n"
+             "\n"
+             "        outputs a unique word each time it's invoked.  The "
+             "words are of the\n"
+             "        form G1, G2, etc.\n"
+             "\n"},
 
   //    SELECTORS
   //    ---------
 
-  set("FIRST",
+  {"FIRST",
       "FIRST thing\n"
       "\n"
       "        if the input is a word, outputs the first character of the "
@@ -209,87 +202,87 @@ void Help::setDataStructurePrimitives() {
       "        If the input is an array, outputs the origin of the array "
       "(that\n"
       "        is, the INDEX OF the first member of the array).\n"
-      "\n");
+      "\n"},
 
-  set("FIRSTS", "FIRSTS list\n"
-                "\n"
-                "        outputs a list containing the FIRST of each member of "
-                "the input\n"
-                "        list.  It is an error if any member of the input list "
-                "is empty.\n"
-                "        (The input itself may be empty, in which case the "
-                "output is also\n"
-                "        empty.)  This could be written as\n"
-                "\n"
-                "                to firsts :list\n"
-                "                output map \"first :list\n"
-                "                end\n"
-                "\n"
-                "        but is provided as a primitive in order to speed up "
-                "the iteration\n"
-                "        tools MAP, MAP.SE, and FOREACH.\n"
-                " \n"
-                "                to transpose :matrix\n"
-                "                if emptyp first :matrix [op []]\n"
-                "                op fput firsts :matrix transpose bfs :matrix\n"
-                "                end\n"
-                "\n");
-
-  set("LAST",
+  {"FIRSTS", "FIRSTS list\n"
+             "\n"
+             "        outputs a list containing the FIRST of each member of "
+             "the input\n"
+             "        list.  It is an error if any member of the input list "
+             "is empty.\n"
+             "        (The input itself may be empty, in which case the "
+             "output is also\n"
+             "        empty.)  This could be written as\n"
+             "\n"
+             "                to firsts :list\n"
+             "                output map \"first :list\n"
+             "                end\n"
+             "\n"
+             "        but is provided as a primitive in order to speed up "
+             "the iteration\n"
+             "        tools MAP, MAP.SE, and FOREACH.\n"
+             " \n"
+             "                to transpose :matrix\n"
+             "                if emptyp first :matrix [op []]\n"
+             "                op fput firsts :matrix transpose bfs :matrix\n"
+             "                end\n"
+             "\n"},
+
+  {"LAST",
       "LAST wordorlist\n"
       "\n"
       "        if the input is a word, outputs the last character of the "
       "word.\n"
       "        If the input is a list, outputs the last member of the list.\n"
-      "\n");
+      "\n"},
 
-  set("BUTFIRST", "BUTFIRST wordorlist\n"
-                  "BF wordorlist\n"
-                  "\n"
-                  "        if the input is a word, outputs a word containing "
-                  "all but the first\n"
-                  "        character of the input.  If the input is a list, "
-                  "outputs a list\n"
-                  "        containing all but the first member of the input.\n"
-                  "\n");
+  {"BUTFIRST", "BUTFIRST wordorlist\n"
+               "BF wordorlist\n"
+               "\n"
+               "        if the input is a word, outputs a word containing "
+               "all but the first\n"
+               "        character of the input.  If the input is a list, "
+               "outputs a list\n"
+               "        containing all but the first member of the input.\n"
+               "\n"},
 
-  alt("BF", "BUTFIRST");
+  {"BF", NULL, "BUTFIRST"},
 
-  set("BUTFIRSTS", "BUTFIRSTS list\n"
-                   "BFS list\n"
-                   "\n"
-                   "        outputs a list containing the BUTFIRST of each "
-                   "member of the input\n"
-                   "        list.  It is an error if any member of the input "
-                   "list is empty or an\n"
-                   "        array.  (The input itself may be empty, in which "
-                   "case the output is\n"
-                   "        also empty.)  This could be written as\n"
-                   "\n"
-                   "                to butfirsts :list\n"
-                   "                output map \"butfirst :list\n"
-                   "                end\n"
-                   "\n"
-                   "        but is provided as a primitive in order to speed "
-                   "up the iteration\n"
-                   "        tools MAP, MAP.SE, and FOREACH.\n"
-                   "\n");
+  {"BUTFIRSTS", "BUTFIRSTS list\n"
+                "BFS list\n"
+                "\n"
+                "        outputs a list containing the BUTFIRST of each "
+                "member of the input\n"
+                "        list.  It is an error if any member of the input "
+                "list is empty or an\n"
+                "        array.  (The input itself may be empty, in which "
+                "case the output is\n"
+                "        also empty.)  This could be written as\n"
+                "\n"
+                "                to butfirsts :list\n"
+                "                output map \"butfirst :list\n"
+                "                end\n"
+                "\n"
+                "        but is provided as a primitive in order to speed "
+                "up the iteration\n"
+                "        tools MAP, MAP.SE, and FOREACH.\n"
+                "\n"},
 
-  alt("BFS", "BUTFIRSTS");
+  {"BFS", NULL, "BUTFIRSTS"},
 
-  set("BUTLAST", "BUTLAST wordorlist\n"
-                 "BL wordorlist\n"
-                 "\n"
-                 "        if the input is a word, outputs a word containing "
-                 "all but the last\n"
-                 "        character of the input.  If the input is a list, "
-                 "outputs a list\n"
-                 "        containing all but the last member of the input.\n"
-                 "\n");
+  {"BUTLAST", "BUTLAST wordorlist\n"
+              "BL wordorlist\n"
+              "\n"
+              "        if the input is a word, outputs a word containing "
+              "all but the last\n"
+              "        character of the input.  If the input is a list, "
+              "outputs a list\n"
+              "        containing all but the last member of the input.\n"
+              "\n"},
 
-  alt("BL", "BUTLAST");
+  {"BL", NULL, "BUTLAST"},
 
-  set("ITEM",
+  {"ITEM",
       "ITEM index thing\n"
       "\n"
       "        if the \"thing\" is a word, outputs the \"index\"th character "
@@ -302,51 +295,51 @@ void Help::setDataStructurePrimitives() {
       "lists;\n"
       "        the starting index of an array is specified when the array is\n"
       "        created.\n"
-      "\n");
-
-  set("MDITEM", "MDITEM indexlist array                                  "
-                "(library procedure)\n"
-                "\n"
-                "        outputs the member of the multidimensional \"array\" "
-                "selected by\n"
-                "        the list of numbers \"indexlist\".\n"
-                "\n");
-
-  set("PICK", "PICK list                                               "
-              "(library procedure)\n"
-              "\n"
-              "        outputs a randomly chosen member of the input list.\n"
-              "\n");
+      "\n"},
 
-  set("REMOVE", "REMOVE thing list                                       "
-                "(library procedure)\n"
-                "\n"
-                "        outputs a copy of \"list\" with every member equal to "
-                "\"thing\" removed.\n"
-                "\n");
+  {"MDITEM", "MDITEM indexlist array                                  "
+             "(library procedure)\n"
+             "\n"
+             "        outputs the member of the multidimensional \"array\" "
+             "selected by\n"
+             "        the list of numbers \"indexlist\".\n"
+             "\n"},
+
+  {"PICK", "PICK list                                               "
+           "(library procedure)\n"
+           "\n"
+           "        outputs a randomly chosen member of the input list.\n"
+           "\n"},
+
+  {"REMOVE", "REMOVE thing list                                       "
+             "(library procedure)\n"
+             "\n"
+             "        outputs a copy of \"list\" with every member equal to "
+             "\"thing\" removed.\n"
+             "\n"},
 
-  set("REMDUP", "REMDUP list                                             "
-                "(library procedure)\n"
-                "\n"
-                "        outputs a copy of \"list\" with duplicate members "
-                "removed.  If two or\n"
-                "        more members of the input are equal, the rightmost of "
-                "those members\n"
-                "        is the one that remains in the output.\n"
-                "\n");
-
-  set("QUOTED", "QUOTED thing                                            "
-                "(library procedure)\n"
-                "\n"
-                "        outputs its input, if a list; outputs its input with "
-                "a quotation\n"
-                "        mark prepended, if a word.\n"
-                "\n");
+  {"REMDUP", "REMDUP list                                             "
+             "(library procedure)\n"
+             "\n"
+             "        outputs a copy of \"list\" with duplicate members "
+             "removed.  If two or\n"
+             "        more members of the input are equal, the rightmost of "
+             "those members\n"
+             "        is the one that remains in the output.\n"
+             "\n"},
+
+  {"QUOTED", "QUOTED thing                                            "
+             "(library procedure)\n"
+             "\n"
+             "        outputs its input, if a list; outputs its input with "
+             "a quotation\n"
+             "        mark prepended, if a word.\n"
+             "\n"},
 
   //    MUTATORS
   //    --------
 
-  set("SETITEM",
+  {"SETITEM",
       "SETITEM index array value\n"
       "\n"
       "        command.  Replaces the \"index\"th member of \"array\" with the "
@@ -354,17 +347,17 @@ void Help::setDataStructurePrimitives() {
       "        \"value\".  Ensures that the resulting array is not circular, "
       "i.e.,\n"
       "        \"value\" may not be a list or array that contains \"array\".\n"
-      "\n");
+      "\n"},
 
-  set("MDSETITEM", "MDSETITEM indexlist array value                         "
-                   "(library procedure)\n"
-                   "\n"
-                   "        command.  Replaces the member of \"array\" chosen "
-                   "by \"indexlist\"\n"
-                   "        with the new \"value\".\n"
-                   "\n");
+  {"MDSETITEM", "MDSETITEM indexlist array value                         "
+                "(library procedure)\n"
+                "\n"
+                "        command.  Replaces the member of \"array\" chosen "
+                "by \"indexlist\"\n"
+                "        with the new \"value\".\n"
+                "\n"},
 
-  set(".SETFIRST",
+  {".SETFIRST",
       ".SETFIRST list value\n"
       "\n"
       "        command.  Changes the first member of \"list\" to be "
@@ -378,9 +371,9 @@ void Help::setDataStructurePrimitives() {
       "primitives\n"
       "        into infinite loops, and to unexpected changes to other data\n"
       "        structures that share storage with the list being modified.\n"
-      "\n");
+      "\n"},
 
-  set(".SETBF",
+  {".SETBF",
       ".SETBF list value\n"
       "\n"
       "        command.  Changes the butfirst of \"list\" to be \"value\".\n"
@@ -396,9 +389,9 @@ void Help::setDataStructurePrimitives() {
       "        share storage with the list being modified; or to Logo crashes "
       "and\n"
       "        coredumps if the butfirst of a list is not itself a list.\n"
-      "\n");
+      "\n"},
 
-  set(".SETITEM",
+  {".SETITEM",
       ".SETITEM index array value\n"
       "\n"
       "        command.  Changes the \"index\"th member of \"array\" to be "
@@ -412,9 +405,9 @@ void Help::setDataStructurePrimitives() {
       "        can lead to circular arrays, which will get some Logo "
       "primitives into\n"
       "        infinite loops.\n"
-      "\n");
+      "\n"},
 
-  set("PUSH",
+  {"PUSH",
       "PUSH stackname thing                                    (library "
       "procedure)\n"
       "\n"
@@ -424,19 +417,19 @@ void Help::setDataStructurePrimitives() {
       "a list\n"
       "        as its value; the initial value should be the empty list.  New\n"
       "        members are added at the front of the list.\n"
-      "\n");
-
-  set("POP", "POP stackname                                           (library "
-             "procedure)\n"
-             "\n"
-             "        outputs the most recently PUSHed member of the stack "
-             "that is the\n"
-             "        value of the variable whose name is \"stackname\" and "
-             "removes that\n"
-             "        member from the stack.\n"
-             "\n");
-
-  set("QUEUE",
+      "\n"},
+
+  {"POP", "POP stackname                                           (library "
+          "procedure)\n"
+          "\n"
+          "        outputs the most recently PUSHed member of the stack "
+          "that is the\n"
+          "        value of the variable whose name is \"stackname\" and "
+          "removes that\n"
+          "        member from the stack.\n"
+          "\n"},
+
+  {"QUEUE",
       "QUEUE queuename thing                                   (library "
       "procedure)\n"
       "\n"
@@ -446,57 +439,57 @@ void Help::setDataStructurePrimitives() {
       "a list\n"
       "        as its value; the initial value should be the empty list.  New\n"
       "        members are added at the back of the list.\n"
-      "\n");
+      "\n"},
 
-  set("DEQUEUE", "DEQUEUE queuename                                       "
-                 "(library procedure)\n"
-                 "\n"
-                 "        outputs the least recently QUEUEd member of the "
-                 "queue that is the\n"
-                 "        value of the variable whose name is \"queuename\" "
-                 "and removes that\n"
-                 "        member from the queue.\n"
-                 "\n");
+  {"DEQUEUE", "DEQUEUE queuename                                       "
+              "(library procedure)\n"
+              "\n"
+              "        outputs the least recently QUEUEd member of the "
+              "queue that is the\n"
+              "        value of the variable whose name is \"queuename\" "
+              "and removes that\n"
+              "        member from the queue.\n"
+              "\n"},
 
   //    PREDICATES
   //    ----------
 
-  set("WORDP", "WORDP thing\n"
-               "WORD? thing\n"
-               "\n"
-               "        outputs TRUE if the input is a word, FALSE otherwise.\n"
-               "\n");
+  {"WORDP", "WORDP thing\n"
+            "WORD? thing\n"
+            "\n"
+            "        outputs TRUE if the input is a word, FALSE otherwise.\n"
+            "\n"},
 
-  alt("WORD?", "WORDP");
+  {"WORD?", NULL, "WORDP"},
 
-  set("LISTP", "LISTP thing\n"
-               "LIST? thing\n"
-               "\n"
-               "        outputs TRUE if the input is a list, FALSE otherwise.\n"
-               "\n");
+  {"LISTP", "LISTP thing\n"
+            "LIST? thing\n"
+            "\n"
+            "        outputs TRUE if the input is a list, FALSE otherwise.\n"
+            "\n"},
 
-  alt("LIST?", "LISTP");
+  {"LIST?", NULL, "LISTP"},
 
-  set("ARRAYP",
+  {"ARRAYP",
       "ARRAYP thing\n"
       "ARRAY? thing\n"
       "\n"
       "        outputs TRUE if the input is an array, FALSE otherwise.\n"
-      "\n");
+      "\n"},
 
-  alt("ARRAY?", "ARRAYP");
+  {"ARRAY?", NULL, "ARRAYP"},
 
-  set("EMPTYP",
+  {"EMPTYP",
       "EMPTYP thing\n"
       "EMPTY? thing\n"
       "\n"
       "        outputs TRUE if the input is the empty word or the empty list,\n"
       "        FALSE otherwise.\n"
-      "\n");
+      "\n"},
 
-  alt("EMPTY?", "EMPTYP");
+  {"EMPTY?", NULL, "EMPTYP"},
 
-  set("EQUALP",
+  {"EQUALP",
       "EQUALP thing1 thing2\n"
       "EQUAL? thing1 thing2\n"
       "thing1 = thing2\n"
@@ -524,12 +517,12 @@ void Help::setDataStructurePrimitives() {
       "        example, two variables have the same array as their values "
       "then\n"
       "        performing SETITEM on one of them will also change the other.)\n"
-      "\n");
+      "\n"},
 
-  alt("EQUAL?", "EQUALP");
-  alt("=", "EQUALP");
+  {"EQUAL?", NULL, "EQUALP"},
+  {"=", NULL, "EQUALP"},
 
-  set("NOTEQUALP",
+  {"NOTEQUALP",
       "NOTEQUALP thing1 thing2\n"
       "NOTEQUAL? thing1 thing2\n"
       "thing1 <> thing2\n"
@@ -537,43 +530,43 @@ void Help::setDataStructurePrimitives() {
       "        outputs FALSE if the inputs are equal, TRUE otherwise.  See "
       "EQUALP\n"
       "        for the meaning of equality for different data types.\n"
-      "\n");
+      "\n"},
 
-  alt("NOTEQUAL?", "NOTEQUALP");
-  alt("<>", "NOTEQUALP");
+  {"NOTEQUAL?", NULL, "NOTEQUALP"},
+  {"<>", NULL, "NOTEQUALP"},
 
-  set("BEFOREP", "BEFOREP word1 word2\n"
-                 "BEFORE? word1 word2\n"
-                 "\n"
-                 "        outputs TRUE if word1 comes before word2 in ASCII "
-                 "collating sequence\n"
-                 "        (for words of letters, in alphabetical order).  "
-                 "Case-sensitivity is\n"
-                 "        determined by the value of CASEIGNOREDP.  Note that "
-                 "if the inputs are\n"
-                 "        numbers, the result may not be the same as with "
-                 "LESSP; for example,\n"
-                 "        BEFOREP 3 12 is false because 3 collates after 1.\n"
-                 "\n");
-
-  alt("BEFORE?", "BEFOREP");
-
-  set(".EQ", ".EQ thing1 thing2\n"
-             "\n"
-             "        outputs TRUE if its two inputs are the same datum, so "
-             "that applying a\n"
-             "        mutator to one will change the other as well.  Outputs "
-             "FALSE otherwise,\n"
-             "        even if the inputs are equal in value.\n"
-             "        WARNING: Primitives whose names start with a period are "
-             "DANGEROUS.\n"
-             "        Their use by non-experts is not recommended.  The use of "
-             "mutators\n"
-             "        can lead to circular data structures, infinite loops, or "
-             "Logo crashes.\n"
-             "\n");
-
-  set("MEMBERP",
+  {"BEFOREP", "BEFOREP word1 word2\n"
+              "BEFORE? word1 word2\n"
+              "\n"
+              "        outputs TRUE if word1 comes before word2 in ASCII "
+              "collating sequence\n"
+              "        (for words of letters, in alphabetical order).  "
+              "Case-sensitivity is\n"
+              "        determined by the value of CASEIGNOREDP.  Note that "
+              "if the inputs are\n"
+              "        numbers, the result may not be the same as with "
+              "LESSP; for example,\n"
+              "        BEFOREP 3 12 is false because 3 collates after 1.\n"
+              "\n"},
+
+  {"BEFORE?", NULL, "BEFOREP"},
+
+  {".EQ", ".EQ thing1 thing2\n"
+          "\n"
+          "        outputs TRUE if its two inputs are the same datum, so "
+          "that applying a\n"
+          "        mutator to one will change the other as well.  Outputs "
+          "FALSE otherwise,\n"
+          "        even if the inputs are equal in value.\n"
+          "        WARNING: Primitives whose names start with a period are "
+          "DANGEROUS.\n"
+          "        Their use by non-experts is not recommended.  The use of "
+          "mutators\n"
+          "        can lead to circular data structures, infinite loops, or "
+          "Logo crashes.\n"
+          "\n"},
+
+  {"MEMBERP",
       "MEMBERP thing1 thing2\n"
       "MEMBER? thing1 thing2\n"
       "\n"
@@ -583,32 +576,32 @@ void Help::setDataStructurePrimitives() {
       "        a word, outputs TRUE if \"thing1\" is a one-character word "
       "EQUALP to a\n"
       "        character of \"thing2\", FALSE otherwise.\n"
-      "\n");
+      "\n"},
 
-  alt("MEMBER?", "MEMBERP");
+  {"MEMBER?", NULL, "MEMBERP"},
 
-  set("SUBSTRINGP", "SUBSTRINGP thing1 thing2\n"
-                    "SUBSTRING? thing1 thing2\n"
-                    "\n"
-                    "        if \"thing1\" or \"thing2\" is a list or an "
-                    "array, outputs FALSE.  If\n"
-                    "        \"thing2\" is a word, outputs TRUE if \"thing1\" "
-                    "is EQUALP to a\n"
-                    "        substring of \"thing2\", FALSE otherwise.\n"
-                    "\n");
+  {"SUBSTRINGP", "SUBSTRINGP thing1 thing2\n"
+                 "SUBSTRING? thing1 thing2\n"
+                 "\n"
+                 "        if \"thing1\" or \"thing2\" is a list or an "
+                 "array, outputs FALSE.  If\n"
+                 "        \"thing2\" is a word, outputs TRUE if \"thing1\" "
+                 "is EQUALP to a\n"
+                 "        substring of \"thing2\", FALSE otherwise.\n"
+                 "\n"},
 
-  alt("SUBSTRING?", "SUBSTRINGP");
+  {"SUBSTRING?", NULL, "SUBSTRINGP"},
 
-  set("NUMBERP",
+  {"NUMBERP",
       "NUMBERP thing\n"
       "NUMBER? thing\n"
       "\n"
       "        outputs TRUE if the input is a number, FALSE otherwise.\n"
-      "\n");
+      "\n"},
 
-  alt("NUMBER?", "NUMBERP");
+  {"NUMBER?", NULL, "NUMBERP"},
 
-  set("VBARREDP",
+  {"VBARREDP",
       "VBARREDP char\n"
       "VBARRED? char\n"
       "BACKSLASHEDP char                               (library procedure)\n"
@@ -629,16 +622,16 @@ void Help::setDataStructurePrimitives() {
       "this\n"
       "        primitive, although it does *not* output TRUE for characters\n"
       "        originally entered with backslashes.\n"
-      "\n");
+      "\n"},
 
-  alt("VBARRED?", "VBARREDP");
-  alt("BACKSLASHEDP", "VBARREDP");
-  alt("BACKSLASHED?", "VBARREDP");
+  {"VBARRED?", NULL, "VBARREDP"},
+  {"BACKSLASHEDP", NULL, "VBARREDP"},
+  {"BACKSLASHED?", NULL, "VBARREDP"},
 
   //    QUERIES
   //    -------
 
-  set("COUNT",
+  {"COUNT",
       "COUNT thing\n"
       "\n"
       "        outputs the number of characters in the input, if the input is "
@@ -647,9 +640,9 @@ void Help::setDataStructurePrimitives() {
       "        or an array.  (For an array, this may or may not be the index "
       "of the\n"
       "        last member, depending on the array's origin.)\n"
-      "\n");
+      "\n"},
 
-  set("ASCII",
+  {"ASCII",
       "ASCII char\n"
       "\n"
       "        outputs the integer (between 0 and 255) that represents the "
@@ -660,9 +653,9 @@ void Help::setDataStructurePrimitives() {
       "        for the corresponding punctuation character without vertical "
       "bars.\n"
       "        (Compare RAWASCII.)\n"
-      "\n");
+      "\n"},
 
-  set("RAWASCII",
+  {"RAWASCII",
       "RAWASCII char\n"
       "\n"
       "        outputs the integer (between 0 and 255) that represents the "
@@ -671,43 +664,43 @@ void Help::setDataStructurePrimitives() {
       "        representing themselves.  To find out the ASCII code of an "
       "arbitrary\n"
       "        keystroke, use RAWASCII RC.\n"
-      "\n");
+      "\n"},
 
-  set("CHAR", "CHAR int\n"
-              "\n"
-              "        outputs the character represented in the ASCII code by "
-              "the input,\n"
-              "        which must be an integer between 0 and 255.\n"
-              "\n");
+  {"CHAR", "CHAR int\n"
+           "\n"
+           "        outputs the character represented in the ASCII code by "
+           "the input,\n"
+           "        which must be an integer between 0 and 255.\n"
+           "\n"},
 
-  set("MEMBER", "MEMBER thing1 thing2\n"
+  {"MEMBER", "MEMBER thing1 thing2\n"
+             "\n"
+             "        if \"thing2\" is a word or list and if MEMBERP with "
+             "these inputs would\n"
+             "        output TRUE, outputs the portion of \"thing2\" from "
+             "the first instance\n"
+             "        of \"thing1\" to the end.  If MEMBERP would output "
+             "FALSE, outputs the\n"
+             "        empty word or list according to the type of "
+             "\"thing2\".  It is an error\n"
+             "        for \"thing2\" to be an array.\n"
+             "\n"},
+
+  {"LOWERCASE", "LOWERCASE word\n"
                 "\n"
-                "        if \"thing2\" is a word or list and if MEMBERP with "
-                "these inputs would\n"
-                "        output TRUE, outputs the portion of \"thing2\" from "
-                "the first instance\n"
-                "        of \"thing1\" to the end.  If MEMBERP would output "
-                "FALSE, outputs the\n"
-                "        empty word or list according to the type of "
-                "\"thing2\".  It is an error\n"
-                "        for \"thing2\" to be an array.\n"
-                "\n");
-
-  set("LOWERCASE", "LOWERCASE word\n"
-                   "\n"
-                   "        outputs a copy of the input word, but with all "
-                   "uppercase letters\n"
-                   "        changed to the corresponding lowercase letter.\n"
-                   "\n");
+                "        outputs a copy of the input word, but with all "
+                "uppercase letters\n"
+                "        changed to the corresponding lowercase letter.\n"
+                "\n"},
 
-  set("UPPERCASE", "UPPERCASE word\n"
-                   "\n"
-                   "        outputs a copy of the input word, but with all "
-                   "lowercase letters\n"
-                   "        changed to the corresponding uppercase letter.\n"
-                   "\n");
+  {"UPPERCASE", "UPPERCASE word\n"
+                "\n"
+                "        outputs a copy of the input word, but with all "
+                "lowercase letters\n"
+                "        changed to the corresponding uppercase letter.\n"
+                "\n"},
 
-  set("STANDOUT",
+  {"STANDOUT",
       "STANDOUT thing\n"
       "\n"
       "        outputs a word that, when printed, will appear like the input "
@@ -722,9 +715,9 @@ void Help::setDataStructurePrimitives() {
       "word,\n"
       "        even if the input is of some other type, but it may include\n"
       "        spaces and other formatting characters.\n"
-      "\n");
+      "\n"},
 
-  set("PARSE",
+  {"PARSE",
       "PARSE word\n"
       "\n"
       "        outputs the list that would result if the input word were "
@@ -732,9 +725,9 @@ void Help::setDataStructurePrimitives() {
       "        in response to a READLIST operation.  That is, PARSE READWORD "
       "has\n"
       "        the same value as READLIST for the same characters read.\n"
-      "\n");
+      "\n"},
 
-  set("RUNPARSE",
+  {"RUNPARSE",
       "RUNPARSE wordorlist\n"
       "\n"
       "        outputs the list that would result if the input word or list "
@@ -743,33 +736,33 @@ void Help::setDataStructurePrimitives() {
       "operators\n"
       "        and parentheses are separate members of the output.  Note that\n"
       "        sublists of a runparsed list are not themselves runparsed.\n"
-      "\n");
-}
+      "\n"},
+};
 
-void Help::setCommunication() {
+static const HelpEntry communicationHelp[] = {
   //    TRANSMITTERS
   //    ------------
 
-  set("PRINT", "PRINT thing\n"
-               "PR thing\n"
-               "(PRINT thing1 thing2 ...)\n"
-               "(PR thing1 thing2 ...)\n"
-               "\n"
-               "        command.  Prints the input or inputs to the current "
-               "write stream\n"
-               "        (initially the screen).  All the inputs are printed on "
-               "a single\n"
-               "        line, separated by spaces, ending with a newline.  If "
-               "an input is a\n"
-               "        list, square brackets are not printed around it, but "
-               "brackets are\n"
-               "        printed around sublists.  Braces are always printed "
-               "around arrays.\n"
-               "\n");
-
-  alt("PR", "PRINT");
-
-  set("TYPE",
+  {"PRINT", "PRINT thing\n"
+            "PR thing\n"
+            "(PRINT thing1 thing2 ...)\n"
+            "(PR thing1 thing2 ...)\n"
+            "\n"
+            "        command.  Prints the input or inputs to the current "
+            "write stream\n"
+            "        (initially the screen).  All the inputs are printed on "
+            "a single\n"
+            "        line, separated by spaces, ending with a newline.  If "
+            "an input is a\n"
+            "        list, square brackets are not printed around it, but "
+            "brackets are\n"
+            "        printed around sublists.  Braces are always printed "
+            "around arrays.\n"
+            "\n"},
+
+  {"PR", NULL, "PRINT"},
+
+  {"TYPE",
       "TYPE thing\n"
       "(TYPE thing1 thing2 ...)\n"
       "\n"
@@ -803,20 +796,20 @@ void Help::setCommunication() {
       "using\n"
       "        the WAIT command.  WAIT 0 will force printing without actually\n"
       "        waiting.\n"
-      "\n");
+      "\n"},
 
-  set("SHOW",
+  {"SHOW",
       "SHOW thing\n"
       "(SHOW thing1 thing2 ...)\n"
       "\n"
       "        command.  Prints the input or inputs like PRINT, except that\n"
       "        if an input is a list it is printed inside square brackets.\n"
-      "\n");
+      "\n"},
 
   //    RECEIVERS
   //    ---------
 
-  set("READLIST",
+  {"READLIST",
       "READLIST\n"
       "RL\n"
       "\n"
@@ -836,11 +829,11 @@ void Help::setCommunication() {
       "        had their usual effect.  READLIST does not, however, treat "
       "semicolon\n"
       "        as a comment character.\n"
-      "\n");
+      "\n"},
 
-  alt("RL", "READLIST");
+  {"RL", NULL, "READLIST"},
 
-  set("READWORD",
+  {"READWORD",
       "READWORD\n"
       "RW\n"
       "\n"
@@ -859,11 +852,11 @@ void Help::setCommunication() {
       "        that the user program can tell exactly what the user entered.\n"
       "        Vertical bars in the line are also preserved in the output.\n"
       "        Backslash characters are not preserved in the output.\n"
-      "\n");
+      "\n"},
 
-  alt("RW", "READWORD");
+  {"RW", NULL, "READWORD"},
 
-  set("READRAWLINE",
+  {"READRAWLINE",
       "READRAWLINE\n"
       "\n"
       "        reads a line from the read stream and outputs that line as a "
@@ -878,9 +871,9 @@ void Help::setCommunication() {
       "        in the line, with no special meaning for backslash, vertical "
       "bar,\n"
       "        tilde, or any other formatting characters.\n"
-      "\n");
+      "\n"},
 
-  set("READCHAR",
+  {"READCHAR",
       "READCHAR\n"
       "RC\n"
       "\n"
@@ -896,11 +889,11 @@ void Help::setCommunication() {
       "        is invoked or a Logo prompt is printed.  Backslash, vertical "
       "bar,\n"
       "        and tilde characters have no special meaning in this context.\n"
-      "\n");
+      "\n"},
 
-  alt("RC", "READCHAR");
+  {"RC", NULL, "READCHAR"},
 
-  set("READCHARS",
+  {"READCHARS",
       "READCHARS num\n"
       "RCS num\n"
       "\n"
@@ -917,11 +910,11 @@ void Help::setCommunication() {
       "        is invoked or a Logo prompt is printed.  Backslash, vertical "
       "bar,\n"
       "        and tilde characters have no special meaning in this context.\n"
-      "\n");
+      "\n"},
 
-  alt("RCS", "READCHARS");
+  {"RCS", NULL, "READCHARS"},
 
-  set("SHELL",
+  {"SHELL",
       "SHELL command\n"
       "(SHELL command wordflag)\n"
       "\n"
@@ -968,12 +961,12 @@ void Help::setCommunication() {
       "        that DOS-style commands are understood; use \"dir\" rather than "
       "\"ls\").\n"
       "        The non-wxWidgets version behaves like the DOS version.\n"
-      "\n");
+      "\n"},
 
   //    FILE ACCESS
   //    -----------
 
-  set("SETPREFIX",
+  {"SETPREFIX",
       "SETPREFIX string\n"
       "\n"
       "        command.  Sets a prefix that will be used as the implicit "
@@ -988,23 +981,23 @@ void Help::setCommunication() {
       "        The input to SETPREFIX must be a word, unless it is the empty "
       "list,\n"
       "        to indicate that there should be no prefix.\n"
-      "\n");
+      "\n"},
 
-  set("PREFIX",
+  {"PREFIX",
       "PREFIX\n"
       "\n"
       "        outputs the current file prefix, or [] if there is no prefix.\n"
       "        See SETPREFIX.\n"
-      "\n");
+      "\n"},
 
-  set("OPENREAD", "OPENREAD filename\n"
-                  "\n"
-                  "        command.  Opens the named file for reading.  The "
-                  "read position is\n"
-                  "        initially at the beginning of the file.\n"
-                  "\n");
+  {"OPENREAD", "OPENREAD filename\n"
+               "\n"
+               "        command.  Opens the named file for reading.  The "
+               "read position is\n"
+               "        initially at the beginning of the file.\n"
+               "\n"},
 
-  set("OPENWRITE",
+  {"OPENWRITE",
       "OPENWRITE filename\n"
       "\n"
       "        command.  Opens the named file for writing.  If the file "
@@ -1035,9 +1028,9 @@ void Help::setCommunication() {
       "        from the buffer (treated as one long word, even if spaces and\n"
       "        newlines are included) become the value of the specified "
       "variable.\n"
-      "\n");
+      "\n"},
 
-  set("OPENAPPEND",
+  {"OPENAPPEND",
       "OPENAPPEND filename\n"
       "\n"
       "        command.  Opens the named file for writing.  If the file "
@@ -1045,28 +1038,28 @@ void Help::setCommunication() {
       "        exists, the write position is initially set to the end of the "
       "old\n"
       "        file, so that newly written data will be appended to it.\n"
-      "\n");
+      "\n"},
 
-  set("OPENUPDATE", "OPENUPDATE filename\n"
-                    "\n"
-                    "        command.  Opens the named file for reading and "
-                    "writing.  The read and\n"
-                    "        write position is initially set to the end of the "
-                    "old file, if any.\n"
-                    "        Note: each open file has only one position, for "
-                    "both reading and\n"
-                    "        writing.  If a file opened for update is both "
-                    "READER and WRITER at\n"
-                    "        the same time, then SETREADPOS will also affect "
-                    "WRITEPOS and vice\n"
-                    "        versa.  Also, if you alternate reading and "
-                    "writing the same file,\n"
-                    "        you must SETREADPOS between a write and a read, "
-                    "and SETWRITEPOS\n"
-                    "        between a read and a write.\n"
-                    "\n");
-
-  set("CLOSE",
+  {"OPENUPDATE", "OPENUPDATE filename\n"
+                 "\n"
+                 "        command.  Opens the named file for reading and "
+                 "writing.  The read and\n"
+                 "        write position is initially set to the end of the "
+                 "old file, if any.\n"
+                 "        Note: each open file has only one position, for "
+                 "both reading and\n"
+                 "        writing.  If a file opened for update is both "
+                 "READER and WRITER at\n"
+                 "        the same time, then SETREADPOS will also affect "
+                 "WRITEPOS and vice\n"
+                 "        versa.  Also, if you alternate reading and "
+                 "writing the same file,\n"
+                 "        you must SETREADPOS between a write and a read, "
+                 "and SETWRITEPOS\n"
+                 "        between a read and a write.\n"
+                 "\n"},
+
+  {"CLOSE",
       "CLOSE filename\n"
       "\n"
       "        command.  Closes the named file.  If the file was currently "
@@ -1074,34 +1067,34 @@ void Help::setCommunication() {
       "        reader or writer, then the reader or writer is changed to the\n"
       "        keyboard or screen, as if SETREAD [] or SETWRITE [] had been "
       "done.\n"
-      "\n");
+      "\n"},
 
-  set("ALLOPEN",
+  {"ALLOPEN",
       "ALLOPEN\n"
       "\n"
       "        outputs a list whose members are the names of all files "
       "currently open.\n"
       "        This list does not include the dribble file, if any.\n"
-      "\n");
+      "\n"},
 
-  set("CLOSEALL", "CLOSEALL                                                "
-                  "(library procedure)\n"
-                  "\n"
-                  "        command.  Closes all open files.  Abbreviates\n"
-                  "        FOREACH ALLOPEN [CLOSE ?]\n"
-                  "\n");
+  {"CLOSEALL", "CLOSEALL                                                "
+               "(library procedure)\n"
+               "\n"
+               "        command.  Closes all open files.  Abbreviates\n"
+               "        FOREACH ALLOPEN [CLOSE ?]\n"
+               "\n"},
 
-  set("ERASEFILE", "ERASEFILE filename\n"
-                   "ERF filename\n"
-                   "\n"
-                   "        command.  Erases (deletes, removes) the named "
-                   "file, which should not\n"
-                   "        currently be open.\n"
-                   "\n");
+  {"ERASEFILE", "ERASEFILE filename\n"
+                "ERF filename\n"
+                "\n"
+                "        command.  Erases (deletes, removes) the named "
+                "file, which should not\n"
+                "        currently be open.\n"
+                "\n"},
 
-  alt("ERF", "ERASEFILE");
+  {"ERF", NULL, "ERASEFILE"},
 
-  set("DRIBBLE",
+  {"DRIBBLE",
       "DRIBBLE filename\n"
       "\n"
       "        command.  Creates a new file whose name is the input, like "
@@ -1113,16 +1106,16 @@ void Help::setCommunication() {
       "        addition to the writing to WRITER.  The intent is to create a\n"
       "        transcript of a Logo session, including things like prompt\n"
       "        characters and interactions.\n"
-      "\n");
+      "\n"},
 
-  set("NODRIBBLE",
+  {"NODRIBBLE",
       "NODRIBBLE\n"
       "\n"
       "        command.  Stops copying information into the dribble file, and\n"
       "        closes the file.\n"
-      "\n");
+      "\n"},
 
-  set("SETREAD",
+  {"SETREAD",
       "SETREAD filename\n"
       "\n"
       "        command.  Makes the named file the read stream, used for "
@@ -1134,9 +1127,9 @@ void Help::setCommunication() {
       "the\n"
       "        file that was previously the read stream, so it is possible to\n"
       "        alternate between files.\n"
-      "\n");
+      "\n"},
 
-  set("SETWRITE",
+  {"SETWRITE",
       "SETWRITE filename\n"
       "\n"
       "        command.  Makes the named file the write stream, used for "
@@ -1177,85 +1170,85 @@ void Help::setCommunication() {
       "        this one will implicitly close it, setting the variable and "
       "freeing\n"
       "        the allocated buffer.\n"
-      "\n");
+      "\n"},
 
-  set("READER", "READER\n"
-                "\n"
-                "        outputs the name of the current read stream file, or "
-                "the empty list\n"
-                "        if the read stream is the terminal.\n"
-                "\n");
+  {"READER", "READER\n"
+             "\n"
+             "        outputs the name of the current read stream file, or "
+             "the empty list\n"
+             "        if the read stream is the terminal.\n"
+             "\n"},
 
-  set("WRITER", "WRITER\n"
-                "\n"
-                "        outputs the name of the current write stream file, or "
-                "the empty list\n"
-                "        if the write stream is the screen.\n"
-                "\n");
+  {"WRITER", "WRITER\n"
+             "\n"
+             "        outputs the name of the current write stream file, or "
+             "the empty list\n"
+             "        if the write stream is the screen.\n"
+             "\n"},
 
-  set("SETREADPOS", "SETREADPOS charpos\n"
-                    "\n"
-                    "        command.  Sets the file pointer of the read "
-                    "stream file so that the\n"
-                    "        next READLIST, etc., will begin reading at the "
-                    "\"charpos\"th character\n"
-                    "        in the file, counting from 0.  (That is, "
-                    "SETREADPOS 0 will start\n"
-                    "        reading from the beginning of the file.)  "
-                    "Meaningless if the read\n"
-                    "        stream is the screen.\n"
-                    "\n");
-
-  set("SETWRITEPOS", "SETWRITEPOS charpos\n"
-                     "\n"
-                     "        command.  Sets the file pointer of the write "
-                     "stream file so that the\n"
-                     "        next PRINT, etc., will begin writing at the "
-                     "\"charpos\"th character\n"
-                     "        in the file, counting from 0.  (That is, "
-                     "SETWRITEPOS 0 will start\n"
-                     "        writing from the beginning of the file.)  "
-                     "Meaningless if the write\n"
-                     "        stream is the screen.\n"
-                     "\n");
-
-  set("READPOS",
+  {"SETREADPOS", "SETREADPOS charpos\n"
+                 "\n"
+                 "        command.  Sets the file pointer of the read "
+                 "stream file so that the\n"
+                 "        next READLIST, etc., will begin reading at the "
+                 "\"charpos\"th character\n"
+                 "        in the file, counting from 0.  (That is, "
+                 "SETREADPOS 0 will start\n"
+                 "        reading from the beginning of the file.)  "
+                 "Meaningless if the read\n"
+                 "        stream is the screen.\n"
+                 "\n"},
+
+  {"SETWRITEPOS", "SETWRITEPOS charpos\n"
+                  "\n"
+                  "        command.  Sets the file pointer of the write "
+                  "stream file so that the\n"
+                  "        next PRINT, etc., will begin writing at the "
+                  "\"charpos\"th character\n"
+                  "        in the file, counting from 0.  (That is, "
+                  "SETWRITEPOS 0 will start\n"
+                  "        writing from the beginning of the file.)  "
+                  "Meaningless if the write\n"
+                  "        stream is the screen.\n"
+                  "\n"},
+
+  {"READPOS",
       "READPOS\n"
       "\n"
       "        outputs the file position of the current read stream file.\n"
-      "\n");
+      "\n"},
 
-  set("WRITEPOS",
+  {"WRITEPOS",
       "WRITEPOS\n"
       "\n"
       "        outputs the file position of the current write stream file.\n"
-      "\n");
+      "\n"},
 
-  set("EOFP",
+  {"EOFP",
       "EOFP\n"
       "EOF?\n"
       "\n"
       "        predicate, outputs TRUE if there are no more characters to be\n"
       "        read in the read stream file, FALSE otherwise.\n"
-      "\n");
+      "\n"},
 
-  alt("EOF?", "EOFP");
+  {"EOF?", NULL, "EOFP"},
 
-  set("FILEP",
+  {"FILEP",
       "FILEP filename\n"
       "FILE? filename                                          (library "
       "procedure)\n"
       "\n"
       "        predicate, outputs TRUE if a file of the specified name exists\n"
       "        and can be read, FALSE otherwise.\n"
-      "\n");
+      "\n"},
 
-  alt("FILE?", "FILEP");
+  {"FILE?", NULL, "FILEP"},
 
   //    TERMINAL ACCESS
   //    ---------------
 
-  set("KEYP",
+  {"KEYP",
       "KEYP\n"
       "KEY?\n"
       "\n"
@@ -1269,19 +1262,19 @@ void Help::setCommunication() {
       "        (e.g., READLIST).  The Unix operating system forgets about any\n"
       "        pending characters when it switches modes, so the first KEYP\n"
       "        invocation will always output FALSE.\n"
-      "\n");
+      "\n"},
 
-  alt("KEY?", "KEYP");
+  {"KEY?", NULL, "KEYP"},
 
-  set("CLEARTEXT", "CLEARTEXT\n"
-                   "CT\n"
-                   "\n"
-                   "        command.  Clears the text window.\n"
-                   "\n");
+  {"CLEARTEXT", "CLEARTEXT\n"
+                "CT\n"
+                "\n"
+                "        command.  Clears the text window.\n"
+                "\n"},
 
-  alt("CT", "CLEARTEXT");
+  {"CT", NULL, "CLEARTEXT"},
 
-  set("SETCURSOR",
+  {"SETCURSOR",
       "SETCURSOR vector\n"
       "\n"
       "        command.  The input is a list of two numbers, the x and y\n"
@@ -1290,9 +1283,9 @@ void Help::setCommunication() {
       "        corner, positive direction is southeast).  The text cursor\n"
       "        is moved to the requested position.  This command also forces\n"
       "        the immediate printing of any buffered characters.\n"
-      "\n");
+      "\n"},
 
-  set("CURSOR",
+  {"CURSOR",
       "CURSOR\n"
       "\n"
       "        outputs a list containing the current x and y coordinates of\n"
@@ -1300,9 +1293,9 @@ void Help::setCommunication() {
       "        cursor position if, e.g., you type in a long line that wraps\n"
       "        around or your program prints escape codes that affect the\n"
       "        screen strangely.\n"
-      "\n");
+      "\n"},
 
-  set("SETMARGINS",
+  {"SETMARGINS",
       "SETMARGINS vector\n"
       "\n"
       "        command.  The input must be a list of two numbers, as for\n"
@@ -1324,87 +1317,87 @@ void Help::setCommunication() {
       "with\n"
       "        inadequate TV monitors that miss the top and left edges of the\n"
       "        screen.\n"
-      "\n");
-
-  set("SETTEXTCOLOR", "SETTEXTCOLOR foreground background\n"
-                      "SETTC foreground background\n"
-                      "\n"
-                      "        command (wxWidgets only).  The inputs are color "
-                      "numbers, or RGB color\n"
-                      "        lists, as for turtle graphics.  The foreground "
-                      "and background colors\n"
-                      "        for the textscreen/splitscreen text window are "
-                      "changed to the given\n"
-                      "        values.  The change affects text already "
-                      "printed as well as future\n"
-                      "        text printing; there is only one text color for "
-                      "the entire window.\n"
-                      "\n"
-                      "        command (non-wxWidgets Windows and DOS extended "
-                      "only).  The inputs are\n"
-                      "        color numbers, as for turtle graphics.  Future "
-                      "printing to the text\n"
-                      "        window will use the specified colors for "
-                      "foreground (the characters\n"
-                      "        printed) and background (the space under those "
-                      "characters).  Using\n"
-                      "        STANDOUT will revert to the default text window "
-                      "colors.  In the DOS\n"
-                      "        extended (ucblogo.exe) version, colors in "
-                      "textscreen mode are limited\n"
-                      "        to numbers 0-7, and the coloring applies only "
-                      "to text printed by the\n"
-                      "        program, not to the echoing of text typed by "
-                      "the user.  Neither\n"
-                      "        limitation applies to the text portion of "
-                      "splitscreen mode, which is\n"
-                      "        actually drawn as graphics internally.\n"
-                      "\n");
-
-  alt("SETTC", "SETTEXTCOLOR");
-
-  set("INCREASEFONT", "INCREASEFONT\n"
-                      "DECREASEFONT\n"
-                      "\n"
-                      "        command (wxWidgets only).  Increase or decrease "
-                      "the size of the font\n"
-                      "        used in the text and edit windows to the next "
-                      "larger or smaller\n"
-                      "        available size.\n"
-                      "\n");
-
-  alt("DECREASEFONT", "INCREASEFONT");
-
-  set("SETTEXTSIZE", "SETTEXTSIZE height\n"
-                     "\n"
-                     "        command (wxWidgets only).  Set the \"point "
-                     "size\" of the font used in\n"
-                     "        the text and edit windows to the given integer "
-                     "input.  The desired\n"
-                     "        size may not be available, in which case the "
-                     "nearest available size\n"
-                     "        will be used.  Note: There is only a slight "
-                     "correlation between these\n"
-                     "        integers and pixel sizes.  Our rough estimate is "
-                     "that the number of\n"
-                     "        pixels of height is about 1.5 times the point "
-                     "size, but it varies for\n"
-                     "        different fonts.  See SETLABELHEIGHT for a "
-                     "different approach used for\n"
-                     "        the graphics window.\n"
-                     "\n");
-
-  set("TEXTSIZE", "TEXTSIZE\n"
+      "\n"},
+
+  {"SETTEXTCOLOR", "SETTEXTCOLOR foreground background\n"
+                   "SETTC foreground background\n"
+                   "\n"
+                   "        command (wxWidgets only).  The inputs are color "
+                   "numbers, or RGB color\n"
+                   "        lists, as for turtle graphics.  The foreground "
+                   "and background colors\n"
+                   "        for the textscreen/splitscreen text window are "
+                   "changed to the given\n"
+                   "        values.  The change affects text already "
+                   "printed as well as future\n"
+                   "        text printing; there is only one text color for "
+                   "the entire window.\n"
+                   "\n"
+                   "        command (non-wxWidgets Windows and DOS extended "
+                   "only).  The inputs are\n"
+                   "        color numbers, as for turtle graphics.  Future "
+                   "printing to the text\n"
+                   "        window will use the specified colors for "
+                   "foreground (the characters\n"
+                   "        printed) and background (the space under those "
+                   "characters).  Using\n"
+                   "        STANDOUT will revert to the default text window "
+                   "colors.  In the DOS\n"
+                   "        extended (ucblogo.exe) version, colors in "
+                   "textscreen mode are limited\n"
+                   "        to numbers 0-7, and the coloring applies only "
+                   "to text printed by the\n"
+                   "        program, not to the echoing of text typed by "
+                   "the user.  Neither\n"
+                   "        limitation applies to the text portion of "
+                   "splitscreen mode, which is\n"
+                   "        actually drawn as graphics internally.\n"
+                   "\n"},
+
+  {"SETTC", NULL, "SETTEXTCOLOR"},
+
+  {"INCREASEFONT", "INCREASEFONT\n"
+                   "DECREASEFONT\n"
+                   "\n"
+                   "        command (wxWidgets only).  Increase or decrease "
+                   "the size of the font\n"
+                   "        used in the text and edit windows to the next "
+                   "larger or smaller\n"
+                   "        available size.\n"
+                   "\n"},
+
+  {"DECREASEFONT", NULL, "INCREASEFONT"},
+
+  {"SETTEXTSIZE", "SETTEXTSIZE height\n"
                   "\n"
-                  "        (wxWidgets only) outputs the \"point size\" of the "
-                  "font used in the text\n"
-                  "        and edit windows.  See SETTEXTSIZE for a discussion "
-                  "of font sizing.\n"
-                  "        See LABELSIZE for a different approach used for the "
-                  "graphics window.\n"
-                  "\n");
-
-  set("SETFONT",
+                  "        command (wxWidgets only).  Set the \"point "
+                  "size\" of the font used in\n"
+                  "        the text and edit windows to the given integer "
+                  "input.  The desired\n"
+                  "        size may not be available, in which case the "
+                  "nearest available size\n"
+                  "        will be used.  Note: There is only a slight "
+                  "correlation between these\n"
+                  "        integers and pixel sizes.  Our rough estimate is "
+                  "that the number of\n"
+                  "        pixels of height is about 1.5 times the point "
+                  "size, but it varies for\n"
+                  "        different fonts.  See SETLABELHEIGHT for a "
+                  "different approach used for\n"
+                  "        the graphics window.\n"
+                  "\n"},
+
+  {"TEXTSIZE", "TEXTSIZE\n"
+               "\n"
+               "        (wxWidgets only) outputs the \"point size\" of the "
+               "font used in the text\n"
+               "        and edit windows.  See SETTEXTSIZE for a discussion "
+               "of font sizing.\n"
+               "        See LABELSIZE for a different approach used for the "
+               "graphics window.\n"
+               "\n"},
+
+  {"SETFONT",
       "SETFONT fontname\n"
       "\n"
       "        command (wxWidgets only).  Set the font family used in all "
@@ -1415,30 +1408,30 @@ void Help::setCommunication() {
       "installed.  It's\n"
       "        a good idea to stick with monospace fonts (ones in which all\n"
       "        characters have the same width).\n"
-      "\n");
+      "\n"},
 
-  set("FONT", "FONT\n"
-              "\n"
-              "        (wxWidgets only) outputs the name of the font family "
-              "used in all\n"
-              "        windows.\n"
-              "\n");
-}
+  {"FONT", "FONT\n"
+           "\n"
+           "        (wxWidgets only) outputs the name of the font family "
+           "used in all\n"
+           "        windows.\n"
+           "\n"},
+};
 
-void Help::setArithmetic() {
+static const HelpEntry arithmeticHelp[] = {
   //    NUMERIC OPERATIONS
   //    ------------------
 
-  set("SUM", "SUM num1 num2\n"
-             "(SUM num1 num2 num3 ...)\n"
-             "num1 + num2\n"
-             "\n"
-             "        outputs the sum of its inputs.\n"
-             "\n");
+  {"SUM", "SUM num1 num2\n"
+          "(SUM num1 num2 num3 ...)\n"
+          "num1 + num2\n"
+          "\n"
+          "        outputs the sum of its inputs.\n"
+          "\n"},
 
-  alt("+", "SUM");
+  {"+", NULL, "SUM"},
 
-  set("DIFFERENCE",
+  {"DIFFERENCE",
       "DIFFERENCE num1 num2\n"
       "num1 - num2\n"
       "\n"
@@ -1446,35 +1439,35 @@ void Help::setArithmetic() {
       "        difference in ambiguous contexts (when preceded by a complete\n"
       "        expression), unless it is preceded by a space and followed\n"
       "        by a nonspace.  (See also MINUS.)\n"
-      "\n");
+      "\n"},
 
-  alt("-", "DIFFERENCE");
+  {"-", NULL, "DIFFERENCE"},
 
-  set("MINUS", "MINUS num\n"
-               "- num\n"
-               "\n"
-               "        outputs the negative of its input.  Minus sign means "
-               "unary minus if\n"
-               "        the previous token is an infix operator or open "
-               "parenthesis, or it is\n"
-               "        preceded by a space and followed by a nonspace.  There "
-               "is a difference\n"
-               "        in binding strength between the two forms:\n"
-               "\n"
-               "                MINUS 3 + 4     means   -(3+4)\n"
-               "                - 3 + 4         means   (-3)+4\n"
-               "\n");
+  {"MINUS", "MINUS num\n"
+            "- num\n"
+            "\n"
+            "        outputs the negative of its input.  Minus sign means "
+            "unary minus if\n"
+            "        the previous token is an infix operator or open "
+            "parenthesis, or it is\n"
+            "        preceded by a space and followed by a nonspace.  There "
+            "is a difference\n"
+            "        in binding strength between the two forms:\n"
+            "\n"
+            "                MINUS 3 + 4     means   -(3+4)\n"
+            "                - 3 + 4         means   (-3)+4\n"
+            "\n"},
 
-  set("PRODUCT", "PRODUCT num1 num2\n"
-                 "(PRODUCT num1 num2 num3 ...)\n"
-                 "num1 * num2\n"
-                 "\n"
-                 "        outputs the product of its inputs.\n"
-                 "\n");
+  {"PRODUCT", "PRODUCT num1 num2\n"
+              "(PRODUCT num1 num2 num3 ...)\n"
+              "num1 * num2\n"
+              "\n"
+              "        outputs the product of its inputs.\n"
+              "\n"},
 
-  alt("*", "PRODUCT");
+  {"*", NULL, "PRODUCT"},
 
-  set("QUOTIENT",
+  {"QUOTIENT",
       "QUOTIENT num1 num2\n"
       "(QUOTIENT num)\n"
       "num1 / num2\n"
@@ -1487,27 +1480,27 @@ void Help::setArithmetic() {
       "is\n"
       "        2, not 2.0 -- it does the right thing.)  With a single input,\n"
       "        QUOTIENT outputs the reciprocal of the input.\n"
-      "\n");
+      "\n"},
 
-  alt("/", "QUOTIENT");
+  {"/", NULL, "QUOTIENT"},
 
-  set("REMAINDER", "REMAINDER num1 num2\n"
-                   "\n"
-                   "        outputs the remainder on dividing \"num1\" by "
-                   "\"num2\"; both must be\n"
-                   "        integers and the result is an integer with the "
-                   "same sign as num1.\n"
-                   "\n");
-
-  set("MODULO", "MODULO num1 num2\n"
+  {"REMAINDER", "REMAINDER num1 num2\n"
                 "\n"
                 "        outputs the remainder on dividing \"num1\" by "
                 "\"num2\"; both must be\n"
-                "        integers and the result is an integer with the same "
-                "sign as num2.\n"
-                "\n");
+                "        integers and the result is an integer with the "
+                "same sign as num1.\n"
+                "\n"},
 
-  set("INT",
+  {"MODULO", "MODULO num1 num2\n"
+             "\n"
+             "        outputs the remainder on dividing \"num1\" by "
+             "\"num2\"; both must be\n"
+             "        integers and the result is an integer with the same "
+             "sign as num2.\n"
+             "\n"},
+
+  {"INT",
       "INT num\n"
       "\n"
       "        outputs its input with fractional part removed, i.e., an "
@@ -1515,75 +1508,75 @@ void Help::setArithmetic() {
       "        with the same sign as the input, whose absolute value is the\n"
       "        largest integer less than or equal to the absolute value of\n"
       "        the input.\n"
-      "\n");
-
-  set("ROUND", "ROUND num\n"
-               "\n"
-               "        outputs the nearest integer to the input.\n"
-               "\n");
+      "\n"},
 
-  set("SQRT", "SQRT num\n"
-              "\n"
-              "        outputs the square root of the input, which must be "
-              "nonnegative.\n"
-              "\n");
+  {"ROUND", "ROUND num\n"
+            "\n"
+            "        outputs the nearest integer to the input.\n"
+            "\n"},
 
-  set("POWER", "POWER num1 num2\n"
-               "\n"
-               "        outputs \"num1\" to the \"num2\" power.  If num1 is "
-               "negative, then\n"
-               "        num2 must be an integer.\n"
-               "\n");
+  {"SQRT", "SQRT num\n"
+           "\n"
+           "        outputs the square root of the input, which must be "
+           "nonnegative.\n"
+           "\n"},
 
-  set("EXP", "EXP num\n"
-             "\n"
-             "        outputs e (2.718281828+) to the input power.\n"
-             "\n");
+  {"POWER", "POWER num1 num2\n"
+            "\n"
+            "        outputs \"num1\" to the \"num2\" power.  If num1 is "
+            "negative, then\n"
+            "        num2 must be an integer.\n"
+            "\n"},
 
-  set("LOG10", "LOG10 num\n"
-               "\n"
-               "        outputs the common logarithm of the input.\n"
-               "\n");
+  {"EXP", "EXP num\n"
+          "\n"
+          "        outputs e (2.718281828+) to the input power.\n"
+          "\n"},
 
-  set("LN", "LN num\n"
+  {"LOG10", "LOG10 num\n"
             "\n"
-            "        outputs the natural logarithm of the input.\n"
-            "\n");
+            "        outputs the common logarithm of the input.\n"
+            "\n"},
 
-  set("SIN",
+  {"LN", "LN num\n"
+         "\n"
+         "        outputs the natural logarithm of the input.\n"
+         "\n"},
+
+  {"SIN",
       "SIN degrees\n"
       "\n"
       "        outputs the sine of its input, which is taken in degrees.\n"
-      "\n");
+      "\n"},
 
-  set("RADSIN",
+  {"RADSIN",
       "RADSIN radians\n"
       "\n"
       "        outputs the sine of its input, which is taken in radians.\n"
-      "\n");
+      "\n"},
 
-  set("COS",
+  {"COS",
       "COS degrees\n"
       "\n"
       "        outputs the cosine of its input, which is taken in degrees.\n"
-      "\n");
+      "\n"},
 
-  set("RADCOS",
+  {"RADCOS",
       "RADCOS radians\n"
       "\n"
       "        outputs the cosine of its input, which is taken in radians.\n"
-      "\n");
+      "\n"},
 
-  set("ARCTAN",
+  {"ARCTAN",
       "ARCTAN num\n"
       "(ARCTAN x y)\n"
       "\n"
       "        outputs the arctangent, in degrees, of its input.  With two\n"
       "        inputs, outputs the arctangent of y/x, if x is nonzero, or\n"
       "        90 or -90 depending on the sign of y, if x is zero.\n"
-      "\n");
+      "\n"},
 
-  set("RADARCTAN",
+  {"RADARCTAN",
       "RADARCTAN num\n"
       "(RADARCTAN x y)\n"
       "\n"
@@ -1593,9 +1586,9 @@ void Help::setArithmetic() {
       "\n"
       "        The expression 2*(RADARCTAN 0 1) can be used to get the\n"
       "        value of pi.\n"
-      "\n");
+      "\n"},
 
-  set("ISEQ",
+  {"ISEQ",
       "ISEQ from to                                            (library "
       "procedure)\n"
       "\n"
@@ -1605,9 +1598,9 @@ void Help::setArithmetic() {
       "                [3 4 5 6 7]\n"
       "                ? show iseq 7 3\n"
       "                [7 6 5 4 3]\n"
-      "\n");
+      "\n"},
 
-  set("RSEQ",
+  {"RSEQ",
       "RSEQ from to count                                      (library "
       "procedure)\n"
       "\n"
@@ -1618,60 +1611,60 @@ void Help::setArithmetic() {
       "                [3 3.25 3.5 3.75 4 4.25 4.5 4.75 5]\n"
       "                ? show rseq 3 5 5\n"
       "                [3 3.5 4 4.5 5]\n"
-      "\n");
+      "\n"},
 
   //    "PREDICATES
   //    ----------
 
-  set("LESSP", "LESSP num1 num2\n"
-               "LESS? num1 num2\n"
-               "num1 < num2\n"
-               "\n"
-               "        outputs TRUE if its first input is strictly less than "
-               "its second.\n"
-               "\n");
+  {"LESSP", "LESSP num1 num2\n"
+            "LESS? num1 num2\n"
+            "num1 < num2\n"
+            "\n"
+            "        outputs TRUE if its first input is strictly less than "
+            "its second.\n"
+            "\n"},
 
-  alt("LESS?", "LESSP");
-  alt("<", "LESSP");
+  {"LESS?", NULL, "LESSP"},
+  {"<", NULL, "LESSP"},
 
-  set("GREATERP", "GREATERP num1 num2\n"
-                  "GREATER? num1 num2\n"
-                  "num1 > num2\n"
-                  "\n"
-                  "        outputs TRUE if its first input is strictly greater "
-                  "than its second.\n"
-                  "\n");
+  {"GREATERP", "GREATERP num1 num2\n"
+               "GREATER? num1 num2\n"
+               "num1 > num2\n"
+               "\n"
+               "        outputs TRUE if its first input is strictly greater "
+               "than its second.\n"
+               "\n"},
 
-  alt("GREATER?", "GREATERP");
-  alt(">", "GREATERP");
+  {"GREATER?", NULL, "GREATERP"},
+  {">", NULL, "GREATERP"},
 
-  set("LESSEQUALP", "LESSEQUALP num1 num2\n"
-                    "LESSEQUAL? num1 num2\n"
-                    "num1 <= num2\n"
-                    "\n"
-                    "        outputs TRUE if its first input is less than or "
-                    "equal to its second.\n"
-                    "\n");
+  {"LESSEQUALP", "LESSEQUALP num1 num2\n"
+                 "LESSEQUAL? num1 num2\n"
+                 "num1 <= num2\n"
+                 "\n"
+                 "        outputs TRUE if its first input is less than or "
+                 "equal to its second.\n"
+                 "\n"},
 
-  alt("LESSEQUAL?", "LESSEQUALP");
-  alt("<=", "LESSEQUALP");
+  {"LESSEQUAL?", NULL, "LESSEQUALP"},
+  {"<=", NULL, "LESSEQUALP"},
 
-  set("GREATEREQUALP", "GREATEREQUALP num1 num2\n"
-                       "GREATEREQUAL? num1 num2\n"
-                       "num1 >= num2\n"
-                       "\n"
-                       "        outputs TRUE if its first input is greater "
-                       "than or equal to its second.\n"
-                       "\n"
-                       "\n");
+  {"GREATEREQUALP", "GREATEREQUALP num1 num2\n"
+                    "GREATEREQUAL? num1 num2\n"
+                    "num1 >= num2\n"
+                    "\n"
+                    "        outputs TRUE if its first input is greater "
+                    "than or equal to its second.\n"
+                    "\n"
+                    "\n"},
 
-  alt("GREATEREQUAL?", "GREATEREQUALP");
-  alt(">=", "GREATEREQUALP");
+  {"GREATEREQUAL?", NULL, "GREATEREQUALP"},
+  {">=", NULL, "GREATEREQUALP"},
 
   //    RANDOM NUMBERS
   //    --------------
 
-  set("RANDOM",
+  {"RANDOM",
       "RANDOM num\n"
       "(RANDOM start end)\n"
       "\n"
@@ -1686,9 +1679,9 @@ void Help::setArithmetic() {
       "less\n"
       "        than the second.  (RANDOM 0 9) is equivalent to RANDOM 10;\n"
       "        (RANDOM 3 8) is equivalent to (RANDOM 6)+3.\n"
-      "\n");
+      "\n"},
 
-  set("RERANDOM",
+  {"RERANDOM",
       "RERANDOM\n"
       "(RERANDOM seed)\n"
       "\n"
@@ -1702,12 +1695,12 @@ void Help::setArithmetic() {
       "        sequence, you can give RERANDOM an integer input; each "
       "possible\n"
       "        input selects a unique sequence of numbers.\n"
-      "\n");
+      "\n"},
 
   //    PRINT FORMATTING
   //    ----------------
 
-  set("FORM",
+  {"FORM",
       "FORM num width precision\n"
       "\n"
       "        outputs a word containing a printable representation of "
@@ -1719,60 +1712,60 @@ void Help::setArithmetic() {
       "        the decimal point.  (If \"precision\" is 0 then there will be "
       "no\n"
       "        decimal point in the output.)\n"
-      "\n");
+      "\n"},
 
   //    BITWISE OPERATIONS
   //    ------------------
 
-  set("BITAND",
+  {"BITAND",
       "BITAND num1 num2\n"
       "(BITAND num1 num2 num3 ...)\n"
       "\n"
       "        outputs the bitwise AND of its inputs, which must be integers.\n"
-      "\n");
+      "\n"},
 
-  set("BITOR",
+  {"BITOR",
       "BITOR num1 num2\n"
       "(BITOR num1 num2 num3 ...)\n"
       "\n"
       "        outputs the bitwise OR of its inputs, which must be integers.\n"
-      "\n");
+      "\n"},
 
-  set("BITXOR",
+  {"BITXOR",
       "BITXOR num1 num2\n"
       "(BITXOR num1 num2 num3 ...)\n"
       "\n"
       "        outputs the bitwise EXCLUSIVE OR of its inputs, which must be\n"
       "        integers.\n"
-      "\n");
+      "\n"},
 
-  set("BITNOT", "BITNOT num\n"
-                "\n"
-                "        outputs the bitwise NOT of its input, which must be "
-                "an integer.\n"
-                "\n");
+  {"BITNOT", "BITNOT num\n"
+             "\n"
+             "        outputs the bitwise NOT of its input, which must be "
+             "an integer.\n"
+             "\n"},
 
-  set("ASHIFT",
+  {"ASHIFT",
       "ASHIFT num1 num2\n"
       "\n"
       "        outputs \"num1\" arithmetic-shifted to the left by \"num2\" "
       "bits.\n"
       "        If num2 is negative, the shift is to the right with sign\n"
       "        extension.  The inputs must be integers.\n"
-      "\n");
+      "\n"},
 
-  set("LSHIFT",
+  {"LSHIFT",
       "LSHIFT num1 num2\n"
       "\n"
       "        outputs \"num1\" logical-shifted to the left by \"num2\" bits.\n"
       "        If num2 is negative, the shift is to the right with zero fill.\n"
       "        The inputs must be integers.\n"
-      "\n");
+      "\n"},
 
   //    LOGICAL OPERATIONS
   //    ==================
 
-  set("AND",
+  {"AND",
       "AND tf1 tf2\n"
       "(AND tf1 tf2 tf3 ...)\n"
       "\n"
@@ -1793,9 +1786,9 @@ void Help::setArithmetic() {
       "        examined.  Example:\n"
       "                MAKE \"RESULT AND [NOT (:X = 0)] [(1 / :X) > .5]\n"
       "        to avoid the division by zero if the first part is false.\n"
-      "\n");
+      "\n"},
 
-  set("OR",
+  {"OR",
       "OR tf1 tf2\n"
       "(OR tf1 tf2 tf3 ...)\n"
       "\n"
@@ -1815,97 +1808,97 @@ void Help::setArithmetic() {
       "        examined.  Example:\n"
       "                IF OR :X=0 [some.long.computation] [...]\n"
       "        to avoid the long computation if the first condition is met.\n"
-      "\n");
+      "\n"},
 
-  set("NOT", "NOT tf\n"
-             "\n"
-             "        outputs TRUE if the input is FALSE, and vice versa.  The "
-             "input can be\n"
-             "        a list, in which case it is taken as an expression to "
-             "run; that\n"
-             "        expression must produce a TRUE or FALSE value.\n"
-             "\n");
-}
+  {"NOT", "NOT tf\n"
+          "\n"
+          "        outputs TRUE if the input is FALSE, and vice versa.  The "
+          "input can be\n"
+          "        a list, in which case it is taken as an expression to "
+          "run; that\n"
+          "        expression must produce a TRUE or FALSE value.\n"
+          "\n"},
+};
 
-void Help::setGraphics() {
+static const HelpEntry graphicsHelp[] = {
 
   //    TURTLE MOTION
   //    -------------
 
-  set("FORWARD", "FORWARD dist\n"
-                 "FD dist\n"
-                 "\n"
-                 "        moves the turtle forward, in the direction that it's "
-                 "facing, by\n"
-                 "        the specified distance (measured in turtle steps).\n"
-                 "\n");
-
-  alt("FD", "FORWARD");
-
-  set("BACK", "BACK dist\n"
-              "BK dist\n"
-              "\n"
-              "        moves the turtle backward, i.e., exactly opposite to "
-              "the direction\n"
-              "        that it's facing, by the specified distance.  (The "
-              "heading of the\n"
-              "        turtle does not change.)\n"
-              "\n");
-
-  alt("BK", "BACK");
-
-  set("LEFT", "LEFT degrees\n"
-              "LT degrees\n"
+  {"FORWARD", "FORWARD dist\n"
+              "FD dist\n"
               "\n"
-              "        turns the turtle counterclockwise by the specified "
-              "angle, measured\n"
-              "        in degrees (1/360 of a circle).\n"
-              "\n");
-
-  alt("LT", "LEFT");
-
-  set("RIGHT",
+              "        moves the turtle forward, in the direction that it's "
+              "facing, by\n"
+              "        the specified distance (measured in turtle steps).\n"
+              "\n"},
+
+  {"FD", NULL, "FORWARD"},
+
+  {"BACK", "BACK dist\n"
+           "BK dist\n"
+           "\n"
+           "        moves the turtle backward, i.e., exactly opposite to "
+           "the direction\n"
+           "        that it's facing, by the specified distance.  (The "
+           "heading of the\n"
+           "        turtle does not change.)\n"
+           "\n"},
+
+  {"BK", NULL, "BACK"},
+
+  {"LEFT", "LEFT degrees\n"
+           "LT degrees\n"
+           "\n"
+           "        turns the turtle counterclockwise by the specified "
+           "angle, measured\n"
+           "        in degrees (1/360 of a circle).\n"
+           "\n"},
+
+  {"LT", NULL, "LEFT"},
+
+  {"RIGHT",
       "RIGHT degrees\n"
       "RT degrees\n"
       "\n"
       "        turns the turtle clockwise by the specified angle, measured in\n"
       "        degrees (1/360 of a circle).\n"
-      "\n");
+      "\n"},
 
-  alt("RT", "RIGHT");
+  {"RT", NULL, "RIGHT"},
 
-  set("SETPOS",
+  {"SETPOS",
       "SETPOS pos\n"
       "\n"
       "        moves the turtle to an absolute position in the graphics "
       "window.  The\n"
       "        input is a list of two numbers, the X and Y coordinates.\n"
-      "\n");
+      "\n"},
 
-  set("SETXY", "SETXY xcor ycor\n"
-               "\n"
-               "        moves the turtle to an absolute position in the "
-               "graphics window.  The\n"
-               "        two inputs are numbers, the X and Y coordinates.\n"
-               "\n");
+  {"SETXY", "SETXY xcor ycor\n"
+            "\n"
+            "        moves the turtle to an absolute position in the "
+            "graphics window.  The\n"
+            "        two inputs are numbers, the X and Y coordinates.\n"
+            "\n"},
 
-  set("SETX",
+  {"SETX",
       "SETX xcor\n"
       "\n"
       "        moves the turtle horizontally from its old position to a new\n"
       "        absolute horizontal coordinate.  The input is the new X\n"
       "        coordinate.\n"
-      "\n");
+      "\n"},
 
-  set("SETY",
+  {"SETY",
       "SETY ycor\n"
       "\n"
       "        moves the turtle vertically from its old position to a new\n"
       "        absolute vertical coordinate.  The input is the new Y\n"
       "        coordinate.\n"
-      "\n");
+      "\n"},
 
-  set("SETHEADING",
+  {"SETHEADING",
       "SETHEADING degrees\n"
       "SETH degrees\n"
       "\n"
@@ -1913,111 +1906,111 @@ void Help::setGraphics() {
       "        a number, the heading in degrees counter-clockwise from the "
       "positive\n"
       "        Y axis.\n"
-      "\n");
+      "\n"},
 
-  alt("SETH", "SETHEADING");
+  {"SETH", NULL, "SETHEADING"},
 
-  set("HOME",
+  {"HOME",
       "HOME\n"
       "\n"
       "        moves the turtle to the center of the screen.  Equivalent to\n"
       "        SETPOS [0 0] SETHEADING 0.\n"
-      "\n");
-
-  set("ARC", "ARC angle radius\n"
-             "\n"
-             "        draws an arc of a circle, with the turtle at the center, "
-             "with the\n"
-             "        specified radius, starting at the turtle's heading and "
-             "extending\n"
-             "        counter-clockwise through the specified angle.  The "
-             "turtle does not move.\n"
-             "\n");
+      "\n"},
+
+  {"ARC", "ARC angle radius\n"
+          "\n"
+          "        draws an arc of a circle, with the turtle at the center, "
+          "with the\n"
+          "        specified radius, starting at the turtle's heading and "
+          "extending\n"
+          "        counter-clockwise through the specified angle.  The "
+          "turtle does not move.\n"
+          "\n"},
 
   //    TURTLE MOTION QUERIES
   //    ---------------------
 
-  set("POS", "POS\n"
-             "\n"
-             "        outputs the turtle's current position, as a list of two\n"
-             "        numbers, the X and Y coordinates.\n"
-             "\n");
-
-  set("XCOR", "XCOR                                                    "
-              "(library procedure)\n"
+  {"POS", "POS\n"
+          "\n"
+          "        outputs the turtle's current position, as a list of two\n"
+          "        numbers, the X and Y coordinates.\n"
+          "\n"},
+
+  {"XCOR", "XCOR                                                    "
+           "(library procedure)\n"
+           "\n"
+           "        outputs a number, the turtle's X coordinate.\n"
+           "\n"},
+
+  {"YCOR", "YCOR                                                    "
+           "(library procedure)\n"
+           "\n"
+           "        outputs a number, the turtle's Y coordinate.\n"
+           "\n"},
+
+  {"HEADING", "HEADING\n"
               "\n"
-              "        outputs a number, the turtle's X coordinate.\n"
-              "\n");
-
-  set("YCOR", "YCOR                                                    "
-              "(library procedure)\n"
-              "\n"
-              "        outputs a number, the turtle's Y coordinate.\n"
-              "\n");
-
-  set("HEADING", "HEADING\n"
-                 "\n"
-                 "        outputs a number, the turtle's heading in degrees.\n"
-                 "\n");
+              "        outputs a number, the turtle's heading in degrees.\n"
+              "\n"},
 
-  set("TOWARDS",
+  {"TOWARDS",
       "TOWARDS pos\n"
       "\n"
       "        outputs a number, the heading at which the turtle should be\n"
       "        facing so that it would point from its current position to\n"
       "        the position given as the input.\n"
-      "\n");
+      "\n"},
 
-  set("SCRUNCH",
+  {"SCRUNCH",
       "SCRUNCH\n"
       "\n"
       "        outputs a list containing two numbers, the X and Y scrunch\n"
       "        factors, as used by SETSCRUNCH.  (But note that SETSCRUNCH\n"
       "        takes two numbers as inputs, not one list of numbers.)\n"
-      "\n");
+      "\n"},
 
   //    TURTLE AND WINDOW CONTROL
   //    -------------------------
 
-  set("SHOWTURTLE", "SHOWTURTLE\n"
-                    "ST\n"
-                    "\n"
-                    "        makes the turtle visible.\n"
-                    "\n");
+  {"SHOWTURTLE", "SHOWTURTLE\n"
+                 "ST\n"
+                 "\n"
+                 "        makes the turtle visible.\n"
+                 "\n"},
 
-  alt("ST", "SHOWTURTLE");
+  {"ST", NULL, "SHOWTURTLE"},
 
-  set("HIDETURTLE",
+  {"HIDETURTLE",
       "HIDETURTLE\n"
       "HT\n"
       "\n"
       "        makes the turtle invisible.  It's a good idea to do this while\n"
       "        you're in the middle of a complicated drawing, because hiding\n"
       "        the turtle speeds up the drawing substantially.\n"
-      "\n");
+      "\n"},
 
-  alt("HT", "HIDETURTLE");
+  {"HT", NULL, "HIDETURTLE"},
 
-  set("CLEAN",
+  {"CLEAN",
       "CLEAN\n"
       "\n"
       "        erases all lines that the turtle has drawn on the graphics "
       "window.\n"
       "        The turtle's state (position, heading, pen mode, etc.) is not\n"
       "        changed.\n"
-      "\n");
+      "\n"},
 
-  set("CLEARSCREEN",
+  {"CLEARSCREEN",
       "CLEARSCREEN\n"
       "CS\n"
       "\n"
       "        erases the graphics window and sends the turtle to its initial\n"
       "        position and heading.  Like HOME and CLEAN together.\n"
-      "\n");
+      "\n"},
 
-  alt("CS", "CLEARSCREEN");
+  {"CS", NULL, "CLEARSCREEN"},
 
-  set("WRAP",
+  {"WRAP",
       "WRAP\n"
       "\n"
       "        tells the turtle to enter wrap mode:  From now on, if the "
@@ -2028,9 +2021,9 @@ void Help::setGraphics() {
       "        edge wraps to the right edge.  (So the window is topologically\n"
       "        equivalent to a torus.)  This is the turtle's initial mode.\n"
       "        Compare WINDOW and FENCE.\n"
-      "\n");
+      "\n"},
 
-  set("WINDOW",
+  {"WINDOW",
       "WINDOW\n"
       "\n"
       "        tells the turtle to enter window mode:  From now on, if the "
@@ -2042,9 +2035,9 @@ void Help::setGraphics() {
       "        anywhere on the plane.  (If you lose the turtle, HOME will "
       "bring\n"
       "        it back to the center of the window.)  Compare WRAP and FENCE.\n"
-      "\n");
+      "\n"},
 
-  set("FENCE",
+  {"FENCE",
       "FENCE\n"
       "\n"
       "        tells the turtle to enter fence mode:  From now on, if the "
@@ -2052,9 +2045,9 @@ void Help::setGraphics() {
       "        is asked to move past the boundary of the graphics window, it\n"
       "        will move as far as it can and then stop at the edge with an\n"
       "        \"out of bounds\" error message.  Compare WRAP and WINDOW.\n"
-      "\n");
+      "\n"},
 
-  set("FILL",
+  {"FILL",
       "FILL\n"
       "\n"
       "        fills in a region of the graphics window containing the turtle\n"
@@ -2062,31 +2055,31 @@ void Help::setGraphics() {
       "not\n"
       "        portable; it doesn't work for all machines, and may not work\n"
       "        exactly the same way on different machines.\n"
-      "\n");
+      "\n"},
 
-  set("FILLED", "FILLED color instructions\n"
-                "\n"
-                "        runs the instructions, remembering all points visited "
-                "by turtle\n"
-                "        motion commands, starting *and ending* with the "
-                "turtle's initial\n"
-                "        position.  Then draws (ignoring penmode) the "
-                "resulting polygon,\n"
-                "        in the current pen color, filling the polygon with "
-                "the given color,\n"
-                "        which can be a color number or an RGB list.  The "
-                "instruction list\n"
-                "        cannot include another FILLED invocation.\n"
-                "\n");
-
-  set("LABEL",
+  {"FILLED", "FILLED color instructions\n"
+             "\n"
+             "        runs the instructions, remembering all points visited "
+             "by turtle\n"
+             "        motion commands, starting *and ending* with the "
+             "turtle's initial\n"
+             "        position.  Then draws (ignoring penmode) the "
+             "resulting polygon,\n"
+             "        in the current pen color, filling the polygon with "
+             "the given color,\n"
+             "        which can be a color number or an RGB list.  The "
+             "instruction list\n"
+             "        cannot include another FILLED invocation.\n"
+             "\n"},
+
+  {"LABEL",
       "LABEL text\n"
       "\n"
       "        takes a word or list as input, and prints the input on the\n"
       "        graphics window, starting at the turtle's position.\n"
-      "\n");
+      "\n"},
 
-  set("SETLABELHEIGHT",
+  {"SETLABELHEIGHT",
       "SETLABELHEIGHT height\n"
       "\n"
       "        command (wxWidgets only).  Takes a positive integer argument "
@@ -2103,9 +2096,9 @@ void Help::setGraphics() {
       "        command is LABELSIZE, not LABELHEIGHT, because it tells you the "
       "width\n"
       "        as well as the height of characters in the current font.\n"
-      "\n");
+      "\n"},
 
-  set("TEXTSCREEN",
+  {"TEXTSCREEN",
       "TEXTSCREEN\n"
       "TS\n"
       "\n"
@@ -2113,11 +2106,11 @@ void Help::setGraphics() {
       "        space available in the text window (the window used for\n"
       "        interaction with Logo).  The details differ among machines.\n"
       "        Compare SPLITSCREEN and FULLSCREEN.\n"
-      "\n");
+      "\n"},
 
-  alt("TS", "TEXTSCREEN");
+  {"TS", NULL, "TEXTSCREEN"},
 
-  set("FULLSCREEN",
+  {"FULLSCREEN",
       "FULLSCREEN\n"
       "FS\n"
       "\n"
@@ -2140,25 +2133,25 @@ void Help::setGraphics() {
       "memory\n"
       "        to remember an invisible part of a drawing seems too "
       "expensive.]\n"
-      "\n");
-  ;
-  alt("FS", "FULLSCREEN");
-
-  set("SPLITSCREEN", "SPLITSCREEN\n"
-                     "SS\n"
-                     "\n"
-                     "        rearranges the size and position of windows to "
-                     "allow some room for\n"
-                     "        text interaction while also keeping most of the "
-                     "graphics window\n"
-                     "        visible.  The details differ among machines.  "
-                     "Compare TEXTSCREEN\n"
-                     "        and FULLSCREEN.\n"
-                     "\n");
-
-  alt("SS", "SPLITSCREEN");
-
-  set("SETSCRUNCH",
+      "\n"},
+
+  {"FS", NULL, "FULLSCREEN"},
+
+  {"SPLITSCREEN", "SPLITSCREEN\n"
+                  "SS\n"
+                  "\n"
+                  "        rearranges the size and position of windows to "
+                  "allow some room for\n"
+                  "        text interaction while also keeping most of the "
+                  "graphics window\n"
+                  "        visible.  The details differ among machines.  "
+                  "Compare TEXTSCREEN\n"
+                  "        and FULLSCREEN.\n"
+                  "\n"},
+
+  {"SS", NULL, "SPLITSCREEN"},
+
+  {"SETSCRUNCH",
       "SETSCRUNCH xscale yscale\n"
       "\n"
       "        adjusts the aspect ratio and scaling of the graphics display.\n"
@@ -2188,100 +2181,100 @@ void Help::setGraphics() {
       "        SETSCRUNCH are remembered in a file (called SCRUNCH.DAT) and "
       "are\n"
       "        automatically put into effect when a Logo session begins.\n"
-      "\n");
+      "\n"},
 
   //    TURTLE AND WINDOW QUERIES
   //    -------------------------
 
-  set("SHOWNP",
+  {"SHOWNP",
       "SHOWNP\n"
       "SHOWN?\n"
       "\n"
       "        outputs TRUE if the turtle is shown (visible), FALSE if the\n"
       "        turtle is hidden.  See SHOWTURTLE and HIDETURTLE.\n"
-      "\n");
+      "\n"},
 
-  alt("SHOWN?", "SHOWNP");
+  {"SHOWN?", NULL, "SHOWNP"},
 
-  set("SCREENMODE", "SCREENMODE\n"
-                    "\n"
-                    "        outputs the word TEXTSCREEN, SPLITSCREEN, or "
-                    "FULLSCREEN depending\n"
-                    "        on the current screen mode.\n"
-                    "\n");
+  {"SCREENMODE", "SCREENMODE\n"
+                 "\n"
+                 "        outputs the word TEXTSCREEN, SPLITSCREEN, or "
+                 "FULLSCREEN depending\n"
+                 "        on the current screen mode.\n"
+                 "\n"},
 
-  set("TURTLEMODE", "TURTLEMODE\n"
-                    "\n"
-                    "        outputs the word WRAP, FENCE, or WINDOW depending "
-                    "on the current\n"
-                    "        turtle mode.\n"
-                    "\n");
+  {"TURTLEMODE", "TURTLEMODE\n"
+                 "\n"
+                 "        outputs the word WRAP, FENCE, or WINDOW depending "
+                 "on the current\n"
+                 "        turtle mode.\n"
+                 "\n"},
 
-  set("LABELSIZE", "LABELSIZE\n"
-                   "\n"
-                   "        (wxWidgets only) outputs a list of two positive "
-                   "integers, the width\n"
-                   "        and height of characters displayed by LABEL "
-                   "measured in turtle steps\n"
-                   "        (which will be different from screen pixels if "
-                   "SETSCRUNCH has been\n"
-                   "        used).  There is no SETLABELSIZE because the width "
-                   "and height of a\n"
-                   "        font are not separately controllable, so the "
-                   "inverse of this operation\n"
-                   "        is SETLABELHEIGHT, which takes just one number for "
-                   "the desired height.\n"
-                   "\n");
+  {"LABELSIZE", "LABELSIZE\n"
+                "\n"
+                "        (wxWidgets only) outputs a list of two positive "
+                "integers, the width\n"
+                "        and height of characters displayed by LABEL "
+                "measured in turtle steps\n"
+                "        (which will be different from screen pixels if "
+                "SETSCRUNCH has been\n"
+                "        used).  There is no SETLABELSIZE because the width "
+                "and height of a\n"
+                "        font are not separately controllable, so the "
+                "inverse of this operation\n"
+                "        is SETLABELHEIGHT, which takes just one number for "
+                "the desired height.\n"
+                "\n"},
 
   //    PEN AND BACKGROUND CONTROL
   //    --------------------------
 
-  set("PENDOWN",
+  {"PENDOWN",
       "PENDOWN\n"
       "PD\n"
       "\n"
       "        sets the pen's position to DOWN, without changing its mode.\n"
-      "\n");
+      "\n"},
 
-  alt("PD", "PENDOWN");
+  {"PD", NULL, "PENDOWN"},
 
-  set("PENUP",
+  {"PENUP",
       "PENUP\n"
       "PU\n"
       "\n"
       "        sets the pen's position to UP, without changing its mode.\n"
-      "\n");
+      "\n"},
 
-  alt("PU", "PENUP");
+  {"PU", NULL, "PENUP"},
 
-  set("PENPAINT", "PENPAINT\n"
-                  "PPT\n"
-                  "\n"
-                  "        sets the pen's position to DOWN and mode to PAINT.\n"
-                  "\n");
+  {"PENPAINT", "PENPAINT\n"
+               "PPT\n"
+               "\n"
+               "        sets the pen's position to DOWN and mode to PAINT.\n"
+               "\n"},
 
-  alt("PPT", "PENPAINT");
+  {"PPT", NULL, "PENPAINT"},
 
-  set("PENERASE", "PENERASE\n"
-                  "PE\n"
-                  "\n"
-                  "        sets the pen's position to DOWN and mode to ERASE.\n"
-                  "\n");
+  {"PENERASE", "PENERASE\n"
+               "PE\n"
+               "\n"
+               "        sets the pen's position to DOWN and mode to ERASE.\n"
+               "\n"},
 
-  alt("PE", "PENERASE");
+  {"PE", NULL, "PENERASE"},
 
-  set("PENREVERSE",
+  {"PENREVERSE",
       "PENREVERSE\n"
       "PX\n"
       "\n"
       "        sets the pen's position to DOWN and mode to REVERSE.\n"
       "        (This may interact in system-dependent ways with use of "
       "color.)\n"
-      "\n");
+      "\n"},
 
-  alt("PX", "PENREVERSE");
+  {"PX", NULL, "PENREVERSE"},
 
-  set("SETPENCOLOR",
+  {"SETPENCOLOR",
       "SETPENCOLOR colornumber.or.rgblist\n"
       "SETPC colornumber.or.rgblist\n"
       "\n"
@@ -2301,26 +2294,26 @@ void Help::setGraphics() {
       "list of\n"
       "        three nonnegative numbers less than 100 specifying the percent\n"
       "        saturation of red, green, and blue in the desired color).\n"
-      "\n");
+      "\n"},
 
-  alt("SETPC", "SETPENCOLOR");
+  {"SETPC", NULL, "SETPENCOLOR"},
 
-  set("SETPALETTE", "SETPALETTE colornumber rgblist\n"
-                    "\n"
-                    "        sets the actual color corresponding to a given "
-                    "number, if allowed by\n"
-                    "        the hardware and operating system.  Colornumber "
-                    "must be an integer\n"
-                    "        greater than or equal to 8.  (Logo tries to keep "
-                    "the first 8 colors\n"
-                    "        constant.)  The second input is a list of three "
-                    "nonnegative numbers\n"
-                    "        less than 100 specifying the percent saturation "
-                    "of red, green, and\n"
-                    "        blue in the desired color.\n"
-                    "\n");
-
-  set("SETPENSIZE",
+  {"SETPALETTE", "SETPALETTE colornumber rgblist\n"
+                 "\n"
+                 "        sets the actual color corresponding to a given "
+                 "number, if allowed by\n"
+                 "        the hardware and operating system.  Colornumber "
+                 "must be an integer\n"
+                 "        greater than or equal to 8.  (Logo tries to keep "
+                 "the first 8 colors\n"
+                 "        constant.)  The second input is a list of three "
+                 "nonnegative numbers\n"
+                 "        less than 100 specifying the percent saturation "
+                 "of red, green, and\n"
+                 "        blue in the desired color.\n"
+                 "\n"},
+
+  {"SETPENSIZE",
       "SETPENSIZE size\n"
       "\n"
       "        sets the thickness of the pen.  The input is either a single "
@@ -2329,55 +2322,55 @@ void Help::setGraphics() {
       "        vertical thickness).  Some versions pay no attention to the "
       "second\n"
       "        number, but always have a square pen.\n"
-      "\n");
+      "\n"},
 
-  set("SETPENPATTERN",
+  {"SETPENPATTERN",
       "SETPENPATTERN pattern\n"
       "\n"
       "        sets hardware-dependent pen characteristics.  This command is\n"
       "        not guaranteed compatible between implementations on different\n"
       "        machines.\n"
-      "\n");
+      "\n"},
 
-  set("SETPEN", "SETPEN list                                             "
-                "(library procedure)\n"
-                "\n"
-                "        sets the pen's position, mode, thickness, and "
-                "hardware-dependent\n"
-                "        characteristics according to the information in the "
-                "input list, which\n"
-                "        should be taken from an earlier invocation of PEN.\n"
-                "\n");
-
-  set("SETBACKGROUND",
+  {"SETPEN", "SETPEN list                                             "
+             "(library procedure)\n"
+             "\n"
+             "        sets the pen's position, mode, thickness, and "
+             "hardware-dependent\n"
+             "        characteristics according to the information in the "
+             "input list, which\n"
+             "        should be taken from an earlier invocation of PEN.\n"
+             "\n"},
+
+  {"SETBACKGROUND",
       "SETBACKGROUND colornumber.or.rgblist\n"
       "SETBG colornumber.or.rgblist\n"
       "\n"
       "        set the screen background color by slot number or RGB values.\n"
       "        See SETPENCOLOR for details.\n"
-      "\n");
+      "\n"},
 
-  alt("SETBG", "SETBACKGROUND");
+  {"SETBG", NULL, "SETBACKGROUND"},
 
   //    PEN QUERIES
   //    -----------
 
-  set("PENDOWNP", "PENDOWNP\n"
-                  "PENDOWN?\n"
-                  "\n"
-                  "        outputs TRUE if the pen is down, FALSE if it's up.\n"
-                  "\n");
+  {"PENDOWNP", "PENDOWNP\n"
+               "PENDOWN?\n"
+               "\n"
+               "        outputs TRUE if the pen is down, FALSE if it's up.\n"
+               "\n"},
 
-  alt("PENDOWN?", "PENDOWNP");
+  {"PENDOWN?", NULL, "PENDOWNP"},
 
-  set("PENMODE",
+  {"PENMODE",
       "PENMODE\n"
       "\n"
       "        outputs one of the words PAINT, ERASE, or REVERSE according to\n"
       "        the current pen mode.\n"
-      "\n");
+      "\n"},
 
-  set("PENCOLOR",
+  {"PENCOLOR",
       "PENCOLOR\n"
       "PC\n"
       "\n"
@@ -2396,20 +2389,20 @@ void Help::setGraphics() {
       "\n"
       "        but other colors can be assigned to numbers by the PALETTE "
       "command.\n"
-      "\n");
+      "\n"},
 
-  alt("PC", "PENCOLOR");
+  {"PC", NULL, "PENCOLOR"},
 
-  set("PALETTE", "PALETTE colornumber\n"
-                 "\n"
-                 "        outputs a list of three nonnegative numbers less "
-                 "than 100 specifying\n"
-                 "        the percent saturation of red, green, and blue in "
-                 "the color associated\n"
-                 "        with the given number.\n"
-                 "\n");
-
-  set("PENSIZE",
+  {"PALETTE", "PALETTE colornumber\n"
+              "\n"
+              "        outputs a list of three nonnegative numbers less "
+              "than 100 specifying\n"
+              "        the percent saturation of red, green, and blue in "
+              "the color associated\n"
+              "        with the given number.\n"
+              "\n"},
+
+  {"PENSIZE",
       "PENSIZE\n"
       "\n"
       "\n"
@@ -2418,36 +2411,36 @@ void Help::setGraphics() {
       "        and vertical thickness of the turtle pen.  (In some "
       "implementations,\n"
       "        including wxWidgets, the two numbers are always equal.)\n"
-      "\n");
+      "\n"},
 
-  set("PENPATTERN", "PENPATTERN\n"
-                    "\n"
-                    "        outputs system-specific pen information.\n"
-                    "\n");
-
-  set("PEN", "PEN                                                     (library "
-             "procedure)\n"
-             "\n"
-             "        outputs a list containing the pen's position, mode, "
-             "thickness, and\n"
-             "        hardware-specific characteristics, for use by SETPEN.\n"
-             "\n");
-
-  set("BACKGROUND",
+  {"PENPATTERN", "PENPATTERN\n"
+                 "\n"
+                 "        outputs system-specific pen information.\n"
+                 "\n"},
+
+  {"PEN", "PEN                                                     (library "
+          "procedure)\n"
+          "\n"
+          "        outputs a list containing the pen's position, mode, "
+          "thickness, and\n"
+          "        hardware-specific characteristics, for use by SETPEN.\n"
+          "\n"},
+
+  {"BACKGROUND",
       "BACKGROUND\n"
       "BG\n"
       "\n"
       "        outputs the graphics background color, either as a slot number "
       "or\n"
       "        as an RGB list, whichever way it was set.  (See PENCOLOR.)\n"
-      "\n");
+      "\n"},
 
-  alt("BG", "BACKGROUND");
+  {"BG", NULL, "BACKGROUND"},
 
   //    SAVING AND LOADING PICTURES
   //    ---------------------------
 
-  set("SAVEPICT",
+  {"SAVEPICT",
       "SAVEPICT filename\n"
       "\n"
       "        command.  Writes a file with the specified name containing the\n"
@@ -2457,37 +2450,37 @@ void Help::setGraphics() {
       "        portable between platforms, nor is it readable by other "
       "programs.\n"
       "        See EPSPICT to export Logo graphics for other programs.\n"
-      "\n");
+      "\n"},
 
-  set("LOADPICT",
+  {"LOADPICT",
       "LOADPICT filename\n"
       "\n"
       "        command.  Reads the specified file, which must have been\n"
       "        written by a SAVEPICT command, and restores the graphics\n"
       "        window and color palette settings to the values stored in\n"
       "        the file.  Any drawing previously on the screen is cleared.\n"
-      "\n");
+      "\n"},
 
   //    MOUSE QUERIES
   //    -------------
 
-  set("MOUSEPOS", "MOUSEPOS\n"
-                  "\n"
-                  "        outputs the coordinates of the mouse, provided that "
-                  "it's within the\n"
-                  "        graphics window, in turtle coordinates.  If the "
-                  "mouse is outside the\n"
-                  "        graphics window, then the last position within the "
-                  "window is returned.\n"
-                  "        Exception:  If a mouse button is pressed within the "
-                  "graphics window\n"
-                  "        and held while the mouse is dragged outside the "
-                  "window, the mouse's\n"
-                  "        position is returned as if the window were big "
-                  "enough to include it.\n"
-                  "\n");
-
-  set("CLICKPOS",
+  {"MOUSEPOS", "MOUSEPOS\n"
+               "\n"
+               "        outputs the coordinates of the mouse, provided that "
+               "it's within the\n"
+               "        graphics window, in turtle coordinates.  If the "
+               "mouse is outside the\n"
+               "        graphics window, then the last position within the "
+               "window is returned.\n"
+               "        Exception:  If a mouse button is pressed within the "
+               "graphics window\n"
+               "        and held while the mouse is dragged outside the "
+               "window, the mouse's\n"
+               "        position is returned as if the window were big "
+               "enough to include it.\n"
+               "\n"},
+
+  {"CLICKPOS",
       "CLICKPOS\n"
       "\n"
       "        outputs the coordinates that the mouse was at when a mouse "
@@ -2495,39 +2488,39 @@ void Help::setGraphics() {
       "        was most recently pushed, provided that that position was "
       "within the\n"
       "        graphics window, in turtle coordinates.  (wxWidgets only)\n"
-      "\n");
+      "\n"},
 
-  set("BUTTONP", "BUTTONP\n"
-                 "BUTTON?\n"
-                 "\n"
-                 "        outputs TRUE if a mouse button is down and the mouse "
-                 "is over the\n"
-                 "        graphics window.  Once the button is down, BUTTONP "
-                 "remains true until\n"
-                 "        the button is released, even if the mouse is dragged "
-                 "out of the\n"
-                 "        graphics window.\n"
-                 "\n");
-
-  set("BUTTON?", "BUTTONP");
-
-  set("BUTTON", "BUTTON\n"
-                "\n"
-                "        outputs 0 if no mouse button has been pushed inside "
-                "the Logo window\n"
-                "        since the last call to BUTTON.  Otherwise, it outputs "
-                "an integer\n"
-                "        between 1 and 3 indicating which button was most "
-                "recently pressed.\n"
-                "        Ordinarily 1 means left, 2 means right, and 3 means "
-                "center, but\n"
-                "        operating systems may reconfigure these.\n"
-                "\n");
-}
-
-void Help::setWorkspaceManagement() {
-
-  set("TO",
+  {"BUTTONP", "BUTTONP\n"
+              "BUTTON?\n"
+              "\n"
+              "        outputs TRUE if a mouse button is down and the mouse "
+              "is over the\n"
+              "        graphics window.  Once the button is down, BUTTONP "
+              "remains true until\n"
+              "        the button is released, even if the mouse is dragged "
+              "out of the\n"
+              "        graphics window.\n"
+              "\n"},
+
+  {"BUTTON?", "BUTTONP"},
+
+  {"BUTTON", "BUTTON\n"
+             "\n"
+             "        outputs 0 if no mouse button has been pushed inside "
+             "the Logo window\n"
+             "        since the last call to BUTTON.  Otherwise, it outputs "
+             "an integer\n"
+             "        between 1 and 3 indicating which button was most "
+             "recently pressed.\n"
+             "        Ordinarily 1 means left, 2 means right, and 3 means "
+             "center, but\n"
+             "        operating systems may reconfigure these.\n"
+             "\n"},
+};
+
+static const HelpEntry workspaceManagementHelp[] = {
+
+  {"TO",
       "TO procname :input1 :input2 ...                         (special form)\n"
       "\n"
       "        command.  Prepares Logo to accept a procedure definition.  The\n"
@@ -2648,9 +2641,9 @@ void Help::setWorkspaceManagement() {
       "whatever\n"
       "        instructions you type become part of the definition until you\n"
       "        type a line containing only the word END.\n"
-      "\n");
+      "\n"},
 
-  set("DEFINE",
+  {"DEFINE",
       "DEFINE procname text\n"
       "\n"
       "        command.  Defines a procedure with name \"procname\" and text "
@@ -2672,9 +2665,9 @@ void Help::setWorkspaceManagement() {
       "        It is an error to redefine a primitive procedure unless the "
       "variable\n"
       "        REDEFP has the value TRUE.\n"
-      "\n");
+      "\n"},
 
-  set("TEXT",
+  {"TEXT",
       "TEXT procname\n"
       "\n"
       "        outputs the text of the procedure named \"procname\" in the "
@@ -2687,9 +2680,9 @@ void Help::setWorkspaceManagement() {
       "used\n"
       "        when the procedure was defined, such as continuation lines and\n"
       "        extra spaces.\n"
-      "\n");
+      "\n"},
 
-  set("FULLTEXT",
+  {"FULLTEXT",
       "FULLTEXT procname\n"
       "\n"
       "        outputs a representation of the procedure \"procname\" in "
@@ -2709,9 +2702,9 @@ void Help::setWorkspaceManagement() {
       "        look like a definition using TO.  Note: the output from "
       "FULLTEXT\n"
       "        is not suitable for use as input to DEFINE!\n"
-      "\n");
+      "\n"},
 
-  set("COPYDEF",
+  {"COPYDEF",
       "COPYDEF newname oldname\n"
       "\n"
       "        command.  Makes \"newname\" a procedure identical to "
@@ -2726,12 +2719,12 @@ void Help::setWorkspaceManagement() {
       "        Note: dialects of Logo differ as to the order of inputs to "
       "COPYDEF.\n"
       "        This dialect uses \"MAKE order,\" not \"NAME order.\"\n"
-      "\n");
+      "\n"},
 
   //    VARIABLE DEFINITION
   //    -------------------
 
-  set("MAKE",
+  {"MAKE",
       "MAKE varname value\n"
       "\n"
       "        command.  Assigns the value \"value\" to the variable named "
@@ -2741,16 +2734,16 @@ void Help::setWorkspaceManagement() {
       "        variable with the same name already exists, the value of that\n"
       "        variable is changed.  If not, a new global variable is "
       "created.\n"
-      "\n");
+      "\n"},
 
-  set("NAME",
+  {"NAME",
       "NAME value varname                                      (library "
       "procedure)\n"
       "\n"
       "        command.  Same as MAKE but with the inputs in reverse order.\n"
-      "\n");
+      "\n"},
 
-  set("LOCAL",
+  {"LOCAL",
       "LOCAL varname\n"
       "LOCAL varnamelist\n"
       "(LOCAL varname1 varname2 ...)\n"
@@ -2765,16 +2758,16 @@ void Help::setWorkspaceManagement() {
       "        must be assigned a value (e.g., with MAKE) before the "
       "procedure\n"
       "        attempts to read their value.\n"
-      "\n");
+      "\n"},
 
-  set("LOCALMAKE",
+  {"LOCALMAKE",
       "LOCALMAKE varname value                         (library procedure)\n"
       "\n"
       "        command.  Makes the named variable local, like LOCAL, and\n"
       "        assigns it the given value, like MAKE.\n"
-      "\n");
+      "\n"},
 
-  set("THING",
+  {"THING",
       "THING varname\n"
       ":quoted.varname\n"
       "\n"
@@ -2786,9 +2779,9 @@ void Help::setWorkspaceManagement() {
       "                                thing \"\n"
       "\n"
       "        so that :FOO means THING \"FOO.\n"
-      "\n");
+      "\n"},
 
-  set("GLOBAL",
+  {"GLOBAL",
       "GLOBAL varname\n"
       "GLOBAL varnamelist\n"
       "(GLOBAL varname1 varname2 ...)\n"
@@ -2807,34 +2800,34 @@ void Help::setWorkspaceManagement() {
       "        command does *not* make Logo use the global value instead of "
       "the\n"
       "        local one.\n"
-      "\n");
+      "\n"},
 
   //    PROPERTY LISTS
   //    --------------
 
-  set("PPROP",
+  {"PPROP",
       "PPROP plistname propname value\n"
       "\n"
       "        command.  Adds a property to the \"plistname\" property list\n"
       "        with name \"propname\" and value \"value\".\n"
-      "\n");
+      "\n"},
 
-  set("GPROP",
+  {"GPROP",
       "GPROP plistname propname\n"
       "\n"
       "        outputs the value of the \"propname\" property in the "
       "\"plistname\"\n"
       "        property list, or the empty list if there is no such property.\n"
-      "\n");
+      "\n"},
 
-  set("REMPROP",
+  {"REMPROP",
       "REMPROP plistname propname\n"
       "\n"
       "        command.  Removes the property named \"propname\" from the\n"
       "        property list named \"plistname\".\n"
-      "\n");
+      "\n"},
 
-  set("PLIST",
+  {"PLIST",
       "PLIST plistname\n"
       "\n"
       "        outputs a list whose odd-numbered members are the names, and\n"
@@ -2844,21 +2837,21 @@ void Help::setWorkspaceManagement() {
       "        of the actual property list; changing properties later will "
       "not\n"
       "        magically change a list output earlier by PLIST.\n"
-      "\n");
+      "\n"},
 
   //    PREDICATES
   //    ----------
 
-  set("PROCEDUREP",
+  {"PROCEDUREP",
       "PROCEDUREP name\n"
       "PROCEDURE? name\n"
       "\n"
       "        outputs TRUE if the input is the name of a procedure.\n"
-      "\n");
+      "\n"},
 
-  alt("PROCEDURE?", "PROCEDUREP");
+  {"PROCEDURE?", NULL, "PROCEDUREP"},
 
-  set("PRIMITIVEP",
+  {"PRIMITIVEP",
       "PRIMITIVEP name\n"
       "PRIMITIVE? name\n"
       "\n"
@@ -2866,46 +2859,46 @@ void Help::setWorkspaceManagement() {
       "        (one built into Logo).  Note that some of the procedures\n"
       "        described in this document are library procedures, not "
       "primitives.\n"
-      "\n");
+      "\n"},
 
-  alt("PRIMITIVE?", "PRIMITIVEP");
+  {"PRIMITIVE?", NULL, "PRIMITIVEP"},
 
-  set("DEFINEDP", "DEFINEDP name\n"
-                  "DEFINED? name\n"
-                  "\n"
-                  "        outputs TRUE if the input is the name of a "
-                  "user-defined procedure,\n"
-                  "        including a library procedure.\n"
-                  "\n");
+  {"DEFINEDP", "DEFINEDP name\n"
+               "DEFINED? name\n"
+               "\n"
+               "        outputs TRUE if the input is the name of a "
+               "user-defined procedure,\n"
+               "        including a library procedure.\n"
+               "\n"},
 
-  alt("DEFINED?", "DEFINEDP");
+  {"DEFINED?", NULL, "DEFINEDP"},
 
-  set("NAMEP", "NAMEP name\n"
-               "NAME? name\n"
-               "\n"
-               "        outputs TRUE if the input is the name of a variable.\n"
-               "\n");
+  {"NAMEP", "NAMEP name\n"
+            "NAME? name\n"
+            "\n"
+            "        outputs TRUE if the input is the name of a variable.\n"
+            "\n"},
 
-  alt("NAME?", "NAMEP");
+  {"NAME?", NULL, "NAMEP"},
 
-  set("PLISTP", "PLISTP name\n"
-                "PLIST? name\n"
-                "\n"
-                "        outputs TRUE if the input is the name of a *nonempty* "
-                "property list.\n"
-                "        (In principle every word is the name of a property "
-                "list; if you haven't\n"
-                "        put any properties in it, PLIST of that name outputs "
-                "an empty list,\n"
-                "        rather than giving an error message.)\n"
-                "\n");
+  {"PLISTP", "PLISTP name\n"
+             "PLIST? name\n"
+             "\n"
+             "        outputs TRUE if the input is the name of a *nonempty* "
+             "property list.\n"
+             "        (In principle every word is the name of a property "
+             "list; if you haven't\n"
+             "        put any properties in it, PLIST of that name outputs "
+             "an empty list,\n"
+             "        rather than giving an error message.)\n"
+             "\n"},
 
-  alt("PLIST?", "PLISTP");
+  {"PLIST?", NULL, "PLISTP"},
 
   //    QUERIES
   //    -------
 
-  set("CONTENTS",
+  {"CONTENTS",
       "CONTENTS\n"
       "\n"
       "        outputs a \"contents list,\" i.e., a list of three lists "
@@ -2913,30 +2906,30 @@ void Help::setWorkspaceManagement() {
       "        names of defined procedures, variables, and property lists\n"
       "        respectively.  This list includes all unburied named items in\n"
       "        the workspace.\n"
-      "\n");
+      "\n"},
 
-  set("BURIED",
+  {"BURIED",
       "BURIED\n"
       "\n"
       "        outputs a contents list including all buried named items in\n"
       "        the workspace.\n"
-      "\n");
+      "\n"},
 
-  set("TRACED",
+  {"TRACED",
       "TRACED\n"
       "\n"
       "        outputs a contents list including all traced named items in\n"
       "        the workspace.\n"
-      "\n");
+      "\n"},
 
-  set("STEPPED",
+  {"STEPPED",
       "STEPPED\n"
       "\n"
       "        outputs a contents list including all stepped named items in\n"
       "        the workspace.\n"
-      "\n");
+      "\n"},
 
-  set("PROCEDURES",
+  {"PROCEDURES",
       "PROCEDURES\n"
       "\n"
       "        outputs a list of the names of all unburied user-defined "
@@ -2945,9 +2938,9 @@ void Help::setWorkspaceManagement() {
       "        contents list.  (However, procedures that require a contents "
       "list\n"
       "        as input will accept this list.)\n"
-      "\n");
+      "\n"},
 
-  set("PRIMITIVES",
+  {"PRIMITIVES",
       "PRIMITIVES\n"
       "\n"
       "        outputs a list of the names of all primitive procedures\n"
@@ -2955,27 +2948,27 @@ void Help::setWorkspaceManagement() {
       "        contents list.  (However, procedures that require a contents "
       "list\n"
       "        as input will accept this list.)\n"
-      "\n");
+      "\n"},
 
-  set("NAMES", "NAMES\n"
-               "\n"
-               "        outputs a contents list consisting of an empty list "
-               "(indicating\n"
-               "        no procedure names) followed by a list of all unburied "
-               "variable\n"
-               "        names in the workspace.\n"
-               "\n");
-
-  set("PLISTS",
+  {"NAMES", "NAMES\n"
+            "\n"
+            "        outputs a contents list consisting of an empty list "
+            "(indicating\n"
+            "        no procedure names) followed by a list of all unburied "
+            "variable\n"
+            "        names in the workspace.\n"
+            "\n"},
+
+  {"PLISTS",
       "PLISTS\n"
       "\n"
       "        outputs a contents list consisting of two empty lists "
       "(indicating\n"
       "        no procedures or variables) followed by a list of all unburied\n"
       "        nonempty property lists in the workspace.\n"
-      "\n");
+      "\n"},
 
-  set("NAMELIST",
+  {"NAMELIST",
       "NAMELIST varname                                        (library "
       "procedure)\n"
       "NAMELIST varnamelist\n"
@@ -2986,9 +2979,9 @@ void Help::setWorkspaceManagement() {
       "        conjunction with workspace control procedures that require a "
       "contents\n"
       "        list as input.\n"
-      "\n");
+      "\n"},
 
-  set("PLLIST",
+  {"PLLIST",
       "PLLIST plname                                           (library "
       "procedure)\n"
       "PLLIST plnamelist\n"
@@ -2999,20 +2992,20 @@ void Help::setWorkspaceManagement() {
       "        conjunction with workspace control procedures that require a "
       "contents\n"
       "        list as input.\n"
-      "\n");
+      "\n"},
 
-  set("ARITY", "ARITY procedurename\n"
-               "\n"
-               "        outputs a list of three numbers: the minimum, default, "
-               "and maximum\n"
-               "        number of inputs for the procedure whose name is the "
-               "input.  It is an\n"
-               "        error if there is no such procedure.  A maximum of -1 "
-               "means that the\n"
-               "        number of inputs is unlimited.\n"
-               "\n");
-
-  set("NODES",
+  {"ARITY", "ARITY procedurename\n"
+            "\n"
+            "        outputs a list of three numbers: the minimum, default, "
+            "and maximum\n"
+            "        number of inputs for the procedure whose name is the "
+            "input.  It is an\n"
+            "        error if there is no such procedure.  A maximum of -1 "
+            "means that the\n"
+            "        number of inputs is unlimited.\n"
+            "\n"},
+
+  {"NODES",
       "NODES\n"
       "\n"
       "        outputs a list of two numbers.  The first represents the number "
@@ -3036,93 +3029,130 @@ void Help::setWorkspaceManagement() {
       "        iteration, since otherwise the maximum will include storage "
       "that\n"
       "        is unused but not yet collected.\n"
-      "\n");
+      "\n"
+      "        The two numbers are followed by a list for each memory pool\n"
+      "        (word, list, listnode, smalllistnode, array, and astnode).\n"
+      "        Each list contains the pool name, the number of blocks in use,\n"
+      "        the maximum number of blocks in use since the last invocation\n"
+      "        of NODES, and the number of blocks the pool has reserved.\n"
+      "\n"},
+
+  {"NODESTATS",
+      "NODESTATS\n"
+      "\n"
+      "        outputs a property list with an entry for each type of node\n"
+      "        (word, list, listnode, array, astnode, procedure, and error).\n"
+      "        The value of each entry is itself a property list holding the\n"
+      "        number of nodes of that type in use (LIVE), the maximum number\n"
+      "        in use (MAXLIVE), the bytes occupied by those nodes (BYTES and\n"
+      "        MAXBYTES, not counting the characters of words or the members\n"
+      "        of arrays), the number created since QLogo started (CREATED),\n"
+      "        and the number created since the last invocation of NODESTATS\n"
+      "        or NODESJSON (RECENT).  The maximums also restart then.\n"
+      "\n"},
+
+  {"NODESJSON",
+      "NODESJSON\n"
+      "\n"
+      "        outputs a word containing the information of NODESTATS as a\n"
+      "        JSON object.\n"
+      "\n"},
+
+  {"RECYCLE",
+      "RECYCLE\n"
+      "\n"
+      "        outputs the number of nodes freed by searching for circular\n"
+      "        list and array structures, made by .SETFIRST, .SETBF, or\n"
+      "        .SETITEM, that can no longer be reached.  Such structures are\n"
+      "        also freed automatically when enough of them may exist, and\n"
+      "        by GC.\n"
+      "\n"},
 
   //    INSPECTION
   //    ----------
 
-  set("PRINTOUT",
+  {"PRINTOUT",
       "PRINTOUT contentslist\n"
       "PO contentslist\n"
       "\n"
       "        command.  Prints to the write stream the definitions of all\n"
       "        procedures, variables, and property lists named in the input\n"
       "        contents list.\n"
-      "\n");
+      "\n"},
 
-  alt("PO", "PRINTOUT");
+  {"PO", NULL, "PRINTOUT"},
 
-  set("POALL",
+  {"POALL",
       "POALL                                                   (library "
       "procedure)\n"
       "\n"
       "        command.  Prints all unburied definitions in the workspace.\n"
       "        Abbreviates PO CONTENTS.\n"
-      "\n");
+      "\n"},
 
-  set("POPS",
+  {"POPS",
       "POPS                                                    (library "
       "procedure)\n"
       "\n"
       "        command.  Prints the definitions of all unburied procedures in\n"
       "        the workspace.  Abbreviates PO PROCEDURES.\n"
-      "\n");
+      "\n"},
 
-  set("PONS",
+  {"PONS",
       "PONS                                                    (library "
       "procedure)\n"
       "\n"
       "        command.  Prints the definitions of all unburied variables in\n"
       "        the workspace.  Abbreviates PO NAMES.\n"
-      "\n");
+      "\n"},
 
-  set("POPLS", "POPLS                                                   "
-               "(library procedure)\n"
-               "\n"
-               "        command.  Prints the contents of all unburied nonempty "
-               "property\n"
-               "        lists in the workspace.  Abbreviates PO PLISTS.\n"
-               "\n");
+  {"POPLS", "POPLS                                                   "
+            "(library procedure)\n"
+            "\n"
+            "        command.  Prints the contents of all unburied nonempty "
+            "property\n"
+            "        lists in the workspace.  Abbreviates PO PLISTS.\n"
+            "\n"},
 
-  set("PON",
+  {"PON",
       "PON varname                                             (library "
       "procedure)\n"
       "PON varnamelist\n"
       "\n"
       "        command.  Prints the definitions of the named variable(s).\n"
       "        Abbreviates PO NAMELIST varname(list).\n"
-      "\n");
-
-  set("POPL", "POPL plname                                             "
-              "(library procedure)\n"
-              "POPL plnamelist\n"
-              "\n"
-              "        command.  Prints the definitions of the named property "
-              "list(s).\n"
-              "        Abbreviates PO PLLIST plname(list).\n"
-              "\n");
-
-  set("POT",
+      "\n"},
+
+  {"POPL", "POPL plname                                             "
+           "(library procedure)\n"
+           "POPL plnamelist\n"
+           "\n"
+           "        command.  Prints the definitions of the named property "
+           "list(s).\n"
+           "        Abbreviates PO PLLIST plname(list).\n"
+           "\n"},
+
+  {"POT",
       "POT contentslist\n"
       "\n"
       "        command.  Prints the title lines of the named procedures and\n"
       "        the definitions of the named variables and property lists.\n"
       "        For property lists, the entire list is shown on one line\n"
       "        instead of as a series of PPROP instructions as in PO.\n"
-      "\n");
+      "\n"},
 
-  set("POTS",
+  {"POTS",
       "POTS                                                    (library "
       "procedure)\n"
       "\n"
       "        command.  Prints the title lines of all unburied procedures\n"
       "        in the workspace.  Abbreviates POT PROCEDURES.\n"
-      "\n");
+      "\n"},
 
   //    WORKSPACE CONTROL
   //    -----------------
 
-  set("ERASE",
+  {"ERASE",
       "ERASE contentslist\n"
       "ER contentslist\n"
       "\n"
@@ -3130,58 +3160,58 @@ void Help::setWorkspaceManagement() {
       "        and property lists named in the input.  Primitive procedures "
       "may\n"
       "        not be erased unless the variable REDEFP has the value TRUE.\n"
-      "\n");
+      "\n"},
 
-  alt("ER", "ERASE");
+  {"ER", NULL, "ERASE"},
 
-  set("ERALL",
+  {"ERALL",
       "ERALL\n"
       "\n"
       "        command.  Erases all unburied procedures, variables, and "
       "property\n"
       "        lists from the workspace.  Abbreviates ERASE CONTENTS.\n"
-      "\n");
+      "\n"},
 
-  set("ERPS",
+  {"ERPS",
       "ERPS\n"
       "\n"
       "        command.  Erases all unburied procedures from the workspace.\n"
       "        Abbreviates ERASE PROCEDURES.\n"
-      "\n");
+      "\n"},
 
-  set("ERNS",
+  {"ERNS",
       "ERNS\n"
       "\n"
       "        command.  Erases all unburied variables from the workspace.\n"
       "        Abbreviates ERASE NAMES.\n"
-      "\n");
+      "\n"},
 
-  set("ERPLS", "ERPLS\n"
-               "\n"
-               "        command.  Erases all unburied property lists from the "
-               "workspace.\n"
-               "        Abbreviates ERASE PLISTS.\n"
-               "\n");
-
-  set("ERN", "ERN varname                                             (library "
-             "procedure)\n"
-             "ERN varnamelist\n"
-             "\n"
-             "        command.  Erases from the workspace the variable(s) "
-             "named in the\n"
-             "        input.  Abbreviates ERASE NAMELIST varname(list).\n"
-             "\n");
-
-  set("ERPL", "ERPL plname                                             "
-              "(library procedure)\n"
-              "ERPL plnamelist\n"
-              "\n"
-              "        command.  Erases from the workspace the property "
-              "list(s) named in the\n"
-              "        input.  Abbreviates ERASE PLLIST plname(list).\n"
-              "\n");
-
-  set("BURY",
+  {"ERPLS", "ERPLS\n"
+            "\n"
+            "        command.  Erases all unburied property lists from the "
+            "workspace.\n"
+            "        Abbreviates ERASE PLISTS.\n"
+            "\n"},
+
+  {"ERN", "ERN varname                                             (library "
+          "procedure)\n"
+          "ERN varnamelist\n"
+          "\n"
+          "        command.  Erases from the workspace the variable(s) "
+          "named in the\n"
+          "        input.  Abbreviates ERASE NAMELIST varname(list).\n"
+          "\n"},
+
+  {"ERPL", "ERPL plname                                             "
+           "(library procedure)\n"
+           "ERPL plnamelist\n"
+           "\n"
+           "        command.  Erases from the workspace the property "
+           "list(s) named in the\n"
+           "        input.  Abbreviates ERASE PLLIST plname(list).\n"
+           "\n"},
+
+  {"BURY",
       "BURY contentslist\n"
       "\n"
       "        command.  Buries the procedures, variables, and property lists\n"
@@ -3190,45 +3220,45 @@ void Help::setWorkspaceManagement() {
       "        output by CONTENTS, PROCEDURES, VARIABLES, and PLISTS, but is\n"
       "        included in the list output by BURIED.  By implication, buried\n"
       "        things are not printed by POALL or saved by SAVE.\n"
-      "\n");
+      "\n"},
 
-  set("BURYALL", "BURYALL                                                 "
-                 "(library procedure)\n"
-                 "\n"
-                 "        command.  Abbreviates BURY CONTENTS.\n"
-                 "\n");
+  {"BURYALL", "BURYALL                                                 "
+              "(library procedure)\n"
+              "\n"
+              "        command.  Abbreviates BURY CONTENTS.\n"
+              "\n"},
 
-  set("BURYNAME", "BURYNAME varname                                        "
-                  "(library procedure)\n"
-                  "BURYNAME varnamelist\n"
-                  "\n"
-                  "        command.  Abbreviates BURY NAMELIST varname(list).\n"
-                  "\n");
+  {"BURYNAME", "BURYNAME varname                                        "
+               "(library procedure)\n"
+               "BURYNAME varnamelist\n"
+               "\n"
+               "        command.  Abbreviates BURY NAMELIST varname(list).\n"
+               "\n"},
 
-  set("UNBURY", "UNBURY contentslist\n"
+  {"UNBURY", "UNBURY contentslist\n"
+             "\n"
+             "        command.  Unburies the procedures, variables, and "
+             "property lists\n"
+             "        named in the input.  That is, the named items will be "
+             "returned to\n"
+             "        view in CONTENTS, etc.\n"
+             "\n"},
+
+  {"UNBURYALL", "UNBURYALL                                               "
+                "(library procedure)\n"
                 "\n"
-                "        command.  Unburies the procedures, variables, and "
-                "property lists\n"
-                "        named in the input.  That is, the named items will be "
-                "returned to\n"
-                "        view in CONTENTS, etc.\n"
-                "\n");
-
-  set("UNBURYALL", "UNBURYALL                                               "
-                   "(library procedure)\n"
-                   "\n"
-                   "        command.  Abbreviates UNBURY BURIED.\n"
-                   "\n");
+                "        command.  Abbreviates UNBURY BURIED.\n"
+                "\n"},
 
-  set("UNBURYNAME",
+  {"UNBURYNAME",
       "UNBURYNAME varname                                      (library "
       "procedure)\n"
       "UNBURYNAME varnamelist\n"
       "\n"
       "        command.  Abbreviates UNBURY NAMELIST varname(list).\n"
-      "\n");
+      "\n"},
 
-  set("BURIEDP",
+  {"BURIEDP",
       "BURIEDP contentslist\n"
       "BURIED? contentslist\n"
       "\n"
@@ -3241,11 +3271,11 @@ void Help::setWorkspaceManagement() {
       "        naming a procedure, but a contents list is allowed so that you "
       "can\n"
       "        BURIEDP [[] [VARIABLE]] or BURIEDP [[] [] [PROPLIST]].\n"
-      "\n");
+      "\n"},
 
-  alt("BURIED?", "BURIEDP");
+  {"BURIED?", NULL, "BURIEDP"},
 
-  set("TRACE",
+  {"TRACE",
       "TRACE contentslist\n"
       "\n"
       "        command.  Marks the named items for tracing.  A message is "
@@ -3258,14 +3288,14 @@ void Help::setWorkspaceManagement() {
       "        variable using MAKE.  A message is printed whenever a new "
       "property\n"
       "        is given to a traced property list using PPROP.\n"
-      "\n");
+      "\n"},
 
-  set("UNTRACE", "UNTRACE contentslist\n"
-                 "\n"
-                 "        command.  Turns off tracing for the named items.\n"
-                 "\n");
+  {"UNTRACE", "UNTRACE contentslist\n"
+              "\n"
+              "        command.  Turns off tracing for the named items.\n"
+              "\n"},
 
-  set("TRACEDP",
+  {"TRACEDP",
       "TRACEDP contentslist\n"
       "TRACED? contentslist\n"
       "\n"
@@ -3278,11 +3308,11 @@ void Help::setWorkspaceManagement() {
       "        naming a procedure, but a contents list is allowed so that you "
       "can\n"
       "        TRACEDP [[] [VARIABLE]] or TRACEDP [[] [] [PROPLIST]].\n"
-      "\n");
-  ;
-  alt("TRACED?", "TRACEDP");
+      "\n"},
 
-  set("STEP",
+  {"TRACED?", NULL, "TRACEDP"},
+
+  {"STEP",
       "STEP contentslist\n"
       "\n"
       "        command.  Marks the named items for stepping.  Whenever a "
@@ -3297,14 +3327,14 @@ void Help::setWorkspaceManagement() {
       "of\n"
       "        the same name is created either as a procedure input or by the\n"
       "        LOCAL command.\n"
-      "\n");
+      "\n"},
 
-  set("UNSTEP", "UNSTEP contentslist\n"
-                "\n"
-                "        command.  Turns off stepping for the named items.\n"
-                "\n");
+  {"UNSTEP", "UNSTEP contentslist\n"
+             "\n"
+             "        command.  Turns off stepping for the named items.\n"
+             "\n"},
 
-  set("STEPPEDP",
+  {"STEPPEDP",
       "STEPPEDP contentslist\n"
       "STEPPED? contentslist\n"
       "\n"
@@ -3317,11 +3347,11 @@ void Help::setWorkspaceManagement() {
       "        input, naming a procedure, but a contents list is allowed so "
       "that you\n"
       "        can STEPPEDP [[] [VARIABLE]] or STEPPEDP [[] [] [PROPLIST]].\n"
-      "\n");
+      "\n"},
 
-  alt("STEPPED?", "STEPPEDP");
+  {"STEPPED?", NULL, "STEPPEDP"},
 
-  set("EDIT",
+  {"EDIT",
       "EDIT contentslist\n"
       "ED contentslist\n"
       "(EDIT)\n"
@@ -3371,11 +3401,11 @@ void Help::setWorkspaceManagement() {
       "        input and without parentheses provided that nothing follows it "
       "on\n"
       "        the instruction line.\n"
-      "\n");
+      "\n"},
 
-  alt("ED", "EDIT");
+  {"ED", NULL, "EDIT"},
 
-  set("EDITFILE",
+  {"EDITFILE",
       "EDITFILE filename\n"
       "\n"
       "        command.  Starts the Logo editor, like EDIT, but instead of "
@@ -3393,47 +3423,47 @@ void Help::setWorkspaceManagement() {
       "which\n"
       "        definitions appear, maintaining comments in the file, and so "
       "on.\n"
-      "\n");
+      "\n"},
 
-  set("EDALL", "EDALL                                                   "
-               "(library procedure)\n"
-               "\n"
-               "        command.  Abbreviates EDIT CONTENTS.\n"
-               "\n");
-
-  set("EDPS", "EDPS                                                    "
-              "(library procedure)\n"
-              "\n"
-              "        command.  Abbreviates EDIT PROCEDURES.\n"
-              "\n");
-
-  set("EDNS", "EDNS                                                    "
-              "(library procedure)\n"
-              "\n"
-              "        command.  Abbreviates EDIT NAMES.\n"
-              "\n");
-
-  set("EDPLS", "EDPLS                                                   "
-               "(library procedure)\n"
-               "\n"
-               "        command.  Abbreviates EDIT PLISTS.\n"
-               "\n");
-
-  set("EDN", "EDN varname                                             (library "
-             "procedure)\n"
-             "EDN varnamelist\n"
-             "\n"
-             "        command.  Abbreviates EDIT NAMELIST varname(list).\n"
-             "\n");
-
-  set("EDPL", "EDPL plname                                             "
-              "(library procedure)\n"
-              "EDPL plnamelist\n"
-              "\n"
-              "        command.  Abbreviates EDIT PLLIST plname(list).\n"
-              "\n");
-
-  set("SAVE",
+  {"EDALL", "EDALL                                                   "
+            "(library procedure)\n"
+            "\n"
+            "        command.  Abbreviates EDIT CONTENTS.\n"
+            "\n"},
+
+  {"EDPS", "EDPS                                                    "
+           "(library procedure)\n"
+           "\n"
+           "        command.  Abbreviates EDIT PROCEDURES.\n"
+           "\n"},
+
+  {"EDNS", "EDNS                                                    "
+           "(library procedure)\n"
+           "\n"
+           "        command.  Abbreviates EDIT NAMES.\n"
+           "\n"},
+
+  {"EDPLS", "EDPLS                                                   "
+            "(library procedure)\n"
+            "\n"
+            "        command.  Abbreviates EDIT PLISTS.\n"
+            "\n"},
+
+  {"EDN", "EDN varname                                             (library "
+          "procedure)\n"
+          "EDN varnamelist\n"
+          "\n"
+          "        command.  Abbreviates EDIT NAMELIST varname(list).\n"
+          "\n"},
+
+  {"EDPL", "EDPL plname                                             "
+           "(library procedure)\n"
+           "EDPL plnamelist\n"
+           "\n"
+           "        command.  Abbreviates EDIT PLLIST plname(list).\n"
+           "\n"},
+
+  {"SAVE",
       "SAVE filename\n"
       "\n"
       "        command.  Saves the definitions of all unburied procedures,\n"
@@ -3457,9 +3487,9 @@ void Help::setWorkspaceManagement() {
       "        filename from the most recent LOAD or SAVE command will be "
       "used.  (It\n"
       "        is an error if there has been no previous LOAD or SAVE.)\n"
-      "\n");
+      "\n"},
 
-  set("SAVEL",
+  {"SAVEL",
       "SAVEL contentslist filename                             (library "
       "procedure)\n"
       "\n"
@@ -3467,9 +3497,9 @@ void Help::setWorkspaceManagement() {
       "and\n"
       "        property lists specified by \"contentslist\" to the file named\n"
       "        \"filename\".\n"
-      "\n");
+      "\n"},
 
-  set("LOAD",
+  {"LOAD",
       "LOAD filename\n"
       "\n"
       "        command.  Reads instructions from the named file and executes\n"
@@ -3486,18 +3516,18 @@ void Help::setWorkspaceManagement() {
       "if\n"
       "        LOADNOISILY is FALSE or undefined, TO commands in the file are\n"
       "        carried out silently.\n"
-      "\n");
+      "\n"},
 
-  set("CSLSLOAD", "CSLSLOAD name\n"
-                  "\n"
-                  "        command.  Loads the named file, like LOAD, but from "
-                  "the directory\n"
-                  "        containing the Computer Science Logo Style programs "
-                  "instead of the\n"
-                  "        current user's directory.\n"
-                  "\n");
-
-  set("HELP",
+  {"CSLSLOAD", "CSLSLOAD name\n"
+               "\n"
+               "        command.  Loads the named file, like LOAD, but from "
+               "the directory\n"
+               "        containing the Computer Science Logo Style programs "
+               "instead of the\n"
+               "        current user's directory.\n"
+               "\n"},
+
+  {"HELP",
       "HELP name\n"
       "(HELP)\n"
       "\n"
@@ -3520,27 +3550,27 @@ void Help::setWorkspaceManagement() {
       "        input and without parentheses provided that nothing follows it "
       "on\n"
       "        the instruction line.\n"
-      "\n");
+      "\n"},
 
-  set("SETCSLSLOC", "SETCSLSLOC path\n"
-                    "\n"
-                    "        command.  Tells Logo to use the specified "
-                    "directory for the CSLSLOAD\n"
-                    "        command, instead of the default directory.  The "
-                    "format of a path\n"
-                    "        depends on your operating system.\n"
-                    "\n");
-}
-
-void Help::setControlStructures() {
-  set("RUN",
+  {"SETCSLSLOC", "SETCSLSLOC path\n"
+                 "\n"
+                 "        command.  Tells Logo to use the specified "
+                 "directory for the CSLSLOAD\n"
+                 "        command, instead of the default directory.  The "
+                 "format of a path\n"
+                 "        depends on your operating system.\n"
+                 "\n"},
+};
+
+static const HelpEntry controlStructuresHelp[] = {
+  {"RUN",
       "RUN instructionlist\n"
       "\n"
       "        command or operation.  Runs the Logo instructions in the input\n"
       "        list; outputs if the list contains an expression that outputs.\n"
-      "\n");
+      "\n"},
 
-  set("RUNRESULT",
+  {"RUNRESULT",
       "RUNRESULT instructionlist\n"
       "\n"
       "        runs the instructions in the input; outputs an empty list if\n"
@@ -3552,23 +3582,23 @@ void Help::setControlStructures() {
       "                make \"result runresult [something]\n"
       "                if emptyp :result [stop]\n"
       "                output first :result\n"
-      "\n");
+      "\n"},
 
-  set("REPEAT", "REPEAT num instructionlist\n"
-                "\n"
-                "        command.  Runs the \"instructionlist\" repeatedly, "
-                "\"num\" times.\n"
-                "\n");
+  {"REPEAT", "REPEAT num instructionlist\n"
+             "\n"
+             "        command.  Runs the \"instructionlist\" repeatedly, "
+             "\"num\" times.\n"
+             "\n"},
 
-  set("FOREVER", "FOREVER instructionlist\n"
-                 "\n"
-                 "        command.  Runs the \"instructionlist\" repeatedly, "
-                 "until something\n"
-                 "        inside the instructionlist (such as STOP or THROW) "
-                 "makes it stop.\n"
-                 "\n");
+  {"FOREVER", "FOREVER instructionlist\n"
+              "\n"
+              "        command.  Runs the \"instructionlist\" repeatedly, "
+              "until something\n"
+              "        inside the instructionlist (such as STOP or THROW) "
+              "makes it stop.\n"
+              "\n"},
 
-  set("REPCOUNT",
+  {"REPCOUNT",
       "REPCOUNT\n"
       "\n"
       "        outputs the repetition count of the innermost current REPEAT "
@@ -3580,9 +3610,9 @@ void Help::setControlStructures() {
       "is\n"
       "        inside the template input to a higher order procedure such as\n"
       "        FOREACH, in which case # has a different meaning.\n"
-      "\n");
+      "\n"},
 
-  set("IF",
+  {"IF",
       "IF tf instructionlist\n"
       "(IF tf instructionlist1 instructionlist2)\n"
       "\n"
@@ -3593,9 +3623,9 @@ void Help::setControlStructures() {
       "IFELSE,\n"
       "        as described below.)  It is an error if the first input is not\n"
       "        either TRUE or FALSE.\n"
-      "\n");
+      "\n"},
 
-  set("IFELSE",
+  {"IFELSE",
       "IFELSE tf instructionlist1 instructionlist2\n"
       "\n"
       "        command or operation.  If the first input has the value TRUE, "
@@ -3605,9 +3635,9 @@ void Help::setControlStructures() {
       "        then IFELSE runs the third input.  IFELSE outputs a value if "
       "the\n"
       "        instructionlist contains an expression that outputs a value.\n"
-      "\n");
+      "\n"},
 
-  set("TEST",
+  {"TEST",
       "TEST tf\n"
       "\n"
       "        command.  Remembers its input, which must be TRUE or FALSE, for "
@@ -3617,42 +3647,42 @@ void Help::setControlStructures() {
       "        to the procedure in which it is used; any corresponding IFTRUE "
       "or\n"
       "        IFFALSE must be in the same procedure or a subprocedure.\n"
-      "\n");
+      "\n"},
 
-  set("IFTRUE", "IFTRUE instructionlist\n"
-                "IFT instructionlist\n"
-                "\n"
-                "        command.  Runs its input if the most recent TEST "
-                "instruction had\n"
-                "        a TRUE input.  The TEST must have been in the same "
-                "procedure or a\n"
-                "        superprocedure.\n"
-                "\n");
+  {"IFTRUE", "IFTRUE instructionlist\n"
+             "IFT instructionlist\n"
+             "\n"
+             "        command.  Runs its input if the most recent TEST "
+             "instruction had\n"
+             "        a TRUE input.  The TEST must have been in the same "
+             "procedure or a\n"
+             "        superprocedure.\n"
+             "\n"},
 
-  alt("IFT", "IFTRUE");
+  {"IFT", NULL, "IFTRUE"},
 
-  set("IFFALSE", "IFFALSE instructionlist\n"
-                 "IFF instructionlist\n"
-                 "\n"
-                 "        command.  Runs its input if the most recent TEST "
-                 "instruction had\n"
-                 "        a FALSE input.  The TEST must have been in the same "
-                 "procedure or a\n"
-                 "        superprocedure.\n"
-                 "\n");
+  {"IFFALSE", "IFFALSE instructionlist\n"
+              "IFF instructionlist\n"
+              "\n"
+              "        command.  Runs its input if the most recent TEST "
+              "instruction had\n"
+              "        a FALSE input.  The TEST must have been in the same "
+              "procedure or a\n"
+              "        superprocedure.\n"
+              "\n"},
 
-  alt("IFF", "IFFALSE");
+  {"IFF", NULL, "IFFALSE"},
 
-  set("STOP",
+  {"STOP",
       "STOP\n"
       "\n"
       "        command.  Ends the running of the procedure in which it "
       "appears.\n"
       "        Control is returned to the context in which that procedure was\n"
       "        invoked.  The stopped procedure does not output a value.\n"
-      "\n");
+      "\n"},
 
-  set("OUTPUT",
+  {"OUTPUT",
       "OUTPUT value\n"
       "OP value\n"
       "\n"
@@ -3663,11 +3693,11 @@ void Help::setControlStructures() {
       "        it was invoked.  Don't be confused: OUTPUT itself is a "
       "command,\n"
       "        but the procedure that invokes OUTPUT is an operation.\n"
-      "\n");
+      "\n"},
 
-  alt("OP", "OUTPUT");
+  {"OP", NULL, "OUTPUT"},
 
-  set("CATCH",
+  {"CATCH",
       "CATCH tag instructionlist\n"
       "\n"
       "        command or operation.  Runs its second input.  Outputs if that\n"
@@ -3695,9 +3725,9 @@ void Help::setControlStructures() {
       "        printing the error message.  Typically the value of ERRACT, if "
       "any,\n"
       "        is the list [PAUSE].)\n"
-      "\n");
+      "\n"},
 
-  set("THROW",
+  {"THROW",
       "THROW tag\n"
       "(THROW tag value)\n"
       "\n"
@@ -3745,26 +3775,26 @@ void Help::setControlStructures() {
       "operating\n"
       "        system, without printing the usual parting message and without\n"
       "        deleting any editor temporary file written by EDIT.\n"
-      "\n");
+      "\n"},
 
-  set("ERROR", "ERROR\n"
-               "\n"
-               "        outputs a list describing the error just caught, if "
-               "any.  If there was\n"
-               "        not an error caught since the last use of ERROR, the "
-               "empty list will\n"
-               "        be output.  The error list contains four members: an "
-               "integer code\n"
-               "        corresponding to the type of error, the text of the "
-               "error message (as\n"
-               "        a single word including spaces), the name of the "
-               "procedure in which\n"
-               "        the error occurred, and the instruction line on which "
-               "the error\n"
-               "        occurred.\n"
-               "\n");
-
-  set("PAUSE",
+  {"ERROR", "ERROR\n"
+            "\n"
+            "        outputs a list describing the error just caught, if "
+            "any.  If there was\n"
+            "        not an error caught since the last use of ERROR, the "
+            "empty list will\n"
+            "        be output.  The error list contains four members: an "
+            "integer code\n"
+            "        corresponding to the type of error, the text of the "
+            "error message (as\n"
+            "        a single word including spaces), the name of the "
+            "procedure in which\n"
+            "        the error occurred, and the instruction line on which "
+            "the error\n"
+            "        occurred.\n"
+            "\n"},
+
+  {"PAUSE",
       "PAUSE\n"
       "\n"
       "        command or operation.  Enters an interactive pause.  The user "
@@ -3792,9 +3822,9 @@ void Help::setControlStructures() {
       "        normally control-\\ for Unix, control-W for DOS, or "
       "command-comma for\n"
       "        Mac) will also enter a pause.\n"
-      "\n");
+      "\n"},
 
-  set("CONTINUE",
+  {"CONTINUE",
       "CONTINUE value\n"
       "CO value\n"
       "(CONTINUE)\n"
@@ -3811,11 +3841,11 @@ void Help::setControlStructures() {
       "        input and without parentheses provided that nothing follows it "
       "on\n"
       "        the instruction line.\n"
-      "\n");
+      "\n"},
 
-  alt("CO", "CONTINUE");
+  {"CO", NULL, "CONTINUE"},
 
-  set("WAIT",
+  {"WAIT",
       "WAIT time\n"
       "\n"
       "        command.  Delays further execution for \"time\" 60ths of a "
@@ -3824,15 +3854,15 @@ void Help::setControlStructures() {
       "to\n"
       "        be printed immediately.  WAIT 0 can be used to achieve this\n"
       "        buffer flushing without actually waiting.\n"
-      "\n");
+      "\n"},
 
-  set("BYE",
+  {"BYE",
       "BYE\n"
       "\n"
       "        command.  Exits from Logo; returns to the operating system.\n"
-      "\n");
+      "\n"},
 
-  set(".MAYBEOUTPUT",
+  {".MAYBEOUTPUT",
       ".MAYBEOUTPUT value                                      (special form)\n"
       "\n"
       "        works like OUTPUT except that the expression that provides the\n"
@@ -3857,36 +3887,36 @@ void Help::setControlStructures() {
       "        (Ordinarily, it should be an error if the expression that's\n"
       "        supposed to provide an input to something doesn't have a "
       "value.)\n"
-      "\n");
-
-  set("GOTO", "GOTO word\n"
-              "\n"
-              "        command.  Looks for a TAG command with the same input "
-              "in the same\n"
-              "        procedure, and continues running the procedure from the "
-              "location of\n"
-              "        that TAG.  It is meaningless to use GOTO outside of a "
-              "procedure.\n"
-              "\n");
-
-  set("TAG", "TAG quoted.word\n"
+      "\n"},
+
+  {"GOTO", "GOTO word\n"
+           "\n"
+           "        command.  Looks for a TAG command with the same input "
+           "in the same\n"
+           "        procedure, and continues running the procedure from the "
+           "location of\n"
+           "        that TAG.  It is meaningless to use GOTO outside of a "
+           "procedure.\n"
+           "\n"},
+
+  {"TAG", "TAG quoted.word\n"
+          "\n"
+          "        command.  Does nothing.  The input must be a literal "
+          "word following\n"
+          "        a quotation mark (\"), not the result of a computation.  "
+          "Tags are\n"
+          "        used by the GOTO command.\n"
+          "\n"},
+
+  {"IGNORE", "IGNORE value                                            "
+             "(library procedure)\n"
              "\n"
-             "        command.  Does nothing.  The input must be a literal "
-             "word following\n"
-             "        a quotation mark (\"), not the result of a computation.  "
-             "Tags are\n"
-             "        used by the GOTO command.\n"
-             "\n");
-
-  set("IGNORE", "IGNORE value                                            "
-                "(library procedure)\n"
-                "\n"
-                "        command.  Does nothing.  Used when an expression is "
-                "evaluated for\n"
-                "        a side effect and its actual value is unimportant.\n"
-                "\n");
+             "        command.  Does nothing.  Used when an expression is "
+             "evaluated for\n"
+             "        a side effect and its actual value is unimportant.\n"
+             "\n"},
 
-  set("`",
+  {"`",
       "` list                                                  (library "
       "procedure)\n"
       "\n"
@@ -3932,9 +3962,9 @@ void Help::setControlStructures() {
       "                ?make \"name2 \"y\n"
       "                ? show `[a `[b ,:,:name1 ,\",:name2 d] e]\n"
       "                [a ` [b , [:x] , [\"y] d] e]\n"
-      "\n");
+      "\n"},
 
-  set("FOR",
+  {"FOR",
       "FOR forcontrol instructionlist                          (library "
       "procedure)\n"
       "\n"
@@ -3983,65 +4013,65 @@ void Help::setControlStructures() {
       "                5\n"
       "                6.5\n"
       "                ?\n"
-      "\n");
+      "\n"},
 
-  set("DO.WHILE", "DO.WHILE instructionlist tfexpression                   "
-                  "(library procedure)\n"
-                  "\n"
-                  "        command.  Repeatedly evaluates the "
-                  "\"instructionlist\" as long as the\n"
-                  "        evaluated \"tfexpression\" remains TRUE.  Evaluates "
-                  "the first input\n"
-                  "        first, so the \"instructionlist\" is always run at "
-                  "least once.  The\n"
-                  "        \"tfexpression\" must be an expressionlist whose "
-                  "value when evaluated\n"
-                  "        is TRUE or FALSE.\n"
-                  "\n");
-
-  set("WHILE", "WHILE tfexpression instructionlist                      "
+  {"DO.WHILE", "DO.WHILE instructionlist tfexpression                   "
                "(library procedure)\n"
                "\n"
-               "        command.  Repeatedly evaluates the \"instructionlist\" "
-               "as long as the\n"
+               "        command.  Repeatedly evaluates the "
+               "\"instructionlist\" as long as the\n"
                "        evaluated \"tfexpression\" remains TRUE.  Evaluates "
                "the first input\n"
-               "        first, so the \"instructionlist\" may never be run at "
-               "all.  The\n"
-               "        \"tfexpression\" must be an expressionlist whose value "
-               "when evaluated\n"
+               "        first, so the \"instructionlist\" is always run at "
+               "least once.  The\n"
+               "        \"tfexpression\" must be an expressionlist whose "
+               "value when evaluated\n"
                "        is TRUE or FALSE.\n"
-               "\n");
+               "\n"},
 
-  set("DO.UNTIL", "DO.UNTIL instructionlist tfexpression                   "
-                  "(library procedure)\n"
-                  "\n"
-                  "        command.  Repeatedly evaluates the "
-                  "\"instructionlist\" as long as the\n"
-                  "        evaluated \"tfexpression\" remains FALSE.  "
-                  "Evaluates the first input\n"
-                  "        first, so the \"instructionlist\" is always run at "
-                  "least once.  The\n"
-                  "        \"tfexpression\" must be an expressionlist whose "
-                  "value when evaluated\n"
-                  "        is TRUE or FALSE.\n"
-                  "\n");
-
-  set("UNTIL", "UNTIL tfexpression instructionlist                      "
+  {"WHILE", "WHILE tfexpression instructionlist                      "
+            "(library procedure)\n"
+            "\n"
+            "        command.  Repeatedly evaluates the \"instructionlist\" "
+            "as long as the\n"
+            "        evaluated \"tfexpression\" remains TRUE.  Evaluates "
+            "the first input\n"
+            "        first, so the \"instructionlist\" may never be run at "
+            "all.  The\n"
+            "        \"tfexpression\" must be an expressionlist whose value "
+            "when evaluated\n"
+            "        is TRUE or FALSE.\n"
+            "\n"},
+
+  {"DO.UNTIL", "DO.UNTIL instructionlist tfexpression                   "
                "(library procedure)\n"
                "\n"
-               "        command.  Repeatedly evaluates the \"instructionlist\" "
-               "as long as the\n"
-               "        evaluated \"tfexpression\" remains FALSE.  Evaluates "
-               "the first input\n"
-               "        first, so the \"instructionlist\" may never be run at "
-               "all.  The\n"
-               "        \"tfexpression\" must be an expressionlist whose value "
-               "when evaluated\n"
+               "        command.  Repeatedly evaluates the "
+               "\"instructionlist\" as long as the\n"
+               "        evaluated \"tfexpression\" remains FALSE.  "
+               "Evaluates the first input\n"
+               "        first, so the \"instructionlist\" is always run at "
+               "least once.  The\n"
+               "        \"tfexpression\" must be an expressionlist whose "
+               "value when evaluated\n"
                "        is TRUE or FALSE.\n"
-               "\n");
+               "\n"},
 
-  set("CASE",
+  {"UNTIL", "UNTIL tfexpression instructionlist                      "
+            "(library procedure)\n"
+            "\n"
+            "        command.  Repeatedly evaluates the \"instructionlist\" "
+            "as long as the\n"
+            "        evaluated \"tfexpression\" remains FALSE.  Evaluates "
+            "the first input\n"
+            "        first, so the \"instructionlist\" may never be run at "
+            "all.  The\n"
+            "        \"tfexpression\" must be an expressionlist whose value "
+            "when evaluated\n"
+            "        is TRUE or FALSE.\n"
+            "\n"},
+
+  {"CASE",
       "CASE value clauses                                      (library "
       "procedure)\n"
       "\n"
@@ -4069,9 +4099,9 @@ void Help::setControlStructures() {
       "                output case :letter [ [[a e i o u] \"true] [else "
       "\"false] ]\n"
       "                end\n"
-      "\n");
+      "\n"},
 
-  set("COND",
+  {"COND",
       "COND clauses                                            (library "
       "procedure)\n"
       "\n"
@@ -4105,12 +4135,12 @@ void Help::setControlStructures() {
       ":numbers]\n"
       "                          [else evens butfirst :numbers] ]\n"
       "                end\n"
-      "\n");
+      "\n"},
 
   //    TEMPLATE-BASED ITERATION
   //    ------------------------
 
-  set("APPLY",
+  {"APPLY",
       "APPLY template inputlist\n"
       "\n"
       "        command or operation.  Runs the \"template,\" filling its slots "
@@ -4122,9 +4152,9 @@ void Help::setControlStructures() {
       "else\n"
       "        is okay.  APPLY outputs what \"template\" outputs, if "
       "anything.\n"
-      "\n");
+      "\n"},
 
-  set("INVOKE",
+  {"INVOKE",
       "INVOKE template input                                   (library "
       "procedure)\n"
       "(INVOKE template input1 input2 ...)\n"
@@ -4132,9 +4162,9 @@ void Help::setControlStructures() {
       "        command or operation.  Exactly like APPLY except that the "
       "inputs\n"
       "        are provided as separate expressions rather than in a list.\n"
-      "\n");
+      "\n"},
 
-  set("FOREACH",
+  {"FOREACH",
       "FOREACH data template                                   (library "
       "procedure)\n"
       "(FOREACH data1 data2 ... template)\n"
@@ -4161,9 +4191,9 @@ void Help::setControlStructures() {
       "        That is, if the data input is [A B C D E] and the template is\n"
       "        being evaluated with ? replaced by B, then # would be replaced\n"
       "        by 2.\n"
-      "\n");
+      "\n"},
 
-  set("MAP",
+  {"MAP",
       "MAP template data                                       (library "
       "procedure)\n"
       "(MAP template data1 data2 ...)\n"
@@ -4196,9 +4226,9 @@ void Help::setControlStructures() {
       "        That is, if the data input is [A B C D E] and the template is\n"
       "        being evaluated with ? replaced by B, then # would be replaced\n"
       "        by 2.\n"
-      "\n");
+      "\n"},
 
-  set("MAP.SE",
+  {"MAP.SE",
       "MAP.SE template data                                    (library "
       "procedure)\n"
       "(MAP.SE template data1 data2 ...)\n"
@@ -4228,9 +4258,9 @@ void Help::setControlStructures() {
       "        That is, if the data input is [A B C D E] and the template is\n"
       "        being evaluated with ? replaced by B, then # would be replaced\n"
       "        by 2.\n"
-      "\n");
+      "\n"},
 
-  set("FILTER",
+  {"FILTER",
       "FILTER tftemplate data                                  (library "
       "procedure)\n"
       "\n"
@@ -4260,9 +4290,9 @@ void Help::setControlStructures() {
       "        That is, if the data input is [A B C D E] and the template is\n"
       "        being evaluated with ? replaced by B, then # would be replaced\n"
       "        by 2.\n"
-      "\n");
+      "\n"},
 
-  set("FIND",
+  {"FIND",
       "FIND tftemplate data                                    (library "
       "procedure)\n"
       "\n"
@@ -4287,9 +4317,9 @@ void Help::setControlStructures() {
       "        That is, if the data input is [A B C D E] and the template is\n"
       "        being evaluated with ? replaced by B, then # would be replaced\n"
       "        by 2.\n"
-      "\n");
+      "\n"},
 
-  set("REDUCE",
+  {"REDUCE",
       "REDUCE template data                                    (library "
       "procedure)\n"
       "\n"
@@ -4335,9 +4365,9 @@ void Help::setControlStructures() {
       "                   [(throw \"error [not enough inputs to max])]\n"
       "                output reduce [ifelse ?1 > ?2 [?1] [?2]] :inputs\n"
       "                end\n"
-      "\n");
+      "\n"},
 
-  set("CROSSMAP",
+  {"CROSSMAP",
       "CROSSMAP template listlist                              (library "
       "procedure)\n"
       "(CROSSMAP template data1 data2 ...)\n"
@@ -4368,9 +4398,9 @@ void Help::setControlStructures() {
       "        CROSSMAP templates may use the notation :1 instead of ?1 to "
       "indicate\n"
       "        slots.\n"
-      "\n");
+      "\n"},
 
-  set("CASCADE",
+  {"CASCADE",
       "CASCADE endtest template startvalue                     (library "
       "procedure)\n"
       "(CASCADE endtest tmp1 sv1 tmp2 sv2 ...)\n"
@@ -4455,18 +4485,18 @@ void Help::setControlStructures() {
       "                                :word ~\n"
       "                                [word ? \"ay])\n"
       "                end\n"
-      "\n");
+      "\n"},
 
-  set("CASCADE.2",
+  {"CASCADE.2",
       "CASCADE.2 endtest temp1 startval1 temp2 startval2       (library "
       "procedure)\n"
       "\n"
       "        outputs the result of invoking CASCADE with the same inputs.\n"
       "        The only difference is that the default number of inputs is\n"
       "        five instead of three.\n"
-      "\n");
+      "\n"},
 
-  set("TRANSFER",
+  {"TRANSFER",
       "TRANSFER endtest template inbasket                      (library "
       "procedure)\n"
       "\n"
@@ -4486,11 +4516,11 @@ void Help::setControlStructures() {
       "        evaluation continues until either that template's value is "
       "TRUE\n"
       "        or the inbasket is used up.\n"
-      "\n");
-}
+      "\n"},
+};
 
-void Help::setMacros() {
-  set(".MACRO",
+static const HelpEntry macrosHelp[] = {
+  {".MACRO",
       ".MACRO procname :input1 :input2 ...                             "
       "(special form)\n"
       ".DEFMACRO procname text\n"
@@ -4662,19 +4692,19 @@ void Help::setMacros() {
       "        On the other hand, ` is pretty slow, since it's tree recursive "
       "and\n"
       "        written in Logo.\n"
-      "\n");
+      "\n"},
 
-  alt(".DEFMACRO", ".MACRO");
+  {".DEFMACRO", NULL, ".MACRO"},
 
-  set("MACROP", "MACROP name\n"
-                "MACRO? name\n"
-                "\n"
-                "        outputs TRUE if its input is the name of a macro.\n"
-                "\n");
+  {"MACROP", "MACROP name\n"
+             "MACRO? name\n"
+             "\n"
+             "        outputs TRUE if its input is the name of a macro.\n"
+             "\n"},
 
-  alt("MACRO?", "MACROP");
+  {"MACRO?", NULL, "MACROP"},
 
-  set("MACROEXPAND",
+  {"MACROEXPAND",
       "MACROEXPAND expr                                        (library "
       "procedure)\n"
       "\n"
@@ -4693,5 +4723,37 @@ void Help::setMacros() {
       "\n"
       "                ? show macroexpand [localmake \"pi 3.14159]\n"
       "                [local \"pi apply \"make [pi 3.14159]]\n"
-      "\n");
+      "\n"},
+};
+
+struct HelpSection {
+  const HelpEntry *entries;
+  int count;
+};
+
+#define HELP_SECTION(entries)                                                  \
+  { entries, int(sizeof(entries) / sizeof(entries[0])) }
+
+static const HelpSection helpSections[] = {
+    HELP_SECTION(dataStructurePrimitivesHelp),
+    HELP_SECTION(communicationHelp),
+    HELP_SECTION(arithmeticHelp),
+    HELP_SECTION(graphicsHelp),
+    HELP_SECTION(workspaceManagementHelp),
+    HELP_SECTION(controlStructuresHelp),
+    HELP_SECTION(macrosHelp),
+};
+
+static void buildHelpIndex() {
+  if (helpIndex.size() > 0)
+    return;
+  for (auto &section : helpSections) {
+    for (int i = 0; i < section.count; ++i) {
+      const HelpEntry &entry = section.entries[i];
+      if (entry.text != NULL)
+        helpIndex[entry.name] = entry.text;
+      else
+        helpIndex[entry.name] = helpIndex.value(entry.aliasOf, NULL);
+    }
+  }
 }
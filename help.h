@@ -29,17 +29,6 @@
 #include "datum.h"
 
 class Help {
-  void initRsrc();
-  void set(const QString &name, const QString &text);
-  void alt(const QString &newName, const QString &oldName);
-  void setDataStructurePrimitives();
-  void setCommunication();
-  void setArithmetic();
-  void setGraphics();
-  void setWorkspaceManagement();
-  void setControlStructures();
-  void setMacros();
-
 public:
   Help();
   DatumP helpForKeyword(const QString &keyWord);
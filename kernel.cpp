@@ -35,12 +35,10 @@
 #include "error.h"
 #include "library.h"
 #include "turtle.h"
+#include "workspaceimage.h"
 
 #include CONTROLLER_HEADER
 
-// The maximum depth of procedure iterations before error is thrown.
-const int maxIterationDepth = 300;
-
 ProcedureScope::ProcedureScope(Kernel *exec, DatumP procname) {
   ++(exec->procedureIterationDepth);
   procedureHistory = exec->callingProcedure;
@@ -82,6 +80,12 @@ StreamRedirect::~StreamRedirect() {
 
 bool Kernel::isInputRedirected() { return readStream != NULL; }
 
+void Kernel::recordDefinition(DatumP cmd, DatumP procnameP, DatumP text,
+                              DatumP sourceText) {
+  if (imageRecorder != NULL)
+    imageRecorder->addDefinition(cmd, procnameP, text, sourceText);
+}
+
 bool Kernel::numbersFromList(QVector<double> &retval, DatumP l) {
   ListIterator iter = l.listValue()->newIterator();
 
@@ -145,9 +149,24 @@ bool Kernel::getLineAndRunIt(bool shouldHandleError) {
     if (line.listValue()->size() == 0)
       return true;
 
+    qint64 linePos = 0;
+    if (imageRecorder != NULL) {
+      imageRecorder->addLine(line);
+      linePos = systemReadStream->pos();
+    }
+
     DatumP result = runList(line);
+
+    // Only TO may read the lines that follow it. Anything else that reads
+    // from the text can't be replayed from the image.
+    if ((imageRecorder != NULL) &&
+        (imageRecorder->entries.last().cmd == nothing) &&
+        (systemReadStream->pos() != linePos))
+      imageRecorder->isReplayable = false;
+
     if (result != nothing)
       Error::dontSay(result);
+    drainReleaseQueue();
   } catch (Error *e) {
     if (shouldHandleError) {
       if (e->tag.isWord()) {
@@ -181,6 +200,12 @@ bool Kernel::getLineAndRunIt(bool shouldHandleError) {
 DatumP Kernel::registerError(DatumP anError, bool allowErract,
                              bool allowRecovery) {
   const QString erract = "ERRACT";
+  // Procedures compiled ahead of time may contain lines that can't be parsed
+  // yet. Those errors are reported when the line runs, not now.
+  if (isCompilingAhead && (anError != nothing)) {
+    compileAheadError = anError;
+    throw anError.errorValue();
+  }
   mainController()->clearEventQueue();
   currentError = anError;
   ProcedureHelper::setIsErroring(anError != nothing);
@@ -244,7 +269,22 @@ void Kernel::initPalette() {
   turtle->setPenColor(palette[7]);
 }
 
-void Kernel::initLibrary() { executeText(libraryStr); }
+// The library is run from an image that is made the first time QLogo starts,
+// so later startups don't have to read it. If the cache can't be written, the
+// library is read every time. Most runs only use a few of the library
+// procedures, so they aren't parsed until they are called.
+void Kernel::initLibrary() {
+  QString imagePath = WorkspaceImage::cachePath("library.qli");
+  QByteArray imageKey =
+      WorkspaceImage::keyForText("library", libraryStr.toUtf8());
+  WorkspaceImage image;
+  if (image.readFromFile(imagePath, imageKey)) {
+    executeImage(image, false);
+  } else {
+    executeText(libraryStr, &image);
+    image.writeToFile(imagePath, imageKey);
+  }
+}
 
 Kernel::Kernel() {
   readStream = NULL;
@@ -270,12 +310,15 @@ Kernel::Kernel() {
   variables.setDatumForName(version, logoVersion);
   variables.bury(logoPlatform);
   variables.bury(logoVersion);
+
+  isBytecodeEnabled = qEnvironmentVariableIsSet("QLOGO_BYTECODE");
 }
 
 Kernel::~Kernel() {
   closeAll();
   delete parser;
   delete turtle;
+  drainReleaseQueue();
 }
 
 // https://stackoverflow.com/questions/2509679/how-to-generate-a-random-number-from-within-a-range
@@ -325,11 +368,12 @@ DatumP Kernel::readWordWithPrompt(const QString prompt, QTextStream *stream) {
     return parser->readwordWithPrompt(prompt, stream);
 }
 
-void Kernel::makeVarLocal(const QString &varname) {
+void Kernel::makeVarLocal(Symbol varname) {
   if (variables.currentScope() <= 1)
     return;
   if (variables.isStepped(varname)) {
-    QString line = varname + " shadowed by local in procedure call";
+    QString line =
+        keyForSymbol(varname) + " shadowed by local in procedure call";
     if (currentProcedure != nothing) {
       line +=
           " in " +
@@ -340,17 +384,19 @@ void Kernel::makeVarLocal(const QString &varname) {
   variables.setVarAsLocal(varname);
 }
 
-DatumP Kernel::executeProcedureCore(DatumP node) {
+DatumP Kernel::executeProcedureCore(const DatumP &node) {
+  parser->refreshProcedureCall(node.astnodeValue());
   ProcedureHelper h(this, node);
   // The first child is the body of the procedure
-  DatumP proc = h.datumAtIndex(0);
+  DatumP proc = node.astnodeValue()->childAtIndex(0);
 
   // The remaining children are the parameters
   int childIndex = 1;
 
   // first assign the REQUIRED params
-  QList<QString> &requiredInputs = proc.procedureValue()->requiredInputs;
-  for (auto &name : requiredInputs) {
+  QVector<Symbol> &requiredInputs =
+      proc.procedureValue()->requiredInputSymbols;
+  for (Symbol name : requiredInputs) {
     DatumP value = h.datumAtIndex(childIndex);
     ++childIndex;
     makeVarLocal(name);
@@ -358,11 +404,12 @@ DatumP Kernel::executeProcedureCore(DatumP node) {
   }
 
   // then assign the OPTIONAL params
-  QList<QString> &optionalInputs = proc.procedureValue()->optionalInputs;
+  QVector<Symbol> &optionalInputs =
+      proc.procedureValue()->optionalInputSymbols;
   QList<DatumP> &optionalDefaults = proc.procedureValue()->optionalDefaults;
 
   auto defaultIter = optionalDefaults.begin();
-  for (auto &name : optionalInputs) {
+  for (Symbol name : optionalInputs) {
     DatumP value;
     if (childIndex < h.countOfChildren()) {
       value = h.datumAtIndex(childIndex);
@@ -377,7 +424,7 @@ DatumP Kernel::executeProcedureCore(DatumP node) {
 
   // Finally, take in the remainder (if any) as a list.
   if (proc.procedureValue()->restInput != "") {
-    const QString &name = proc.procedureValue()->restInput;
+    Symbol name = proc.procedureValue()->restInputSymbol;
     DatumP remainderList = new List;
     while (childIndex < h.countOfChildren()) {
       DatumP value = h.datumAtIndex(childIndex);
@@ -393,12 +440,13 @@ DatumP Kernel::executeProcedureCore(DatumP node) {
   DatumP retval;
   {
     ProcedureScope ps(this, node);
-    ListIterator iter =
-        proc.procedureValue()->instructionList.listValue()->newIterator();
+    const QVector<DatumP> &lines = proc.procedureValue()->lines;
+    int lineIndex = 0;
     bool isStepped = parser->isStepped(
-        node.astnodeValue()->nodeName.wordValue()->keyValue());
-    while (iter.elementExists() && (retval == nothing)) {
-      currentLine = iter.element();
+        node.astnodeValue()->nodeName.wordValue()->symbolValue());
+    while ((lineIndex < lines.size()) && (retval == nothing)) {
+      currentLine = lines[lineIndex];
+      ++lineIndex;
       if (isStepped) {
         QString line = h.indent() + parser->unreadDatum(currentLine, true);
         sysPrint(line);
@@ -409,12 +457,9 @@ DatumP Kernel::executeProcedureCore(DatumP node) {
         ASTNode *a = retval.astnodeValue();
         if (a->kernel == &Kernel::excGotoCore) {
           QString tag = a->childAtIndex(0).wordValue()->keyValue();
-          DatumP startingLine = proc.procedureValue()->tagToLine[tag];
-          iter =
-              proc.procedureValue()->instructionList.listValue()->newIterator();
-          while (iter.elementExists() && (currentLine != startingLine)) {
-            currentLine = iter.element();
-          }
+          lineIndex = proc.procedureValue()->tagToLine[tag];
+          currentLine = lines[lineIndex];
+          ++lineIndex;
           retval = runList(currentLine, tag);
         }
       }
@@ -445,12 +490,18 @@ DatumP Kernel::executeProcedureCore(DatumP node) {
   return h.ret(retval);
 }
 
-DatumP Kernel::executeProcedure(DatumP node) {
+DatumP Kernel::executeProcedure(const DatumP &node) {
   Scope s(&variables);
 
   if (procedureIterationDepth > maxIterationDepth) {
       Error::stackOverflow();
     }
+  return executeProcedureInScope(node);
+}
+
+// Run the procedure and any tail calls it makes. The caller is responsible for
+// creating the variable scope.
+DatumP Kernel::executeProcedureInScope(DatumP node) {
   DatumP retval = executeProcedureCore(node);
   ASTNode *lastOutputCmd = NULL;
 
@@ -464,7 +515,9 @@ DatumP Kernel::executeProcedure(DatumP node) {
           method = node.astnodeValue()->kernel;
 
           // if the output is a procedure, then trampoline
-          if (method == &Kernel::executeProcedure) {
+          if (isBytecodeEnabled) {
+              retval = runOutputExpression(node);
+            } else if (method == &Kernel::executeProcedure) {
               retval = executeProcedureCore(node);
             } else {
               retval = (this->*method)(node);
@@ -487,7 +540,7 @@ DatumP Kernel::executeProcedure(DatumP node) {
   return retval;
 }
 
-DatumP Kernel::executeMacro(DatumP node) {
+DatumP Kernel::executeMacro(const DatumP &node) {
   DatumP retval = executeProcedure(node);
   if (!retval.isList())
     return Error::macroReturned(retval);
@@ -500,14 +553,13 @@ ASTNode *Kernel::astnodeValue(DatumP caller, DatumP value) {
   return value.astnodeValue();
 }
 
-DatumP Kernel::executeLiteral(DatumP node) {
+DatumP Kernel::executeLiteral(const DatumP &node) {
   return node.astnodeValue()->childAtIndex(0);
 }
 
-DatumP Kernel::executeValueOf(DatumP node) {
+DatumP Kernel::executeValueOf(const DatumP &node) {
   DatumP varnameP = node.astnodeValue()->childAtIndex(0);
-  QString varName = varnameP.wordValue()->keyValue();
-  DatumP retval = variables.datumForName(varName);
+  DatumP retval = variables.datumForName(varnameP.wordValue()->symbolValue());
   if (retval == nothing)
     return (Error::noValueRecoverable(varnameP));
   return retval;
@@ -524,28 +576,39 @@ DatumP Kernel::runList(DatumP listP, const QString startTag) {
     Error::noHow(listP);
   }
 
-  bool tagHasBeenFound = !shouldSearchForTag;
-
-  QList<DatumP> *parsedList = parser->astFromList(listP.listValue());
-  for (auto &statement : *parsedList) {
-    if (retval != nothing) {
-      if (retval.isASTNode()) {
-        return retval;
+  if (isBytecodeEnabled) {
+    bool didFinish;
+    retval = runBytecode(listP, startTag, didFinish);
+    if (!didFinish)
+      return retval;
+  } else {
+    bool tagHasBeenFound = !shouldSearchForTag;
+
+    // Take a shallow copy so that a reparse of this list during execution
+    // (e.g. by a recursive call after a redefinition) doesn't disturb this
+    // loop.
+    const QList<DatumP> parsedList = *parser->astFromList(listP.listValue());
+    for (const DatumP &statement : parsedList) {
+      if (retval != nothing) {
+        if (retval.isASTNode()) {
+          return retval;
+        }
+        Error::dontSay(retval);
       }
-      Error::dontSay(retval);
-    }
-    KernelMethod method = statement.astnodeValue()->kernel;
-    if (tagHasBeenFound) {
-      retval = (this->*method)(statement);
-    } else {
-      if (method == &Kernel::excTag) {
-        ASTNode *child =
-            statement.astnodeValue()->childAtIndex(0).astnodeValue();
-        if (child->kernel == &Kernel::executeLiteral) {
-          DatumP v = child->childAtIndex(0);
-          if (v.isWord()) {
-            QString tag = v.wordValue()->keyValue();
-            tagHasBeenFound = (startTag == tag);
+      drainReleaseQueue(releaseBatchSize);
+      KernelMethod method = statement.astnodeValue()->kernel;
+      if (tagHasBeenFound) {
+        retval = (this->*method)(statement);
+      } else {
+        if (method == &Kernel::excTag) {
+          ASTNode *child =
+              statement.astnodeValue()->childAtIndex(0).astnodeValue();
+          if (child->kernel == &Kernel::executeLiteral) {
+            DatumP v = child->childAtIndex(0);
+            if (v.isWord()) {
+              QString tag = v.wordValue()->keyValue();
+              tagHasBeenFound = (startTag == tag);
+            }
           }
         }
       }
@@ -553,6 +616,12 @@ DatumP Kernel::runList(DatumP listP, const QString startTag) {
   }
 
   // After the end of each line in a procedure handle events
+  processEventQueue();
+
+  return retval;
+}
+
+void Kernel::processEventQueue() {
   while (!mainController()->eventQueueIsEmpty()) {
     char event = mainController()->nextQueueEvent();
     DatumP action;
@@ -584,11 +653,9 @@ DatumP Kernel::runList(DatumP listP, const QString startTag) {
         Error::dontSay(localRetval);
     }
   }
-
-  return retval;
 }
 
-DatumP Kernel::excWait(DatumP node) {
+DatumP Kernel::excWait(const DatumP &node) {
   ProcedureHelper h(this, node);
   double value = h.validatedNumberAtIndex(
       0, [](double candidate) { return candidate >= 0; });
@@ -596,7 +663,7 @@ DatumP Kernel::excWait(DatumP node) {
   return nothing;
 }
 
-DatumP Kernel::excNoop(DatumP node) {
+DatumP Kernel::excNoop(const DatumP &node) {
   ProcedureHelper h(this, node);
   return h.ret();
 }
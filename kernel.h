@@ -44,10 +44,18 @@ class QTextStream;
 
 class Turtle;
 class ProcedureScope;
+class WorkspaceImage;
+
+// The maximum depth of procedure iterations before error is thrown.
+const int maxIterationDepth = 300;
+
+// The number of released Datums deleted before each instruction.
+const int releaseBatchSize = 1000;
 
 class Kernel {
   friend class ProcedureScope;
   friend class StreamRedirect;
+  friend class CompileAheadScope;
   Parser *parser;
   Vars variables;
   DatumP filePrefix;
@@ -86,13 +94,14 @@ class Kernel {
   ASTNode *astnodeValue(DatumP caller, DatumP value);
   bool numbersFromList(QVector<double> &retval, DatumP l);
   DatumP contentslistFromDatumP(DatumP sourceNode);
-  void processContentsListWithMethod(
-      DatumP contentsList, void (Workspace::*method)(const QString &aName));
-  DatumP
-  queryContentsListWithMethod(DatumP contentslist,
-                              bool (Workspace::*method)(const QString &aName));
-  void makeVarLocal(const QString &varname);
-  DatumP executeProcedureCore(DatumP node);
+  void processContentsListWithMethod(DatumP contentsList,
+                                     void (Workspace::*method)(Symbol aName));
+  DatumP queryContentsListWithMethod(DatumP contentslist,
+                                     bool (Workspace::*method)(Symbol aName));
+  void makeVarLocal(Symbol varname);
+  DatumP executeProcedureCore(const DatumP &node);
+  DatumP executeProcedureInScope(DatumP node);
+  void processEventQueue();
   void inputProcedure(DatumP nodeP);
 
   bool colorFromDatumP(QColor &retval, DatumP colorP);
@@ -110,6 +119,41 @@ class Kernel {
 
   void initPalette(void);
 
+  // BYTECODE ENGINE
+  // (see kernel_bytecode.cpp)
+  bool isBytecodeEnabled = false;
+  bool isCompilingAhead = false;
+  // The last error thrown while compiling ahead, kept until the next one.
+  DatumP compileAheadError;
+  QVector<DatumP> operandStack;
+  ASTNode *preparedNode = NULL;
+  int preparedInputsBase = 0;
+  int preparedInputsCount = 0;
+  QVector<List *> listsBeingCompiled;
+  bool isPreEvaluable(KernelMethod method);
+  int compileInputs(QVector<Instruction> &code, ASTNode *node);
+  void compileNode(QVector<Instruction> &code, DatumP node, ASTNode *parent);
+  List *inlinableBody(const DatumP &inputP);
+  bool compileControl(QVector<Instruction> &code, const DatumP &statement,
+                      List *owner);
+  void compileBody(QVector<Instruction> &code, List *body, List *owner);
+  void compileStatement(QVector<Instruction> &code, const DatumP &statement,
+                        List *owner);
+  void compileList(List *aList);
+  bool isBytecodeCurrent(List *aList);
+  DatumP checkedInput(DatumP value, const Instruction &instruction);
+  bool testCondition(const Instruction &instruction);
+  long repeatCount(const Instruction &instruction);
+  DatumP runInstructions(const QVector<Instruction> &code, int pc,
+                         bool &didFinish);
+  DatumP runBytecode(DatumP listP, const QString &startTag, bool &didFinish);
+  DatumP runOutputExpression(const DatumP &node);
+
+  // While a text is being run to build a WorkspaceImage, its lines and
+  // procedure definitions are recorded here.
+  WorkspaceImage *imageRecorder = NULL;
+  QString executeImage(const WorkspaceImage &image, bool shouldCompile = true);
+
   DatumP buildContentsList(showContents_t showWhat);
   QString createPrintoutFromContentsList(DatumP contentslist,
                                          bool shouldValidate = true);
@@ -118,7 +162,7 @@ public:
   Kernel();
   ~Kernel();
   bool getLineAndRunIt(bool shouldHandleError = true);
-  QString executeText(const QString &text);
+  QString executeText(const QString &text, WorkspaceImage *recorder = NULL);
   void stdPrint(const QString &text);
   void sysPrint(const QString &text);
   DatumP registerError(DatumP anError, bool allowErract = false,
@@ -127,6 +171,10 @@ public:
 
   Turtle *turtle;
   bool isInputRedirected();
+  void setBytecodeEnabled(bool aIsEnabled);
+  void recordDefinition(DatumP cmd, DatumP procnameP, DatumP text,
+                        DatumP sourceText);
+  bool takePreparedInputs(ASTNode *node, QVector<DatumP> &inputs);
   void initLibrary();
 
   // DATA STRUCTURE PRIMITIVES
@@ -134,320 +182,324 @@ public:
 
   // CONSTRUCTORS
   // ------------
-  DatumP excWord(DatumP node);
-  DatumP excList(DatumP node);
-  DatumP excSentence(DatumP node);
-  DatumP excFput(DatumP node);
-  DatumP excLput(DatumP node);
-  DatumP excArray(DatumP node);
-  DatumP excListtoarray(DatumP node);
-  DatumP excArraytolist(DatumP node);
+  DatumP excWord(const DatumP &node);
+  DatumP excList(const DatumP &node);
+  DatumP excSentence(const DatumP &node);
+  DatumP excFput(const DatumP &node);
+  DatumP excLput(const DatumP &node);
+  DatumP excArray(const DatumP &node);
+  DatumP excListtoarray(const DatumP &node);
+  DatumP excArraytolist(const DatumP &node);
 
   // SELECTORS
   // ---------
-  DatumP excFirst(DatumP node);
-  DatumP excButfirst(DatumP node);
-  DatumP excFirsts(DatumP node);
-  DatumP excButfirsts(DatumP node);
-  DatumP excLast(DatumP node);
-  DatumP excButlast(DatumP node);
-  DatumP excItem(DatumP node);
+  DatumP excFirst(const DatumP &node);
+  DatumP excButfirst(const DatumP &node);
+  DatumP excFirsts(const DatumP &node);
+  DatumP excButfirsts(const DatumP &node);
+  DatumP excLast(const DatumP &node);
+  DatumP excButlast(const DatumP &node);
+  DatumP excItem(const DatumP &node);
 
   // MUTATORS
   // --------
-  DatumP excSetitem(DatumP node);
-  DatumP excDotSetfirst(DatumP node);
-  DatumP excDotSetbf(DatumP node);
-  DatumP excDotSetitem(DatumP node);
+  DatumP excSetitem(const DatumP &node);
+  DatumP excDotSetfirst(const DatumP &node);
+  DatumP excDotSetbf(const DatumP &node);
+  DatumP excDotSetitem(const DatumP &node);
 
   // PREDICATES
   // ----------
-  DatumP excWordp(DatumP node);
-  DatumP excListp(DatumP node);
-  DatumP excArrayp(DatumP node);
-  DatumP excEmptyp(DatumP node);
-  DatumP excBeforep(DatumP node);
-  DatumP excDotEq(DatumP node);
-  DatumP excMemberp(DatumP node);
-  DatumP excSubstringp(DatumP node);
-  DatumP excNumberp(DatumP node);
-  DatumP excVbarredp(DatumP node);
+  DatumP excWordp(const DatumP &node);
+  DatumP excListp(const DatumP &node);
+  DatumP excArrayp(const DatumP &node);
+  DatumP excEmptyp(const DatumP &node);
+  DatumP excBeforep(const DatumP &node);
+  DatumP excDotEq(const DatumP &node);
+  DatumP excMemberp(const DatumP &node);
+  DatumP excSubstringp(const DatumP &node);
+  DatumP excNumberp(const DatumP &node);
+  DatumP excVbarredp(const DatumP &node);
 
   // QUERIES
   // -------
-  DatumP excCount(DatumP node);
-  DatumP excAscii(DatumP node);
-  DatumP excRawascii(DatumP node);
-  DatumP excChar(DatumP node);
-  DatumP excMember(DatumP node);
-  DatumP excLowercase(DatumP node);
-  DatumP excUppercase(DatumP node);
-  DatumP excStandout(DatumP node);
-  DatumP excParse(DatumP node);
-  DatumP excRunparse(DatumP node);
-  DatumP excReadlist(DatumP node);
-  DatumP excReadword(DatumP node);
-  DatumP excReadrawline(DatumP node);
-  DatumP excReadchar(DatumP node);
-  DatumP excReadchars(DatumP node);
-  DatumP excShell(DatumP node);
-
-  DatumP excSetprefix(DatumP node);
-  DatumP excPrefix(DatumP node);
-  DatumP excOpenread(DatumP node);
-  DatumP excOpenwrite(DatumP node);
-  DatumP excOpenappend(DatumP node);
-  DatumP excOpenupdate(DatumP node);
-  DatumP excAllopen(DatumP node);
-  DatumP excSetread(DatumP node);
-  DatumP excSetwrite(DatumP node);
-  DatumP excReader(DatumP node);
-  DatumP excWriter(DatumP node);
-  DatumP excReadpos(DatumP node);
-  DatumP excWritepos(DatumP node);
-  DatumP excSetreadpos(DatumP node);
-  DatumP excSetwritepos(DatumP node);
-
-  DatumP excTo(DatumP node);
-
-  DatumP excEofp(DatumP node);
-  DatumP excKeyp(DatumP node);
-  DatumP excCleartext(DatumP node);
-  DatumP excCursorInsert(DatumP node);
-  DatumP excCursorOverwrite(DatumP node);
-  DatumP excCursorMode(DatumP node);
-
-  DatumP excClose(DatumP node);
-  DatumP excCloseall(DatumP node);
-  DatumP excErasefile(DatumP node);
-  DatumP excDribble(DatumP node);
-  DatumP excNodribble(DatumP node);
+  DatumP excCount(const DatumP &node);
+  DatumP excAscii(const DatumP &node);
+  DatumP excRawascii(const DatumP &node);
+  DatumP excChar(const DatumP &node);
+  DatumP excMember(const DatumP &node);
+  DatumP excLowercase(const DatumP &node);
+  DatumP excUppercase(const DatumP &node);
+  DatumP excStandout(const DatumP &node);
+  DatumP excParse(const DatumP &node);
+  DatumP excRunparse(const DatumP &node);
+  DatumP excReadlist(const DatumP &node);
+  DatumP excReadword(const DatumP &node);
+  DatumP excReadrawline(const DatumP &node);
+  DatumP excReadchar(const DatumP &node);
+  DatumP excReadchars(const DatumP &node);
+  DatumP excShell(const DatumP &node);
+
+  DatumP excSetprefix(const DatumP &node);
+  DatumP excPrefix(const DatumP &node);
+  DatumP excOpenread(const DatumP &node);
+  DatumP excOpenwrite(const DatumP &node);
+  DatumP excOpenappend(const DatumP &node);
+  DatumP excOpenupdate(const DatumP &node);
+  DatumP excAllopen(const DatumP &node);
+  DatumP excSetread(const DatumP &node);
+  DatumP excSetwrite(const DatumP &node);
+  DatumP excReader(const DatumP &node);
+  DatumP excWriter(const DatumP &node);
+  DatumP excReadpos(const DatumP &node);
+  DatumP excWritepos(const DatumP &node);
+  DatumP excSetreadpos(const DatumP &node);
+  DatumP excSetwritepos(const DatumP &node);
+
+  DatumP excTo(const DatumP &node);
+
+  DatumP excEofp(const DatumP &node);
+  DatumP excKeyp(const DatumP &node);
+  DatumP excCleartext(const DatumP &node);
+  DatumP excCursorInsert(const DatumP &node);
+  DatumP excCursorOverwrite(const DatumP &node);
+  DatumP excCursorMode(const DatumP &node);
+
+  DatumP excClose(const DatumP &node);
+  DatumP excCloseall(const DatumP &node);
+  DatumP excErasefile(const DatumP &node);
+  DatumP excDribble(const DatumP &node);
+  DatumP excNodribble(const DatumP &node);
 
   DatumP runList(DatumP listP, const QString startTag = "");
 
-  DatumP executeLiteral(DatumP node);
-  DatumP executeValueOf(DatumP node);
-  DatumP excMake(DatumP node);
-  DatumP excSetfoo(DatumP node);
-  DatumP excFoo(DatumP node);
-  DatumP excPrint(DatumP node);
-  DatumP excShow(DatumP node);
-  DatumP excType(DatumP node);
-  DatumP excRepeat(DatumP node);
-  DatumP excSetcursor(DatumP node);
-  DatumP excCursor(DatumP node);
-  DatumP excSettextcolor(DatumP node);
-  DatumP excIncreasefont(DatumP node);
-  DatumP excDecreasefont(DatumP node);
-  DatumP excSettextsize(DatumP node);
-  DatumP excTextsize(DatumP node);
-  DatumP excFont(DatumP node);
-  DatumP excSetfont(DatumP node);
-  DatumP excAllfonts(DatumP node);
-
-  DatumP excEqualp(DatumP node);
-  DatumP excNotequal(DatumP node);
-  DatumP excLessp(DatumP node);
-  DatumP excGreaterp(DatumP node);
-  DatumP excGreaterequalp(DatumP node);
-  DatumP excLessequalp(DatumP node);
-  DatumP excSum(DatumP node);
-  DatumP excDifference(DatumP node);
-  DatumP excProduct(DatumP node);
-  DatumP excQuotient(DatumP node);
-  DatumP excRemainder(DatumP node);
-  DatumP excModulo(DatumP node);
-  DatumP excInt(DatumP node);
-  DatumP excRound(DatumP node);
-  DatumP excPower(DatumP node);
-  DatumP excBitand(DatumP node);
-  DatumP excBitor(DatumP node);
-  DatumP excBitxor(DatumP node);
-  DatumP excBitnot(DatumP node);
-  DatumP excAshift(DatumP node);
-  DatumP excLshift(DatumP node);
-  DatumP excAnd(DatumP node);
-  DatumP excOr(DatumP node);
-  DatumP excNot(DatumP node);
-
-  DatumP executeProcedure(DatumP node);
-  DatumP executeMacro(DatumP node);
-  DatumP excThing(DatumP node);
-  DatumP excGlobal(DatumP node);
-
-  DatumP excWait(DatumP node);
-
-  DatumP excSqrt(DatumP node);
-  DatumP excExp(DatumP node);
-  DatumP excLog10(DatumP node);
-  DatumP excLn(DatumP node);
-  DatumP excSin(DatumP node);
-  DatumP excRadsin(DatumP node);
-  DatumP excCos(DatumP node);
-  DatumP excRadcos(DatumP node);
-  DatumP excArctan(DatumP node);
-  DatumP excRadarctan(DatumP node);
-
-  DatumP excForm(DatumP node);
-
-  DatumP excRandom(DatumP node);
-  DatumP excRerandom(DatumP node);
-
-  DatumP excMinus(DatumP node);
-
-  DatumP excForward(DatumP node);
-  DatumP excBack(DatumP node);
-  DatumP excRight(DatumP node);
-  DatumP excLeft(DatumP node);
-  DatumP excClearscreen(DatumP node);
-  DatumP excClean(DatumP node);
-  DatumP excPenup(DatumP node);
-  DatumP excPendown(DatumP node);
-  DatumP excPendownp(DatumP node);
-  DatumP excShowturtle(DatumP node);
-  DatumP excHideturtle(DatumP node);
-  DatumP excHome(DatumP node);
-  DatumP excSetXYZ(DatumP);
-  DatumP excSetXY(DatumP);
-  DatumP excSetpos(DatumP);
-  DatumP excPos(DatumP node);
-  DatumP excMatrix(DatumP node);
-  DatumP excSetX(DatumP);
-  DatumP excSetY(DatumP);
-  DatumP excSetZ(DatumP);
-  DatumP excHeading(DatumP node);
-  DatumP excSetheading(DatumP node);
-  DatumP excArc(DatumP node);
-  DatumP excTowards(DatumP node);
-  DatumP excScrunch(DatumP node);
-  DatumP excSetscrunch(DatumP node);
-  DatumP excLabel(DatumP node);
-  DatumP excLabelheight(DatumP node);
-  DatumP excSetlabelheight(DatumP node);
-  DatumP excShownp(DatumP node);
-  DatumP excSetpencolor(DatumP node);
-  DatumP excPencolor(DatumP node);
-  DatumP excSetpalette(DatumP node);
-  DatumP excPalette(DatumP node);
-  DatumP excBackground(DatumP node);
-  DatumP excSetbackground(DatumP node);
-  DatumP excSavepict(DatumP node);
-
-  DatumP excMousepos(DatumP node);
-  DatumP excClickpos(DatumP node);
-
-  DatumP excBounds(DatumP node);
-  DatumP excSetbounds(DatumP node);
-
-  DatumP excPenpaint(DatumP node);
-  DatumP excPenreverse(DatumP node);
-  DatumP excPenerase(DatumP node);
-  DatumP excPenmode(DatumP node);
-  DatumP excSetpensize(DatumP node);
-  DatumP excPensize(DatumP node);
-
-  DatumP excWrap(DatumP node);
-  DatumP excFence(DatumP node);
-  DatumP excWindow(DatumP node);
-  DatumP excTurtlemode(DatumP node);
-
-  DatumP excTextscreen(DatumP node);
-  DatumP excFullscreen(DatumP node);
-  DatumP excSplitscreen(DatumP node);
-  DatumP excScreenmode(DatumP node);
-
-  DatumP excFilled(DatumP node);
-
-  DatumP excButtonp(DatumP node);
-  DatumP excButton(DatumP node);
-
-  DatumP excDefine(DatumP node);
-  DatumP excText(DatumP node);
-  DatumP excFulltext(DatumP node);
-  DatumP excCopydef(DatumP node);
-
-  DatumP excLocal(DatumP node);
-
-  DatumP excPprop(DatumP node);
-  DatumP excGprop(DatumP node);
-  DatumP excRemprop(DatumP node);
-  DatumP excPlist(DatumP node);
-
-  DatumP excProcedurep(DatumP node);
-  DatumP excPrimitivep(DatumP node);
-  DatumP excDefinedp(DatumP node);
-  DatumP excNamep(DatumP node);
-  DatumP excPlistp(DatumP node);
-
-  DatumP excContents(DatumP node);
-  DatumP excBuried(DatumP node);
-  DatumP excTraced(DatumP node);
-  DatumP excStepped(DatumP node);
-  DatumP excProcedures(DatumP node);
-  DatumP excPrimitives(DatumP node);
-  DatumP excNames(DatumP node);
-  DatumP excPlists(DatumP node);
-  DatumP excArity(DatumP node);
-  DatumP excNodes(DatumP node);
-
-  DatumP excPrintout(DatumP node);
-  DatumP excPot(DatumP node);
-
-  DatumP excErase(DatumP node);
-  DatumP excErall(DatumP node);
-  DatumP excErps(DatumP node);
-  DatumP excErns(DatumP node);
-  DatumP excErpls(DatumP node);
-  DatumP excBury(DatumP node);
-  DatumP excUnbury(DatumP node);
-  DatumP excBuriedp(DatumP node);
-  DatumP excTrace(DatumP node);
-  DatumP excUntrace(DatumP node);
-  DatumP excTracedp(DatumP node);
-  DatumP excStep(DatumP node);
-  DatumP excUnstep(DatumP node);
-  DatumP excSteppedp(DatumP node);
-  DatumP excEdit(DatumP node);
-  DatumP excEditfile(DatumP node);
-  DatumP excSave(DatumP node);
-  DatumP excLoad(DatumP node);
-  DatumP excHelp(DatumP node);
+  DatumP executeLiteral(const DatumP &node);
+  DatumP executeValueOf(const DatumP &node);
+  DatumP excMake(const DatumP &node);
+  DatumP excSetfoo(const DatumP &node);
+  DatumP excFoo(const DatumP &node);
+  DatumP excPrint(const DatumP &node);
+  DatumP excShow(const DatumP &node);
+  DatumP excType(const DatumP &node);
+  DatumP excRepeat(const DatumP &node);
+  DatumP excSetcursor(const DatumP &node);
+  DatumP excCursor(const DatumP &node);
+  DatumP excSettextcolor(const DatumP &node);
+  DatumP excIncreasefont(const DatumP &node);
+  DatumP excDecreasefont(const DatumP &node);
+  DatumP excSettextsize(const DatumP &node);
+  DatumP excTextsize(const DatumP &node);
+  DatumP excFont(const DatumP &node);
+  DatumP excSetfont(const DatumP &node);
+  DatumP excAllfonts(const DatumP &node);
+
+  DatumP excEqualp(const DatumP &node);
+  DatumP excNotequal(const DatumP &node);
+  DatumP excLessp(const DatumP &node);
+  DatumP excGreaterp(const DatumP &node);
+  DatumP excGreaterequalp(const DatumP &node);
+  DatumP excLessequalp(const DatumP &node);
+  DatumP excSum(const DatumP &node);
+  DatumP excDifference(const DatumP &node);
+  DatumP excProduct(const DatumP &node);
+  DatumP excQuotient(const DatumP &node);
+  DatumP excRemainder(const DatumP &node);
+  DatumP excModulo(const DatumP &node);
+  DatumP excInt(const DatumP &node);
+  DatumP excRound(const DatumP &node);
+  DatumP excPower(const DatumP &node);
+  DatumP excBitand(const DatumP &node);
+  DatumP excBitor(const DatumP &node);
+  DatumP excBitxor(const DatumP &node);
+  DatumP excBitnot(const DatumP &node);
+  DatumP excAshift(const DatumP &node);
+  DatumP excLshift(const DatumP &node);
+  DatumP excAnd(const DatumP &node);
+  DatumP excOr(const DatumP &node);
+  DatumP excNot(const DatumP &node);
+
+  DatumP executeProcedure(const DatumP &node);
+  DatumP executeMacro(const DatumP &node);
+  DatumP excThing(const DatumP &node);
+  DatumP excGlobal(const DatumP &node);
+
+  DatumP excWait(const DatumP &node);
+
+  DatumP excSqrt(const DatumP &node);
+  DatumP excExp(const DatumP &node);
+  DatumP excLog10(const DatumP &node);
+  DatumP excLn(const DatumP &node);
+  DatumP excSin(const DatumP &node);
+  DatumP excRadsin(const DatumP &node);
+  DatumP excCos(const DatumP &node);
+  DatumP excRadcos(const DatumP &node);
+  DatumP excArctan(const DatumP &node);
+  DatumP excRadarctan(const DatumP &node);
+
+  DatumP excForm(const DatumP &node);
+
+  DatumP excRandom(const DatumP &node);
+  DatumP excRerandom(const DatumP &node);
+
+  DatumP excMinus(const DatumP &node);
+
+  DatumP excForward(const DatumP &node);
+  DatumP excBack(const DatumP &node);
+  DatumP excRight(const DatumP &node);
+  DatumP excLeft(const DatumP &node);
+  DatumP excClearscreen(const DatumP &node);
+  DatumP excClean(const DatumP &node);
+  DatumP excPenup(const DatumP &node);
+  DatumP excPendown(const DatumP &node);
+  DatumP excPendownp(const DatumP &node);
+  DatumP excShowturtle(const DatumP &node);
+  DatumP excHideturtle(const DatumP &node);
+  DatumP excHome(const DatumP &node);
+  DatumP excSetXYZ(const DatumP &);
+  DatumP excSetXY(const DatumP &);
+  DatumP excSetpos(const DatumP &);
+  DatumP excPos(const DatumP &node);
+  DatumP excMatrix(const DatumP &node);
+  DatumP excSetX(const DatumP &);
+  DatumP excSetY(const DatumP &);
+  DatumP excSetZ(const DatumP &);
+  DatumP excHeading(const DatumP &node);
+  DatumP excSetheading(const DatumP &node);
+  DatumP excArc(const DatumP &node);
+  DatumP excTowards(const DatumP &node);
+  DatumP excScrunch(const DatumP &node);
+  DatumP excSetscrunch(const DatumP &node);
+  DatumP excLabel(const DatumP &node);
+  DatumP excLabelheight(const DatumP &node);
+  DatumP excSetlabelheight(const DatumP &node);
+  DatumP excShownp(const DatumP &node);
+  DatumP excSetpencolor(const DatumP &node);
+  DatumP excPencolor(const DatumP &node);
+  DatumP excSetpalette(const DatumP &node);
+  DatumP excPalette(const DatumP &node);
+  DatumP excBackground(const DatumP &node);
+  DatumP excSetbackground(const DatumP &node);
+  DatumP excSavepict(const DatumP &node);
+
+  DatumP excMousepos(const DatumP &node);
+  DatumP excClickpos(const DatumP &node);
+
+  DatumP excBounds(const DatumP &node);
+  DatumP excSetbounds(const DatumP &node);
+
+  DatumP excPenpaint(const DatumP &node);
+  DatumP excPenreverse(const DatumP &node);
+  DatumP excPenerase(const DatumP &node);
+  DatumP excPenmode(const DatumP &node);
+  DatumP excSetpensize(const DatumP &node);
+  DatumP excPensize(const DatumP &node);
+
+  DatumP excWrap(const DatumP &node);
+  DatumP excFence(const DatumP &node);
+  DatumP excWindow(const DatumP &node);
+  DatumP excTurtlemode(const DatumP &node);
+
+  DatumP excTextscreen(const DatumP &node);
+  DatumP excFullscreen(const DatumP &node);
+  DatumP excSplitscreen(const DatumP &node);
+  DatumP excScreenmode(const DatumP &node);
+
+  DatumP excFilled(const DatumP &node);
+
+  DatumP excButtonp(const DatumP &node);
+  DatumP excButton(const DatumP &node);
+
+  DatumP excDefine(const DatumP &node);
+  DatumP excText(const DatumP &node);
+  DatumP excFulltext(const DatumP &node);
+  DatumP excCopydef(const DatumP &node);
+
+  DatumP excLocal(const DatumP &node);
+
+  DatumP excPprop(const DatumP &node);
+  DatumP excGprop(const DatumP &node);
+  DatumP excRemprop(const DatumP &node);
+  DatumP excPlist(const DatumP &node);
+
+  DatumP excProcedurep(const DatumP &node);
+  DatumP excPrimitivep(const DatumP &node);
+  DatumP excDefinedp(const DatumP &node);
+  DatumP excNamep(const DatumP &node);
+  DatumP excPlistp(const DatumP &node);
+
+  DatumP excContents(const DatumP &node);
+  DatumP excBuried(const DatumP &node);
+  DatumP excTraced(const DatumP &node);
+  DatumP excStepped(const DatumP &node);
+  DatumP excProcedures(const DatumP &node);
+  DatumP excPrimitives(const DatumP &node);
+  DatumP excNames(const DatumP &node);
+  DatumP excPlists(const DatumP &node);
+  DatumP excArity(const DatumP &node);
+  DatumP excNodes(const DatumP &node);
+  DatumP excNodestats(const DatumP &node);
+  DatumP excNodesjson(const DatumP &node);
+  DatumP excGc(const DatumP &node);
+  DatumP excRecycle(const DatumP &node);
+
+  DatumP excPrintout(const DatumP &node);
+  DatumP excPot(const DatumP &node);
+
+  DatumP excErase(const DatumP &node);
+  DatumP excErall(const DatumP &node);
+  DatumP excErps(const DatumP &node);
+  DatumP excErns(const DatumP &node);
+  DatumP excErpls(const DatumP &node);
+  DatumP excBury(const DatumP &node);
+  DatumP excUnbury(const DatumP &node);
+  DatumP excBuriedp(const DatumP &node);
+  DatumP excTrace(const DatumP &node);
+  DatumP excUntrace(const DatumP &node);
+  DatumP excTracedp(const DatumP &node);
+  DatumP excStep(const DatumP &node);
+  DatumP excUnstep(const DatumP &node);
+  DatumP excSteppedp(const DatumP &node);
+  DatumP excEdit(const DatumP &node);
+  DatumP excEditfile(const DatumP &node);
+  DatumP excSave(const DatumP &node);
+  DatumP excLoad(const DatumP &node);
+  DatumP excHelp(const DatumP &node);
 
   // CONTROL STRUCTURES
 
-  DatumP excRun(DatumP node);
-  DatumP excRunresult(DatumP node);
-  DatumP excForever(DatumP node);
-  DatumP excRepcount(DatumP node);
-  DatumP excIf(DatumP node);
-  DatumP excIfelse(DatumP node);
-  DatumP excTest(DatumP node);
-  DatumP excIftrue(DatumP node);
-  DatumP excIffalse(DatumP node);
-  DatumP excStop(DatumP node);
-  DatumP excOutput(DatumP node);
-  DatumP excCatch(DatumP node);
-  DatumP excThrow(DatumP node);
-  DatumP excError(DatumP node);
-  DatumP excPause(DatumP node);
-  DatumP excContinue(DatumP node);
-  DatumP excBye(DatumP node);
-  DatumP excDotMaybeoutput(DatumP node);
-  DatumP excTag(DatumP);
-  DatumP excGoto(DatumP node);
-  DatumP excGotoCore(DatumP);
+  DatumP excRun(const DatumP &node);
+  DatumP excRunresult(const DatumP &node);
+  DatumP excForever(const DatumP &node);
+  DatumP excRepcount(const DatumP &node);
+  DatumP excIf(const DatumP &node);
+  DatumP excIfelse(const DatumP &node);
+  DatumP excTest(const DatumP &node);
+  DatumP excIftrue(const DatumP &node);
+  DatumP excIffalse(const DatumP &node);
+  DatumP excStop(const DatumP &node);
+  DatumP excOutput(const DatumP &node);
+  DatumP excCatch(const DatumP &node);
+  DatumP excThrow(const DatumP &node);
+  DatumP excError(const DatumP &node);
+  DatumP excPause(const DatumP &node);
+  DatumP excContinue(const DatumP &node);
+  DatumP excBye(const DatumP &node);
+  DatumP excDotMaybeoutput(const DatumP &node);
+  DatumP excTag(const DatumP &);
+  DatumP excGoto(const DatumP &node);
+  DatumP excGotoCore(const DatumP &);
 
   // TEMPLATE-BASED ITERATION
 
-  DatumP excApply(DatumP node);
-  DatumP excNamedSlot(DatumP node); // '?'
+  DatumP excApply(const DatumP &node);
+  DatumP excNamedSlot(const DatumP &node); // '?'
 
   // MACROS
 
-  DatumP excMacro(DatumP node);
-  DatumP excMacrop(DatumP node);
+  DatumP excMacro(const DatumP &node);
+  DatumP excMacrop(const DatumP &node);
 
-  DatumP excNoop(DatumP node); // Some LOGO commands have no action in QLogo
+  DatumP excNoop(const DatumP &node); // Some LOGO commands have no action in QLogo
 
   // SPECIAL VARIABLES
 
@@ -498,4 +550,20 @@ public:
   ~StreamRedirect();
 };
 
+// While a CompileAheadScope exists, errors are thrown to the code compiling
+// ahead instead of being reported.
+class CompileAheadScope {
+  Kernel *exec;
+  bool wasCompilingAhead;
+
+public:
+  CompileAheadScope(Kernel *srcExec) {
+    exec = srcExec;
+    wasCompilingAhead = exec->isCompilingAhead;
+    exec->isCompilingAhead = true;
+  }
+
+  ~CompileAheadScope() { exec->isCompilingAhead = wasCompilingAhead; }
+};
+
 #endif // EXECUTOR_H
@@ -37,7 +37,7 @@
 
 // NUMERIC OPERATIONS
 
-DatumP Kernel::excSum(DatumP node) {
+DatumP Kernel::excSum(const DatumP &node) {
   ProcedureHelper h(this, node);
   double result = 0;
 
@@ -48,7 +48,7 @@ DatumP Kernel::excSum(DatumP node) {
   return h.ret(new Word(result));
 }
 
-DatumP Kernel::excDifference(DatumP node) {
+DatumP Kernel::excDifference(const DatumP &node) {
   ProcedureHelper h(this, node);
   double a = h.numberAtIndex(0);
 
@@ -59,14 +59,14 @@ DatumP Kernel::excDifference(DatumP node) {
   return h.ret(new Word(c));
 }
 
-DatumP Kernel::excMinus(DatumP node) {
+DatumP Kernel::excMinus(const DatumP &node) {
   ProcedureHelper h(this, node);
   double a = h.numberAtIndex(0);
 
   return h.ret(new Word(-a));
 }
 
-DatumP Kernel::excProduct(DatumP node) {
+DatumP Kernel::excProduct(const DatumP &node) {
   ProcedureHelper h(this, node);
   double result = 1;
 
@@ -77,7 +77,7 @@ DatumP Kernel::excProduct(DatumP node) {
   return h.ret(new Word(result));
 }
 
-DatumP Kernel::excQuotient(DatumP node) {
+DatumP Kernel::excQuotient(const DatumP &node) {
   ProcedureHelper h(this, node);
   double a, c;
 
@@ -96,7 +96,7 @@ DatumP Kernel::excQuotient(DatumP node) {
   return h.ret(new Word(c));
 }
 
-DatumP Kernel::excRemainder(DatumP node) {
+DatumP Kernel::excRemainder(const DatumP &node) {
   ProcedureHelper h(this, node);
   long a = h.integerAtIndex(0);
 
@@ -108,7 +108,7 @@ DatumP Kernel::excRemainder(DatumP node) {
   return h.ret(new Word(c));
 }
 
-DatumP Kernel::excModulo(DatumP node) {
+DatumP Kernel::excModulo(const DatumP &node) {
   ProcedureHelper h(this, node);
   long a = h.integerAtIndex(0);
 
@@ -121,7 +121,7 @@ DatumP Kernel::excModulo(DatumP node) {
   return h.ret(new Word(c));
 }
 
-DatumP Kernel::excInt(DatumP node) {
+DatumP Kernel::excInt(const DatumP &node) {
   ProcedureHelper h(this, node);
   double a = h.numberAtIndex(0);
 
@@ -130,7 +130,7 @@ DatumP Kernel::excInt(DatumP node) {
   return h.ret(new Word(b));
 }
 
-DatumP Kernel::excRound(DatumP node) {
+DatumP Kernel::excRound(const DatumP &node) {
   ProcedureHelper h(this, node);
   double a = h.numberAtIndex(0);
 
@@ -139,7 +139,7 @@ DatumP Kernel::excRound(DatumP node) {
   return h.ret(new Word(b));
 }
 
-DatumP Kernel::excSqrt(DatumP node) {
+DatumP Kernel::excSqrt(const DatumP &node) {
   ProcedureHelper h(this, node);
   double a = h.validatedNumberAtIndex(
       0, [](double candidate) { return candidate >= 0; });
@@ -149,7 +149,7 @@ DatumP Kernel::excSqrt(DatumP node) {
   return h.ret(new Word(c));
 }
 
-DatumP Kernel::excPower(DatumP node) {
+DatumP Kernel::excPower(const DatumP &node) {
   ProcedureHelper h(this, node);
   double a = h.numberAtIndex(0);
   double b;
@@ -165,7 +165,7 @@ DatumP Kernel::excPower(DatumP node) {
   return h.ret(new Word(c));
 }
 
-DatumP Kernel::excExp(DatumP node) {
+DatumP Kernel::excExp(const DatumP &node) {
   ProcedureHelper h(this, node);
   double a = h.numberAtIndex(0);
 
@@ -174,7 +174,7 @@ DatumP Kernel::excExp(DatumP node) {
   return h.ret(new Word(c));
 }
 
-DatumP Kernel::excLog10(DatumP node) {
+DatumP Kernel::excLog10(const DatumP &node) {
   ProcedureHelper h(this, node);
   double a = h.validatedNumberAtIndex(
       0, [](double candidate) { return candidate >= 0; });
@@ -184,7 +184,7 @@ DatumP Kernel::excLog10(DatumP node) {
   return h.ret(new Word(c));
 }
 
-DatumP Kernel::excLn(DatumP node) {
+DatumP Kernel::excLn(const DatumP &node) {
   ProcedureHelper h(this, node);
   double a = h.validatedNumberAtIndex(
       0, [](double candidate) { return candidate >= 0; });
@@ -194,7 +194,7 @@ DatumP Kernel::excLn(DatumP node) {
   return h.ret(new Word(c));
 }
 
-DatumP Kernel::excSin(DatumP node) {
+DatumP Kernel::excSin(const DatumP &node) {
   ProcedureHelper h(this, node);
   double a = h.numberAtIndex(0);
 
@@ -203,7 +203,7 @@ DatumP Kernel::excSin(DatumP node) {
   return h.ret(new Word(c));
 }
 
-DatumP Kernel::excRadsin(DatumP node) {
+DatumP Kernel::excRadsin(const DatumP &node) {
   ProcedureHelper h(this, node);
   double a = h.numberAtIndex(0);
 
@@ -212,7 +212,7 @@ DatumP Kernel::excRadsin(DatumP node) {
   return h.ret(new Word(c));
 }
 
-DatumP Kernel::excCos(DatumP node) {
+DatumP Kernel::excCos(const DatumP &node) {
   ProcedureHelper h(this, node);
   double a = h.numberAtIndex(0);
 
@@ -221,7 +221,7 @@ DatumP Kernel::excCos(DatumP node) {
   return h.ret(new Word(c));
 }
 
-DatumP Kernel::excRadcos(DatumP node) {
+DatumP Kernel::excRadcos(const DatumP &node) {
   ProcedureHelper h(this, node);
   double a = h.numberAtIndex(0);
 
@@ -230,7 +230,7 @@ DatumP Kernel::excRadcos(DatumP node) {
   return h.ret(new Word(c));
 }
 
-DatumP Kernel::excArctan(DatumP node) {
+DatumP Kernel::excArctan(const DatumP &node) {
   ProcedureHelper h(this, node);
   double a = h.numberAtIndex(0);
   if (node.astnodeValue()->countOfChildren() == 1) {
@@ -245,7 +245,7 @@ DatumP Kernel::excArctan(DatumP node) {
   return h.ret(new Word(c));
 }
 
-DatumP Kernel::excRadarctan(DatumP node) {
+DatumP Kernel::excRadarctan(const DatumP &node) {
   ProcedureHelper h(this, node);
   double a = h.numberAtIndex(0);
   if (node.astnodeValue()->countOfChildren() == 1) {
@@ -262,28 +262,28 @@ DatumP Kernel::excRadarctan(DatumP node) {
 
 // PREDICATES
 
-DatumP Kernel::excLessp(DatumP node) {
+DatumP Kernel::excLessp(const DatumP &node) {
   ProcedureHelper h(this, node);
   double a = h.numberAtIndex(0);
   double b = h.numberAtIndex(1);
   return h.ret(a < b);
 }
 
-DatumP Kernel::excGreaterp(DatumP node) {
+DatumP Kernel::excGreaterp(const DatumP &node) {
   ProcedureHelper h(this, node);
   double a = h.numberAtIndex(0);
   double b = h.numberAtIndex(1);
   return h.ret(a > b);
 }
 
-DatumP Kernel::excLessequalp(DatumP node) {
+DatumP Kernel::excLessequalp(const DatumP &node) {
   ProcedureHelper h(this, node);
   double a = h.numberAtIndex(0);
   double b = h.numberAtIndex(1);
   return h.ret(a <= b);
 }
 
-DatumP Kernel::excGreaterequalp(DatumP node) {
+DatumP Kernel::excGreaterequalp(const DatumP &node) {
   ProcedureHelper h(this, node);
   double a = h.numberAtIndex(0);
   double b = h.numberAtIndex(1);
@@ -292,7 +292,7 @@ DatumP Kernel::excGreaterequalp(DatumP node) {
 
 // RANDOM NUMBERS
 
-DatumP Kernel::excRandom(DatumP node) {
+DatumP Kernel::excRandom(const DatumP &node) {
   ProcedureHelper h(this, node);
   int start, end;
 
@@ -316,7 +316,7 @@ DatumP Kernel::excRandom(DatumP node) {
   return h.ret(new Word(result));
 }
 
-DatumP Kernel::excRerandom(DatumP node) {
+DatumP Kernel::excRerandom(const DatumP &node) {
   ProcedureHelper h(this, node);
   if (h.countOfChildren() == 1) {
     long seed = h.validatedIntegerAtIndex(0, [](long candidate) {
@@ -331,7 +331,7 @@ DatumP Kernel::excRerandom(DatumP node) {
 
 // PRINT FORMATTING
 
-DatumP Kernel::excForm(DatumP node) {
+DatumP Kernel::excForm(const DatumP &node) {
   ProcedureHelper h(this, node);
   double num = h.numberAtIndex(0);
   double width = h.integerAtIndex(1);
@@ -345,7 +345,7 @@ DatumP Kernel::excForm(DatumP node) {
 
 // BITWISE OPERATORS
 
-DatumP Kernel::excBitand(DatumP node) {
+DatumP Kernel::excBitand(const DatumP &node) {
   ProcedureHelper h(this, node);
   long retval = -1;
 
@@ -357,7 +357,7 @@ DatumP Kernel::excBitand(DatumP node) {
   return h.ret(new Word(retval));
 }
 
-DatumP Kernel::excBitor(DatumP node) {
+DatumP Kernel::excBitor(const DatumP &node) {
   ProcedureHelper h(this, node);
   long retval = 0;
 
@@ -369,7 +369,7 @@ DatumP Kernel::excBitor(DatumP node) {
   return h.ret(new Word(retval));
 }
 
-DatumP Kernel::excBitxor(DatumP node) {
+DatumP Kernel::excBitxor(const DatumP &node) {
   ProcedureHelper h(this, node);
   long retval = 0;
 
@@ -381,14 +381,14 @@ DatumP Kernel::excBitxor(DatumP node) {
   return h.ret(new Word(retval));
 }
 
-DatumP Kernel::excBitnot(DatumP node) {
+DatumP Kernel::excBitnot(const DatumP &node) {
   ProcedureHelper h(this, node);
   long a = h.integerAtIndex(0);
   long retval = ~a;
   return h.ret(new Word(retval));
 }
 
-DatumP Kernel::excAshift(DatumP node) {
+DatumP Kernel::excAshift(const DatumP &node) {
   ProcedureHelper h(this, node);
   long a = h.integerAtIndex(0);
   long e = h.integerAtIndex(1);
@@ -396,7 +396,7 @@ DatumP Kernel::excAshift(DatumP node) {
   return h.ret(new Word(retval));
 }
 
-DatumP Kernel::excLshift(DatumP node) {
+DatumP Kernel::excLshift(const DatumP &node) {
   ProcedureHelper h(this, node);
   unsigned long a = h.integerAtIndex(0);
   long e = h.integerAtIndex(1);
@@ -406,7 +406,7 @@ DatumP Kernel::excLshift(DatumP node) {
 
 // LOGICAL OPERATIONS
 
-DatumP Kernel::excAnd(DatumP node) {
+DatumP Kernel::excAnd(const DatumP &node) {
   ProcedureHelper h(this, node);
   for (int i = 0; i < h.countOfChildren(); ++i) {
     bool a = h.boolAtIndex(i, true);
@@ -417,7 +417,7 @@ DatumP Kernel::excAnd(DatumP node) {
   return h.ret(true);
 }
 
-DatumP Kernel::excOr(DatumP node) {
+DatumP Kernel::excOr(const DatumP &node) {
   ProcedureHelper h(this, node);
   for (int i = 0; i < h.countOfChildren(); ++i) {
     bool a = h.boolAtIndex(i, true);
@@ -428,7 +428,7 @@ DatumP Kernel::excOr(DatumP node) {
   return h.ret(false);
 }
 
-DatumP Kernel::excNot(DatumP node) {
+DatumP Kernel::excNot(const DatumP &node) {
   ProcedureHelper h(this, node);
   bool a = h.boolAtIndex(0, true);
 
@@ -0,0 +1,601 @@
+//===-- qlogo/kernel_bytecode.cpp - Bytecode engine implementation -------*- C++ -*-===//
+//
+// This file is part of QLogo.
+//
+// QLogo is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 2 of the License, or
+// (at your option) any later version.
+//
+// QLogo is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with QLogo.  If not, see <http://www.gnu.org/licenses/>.
+//
+//===----------------------------------------------------------------------===//
+///
+/// \file
+/// This file contains the implementation of the optional bytecode engine of
+/// the Kernel class.
+///
+/// The AST of a runlist is flattened into a sequence of Instructions in
+/// postfix order. The inputs of a primitive or procedure are evaluated onto
+/// the operand stack, in the same order ProcedureHelper would evaluate them,
+/// and are then handed to the ProcedureHelper of the callee through
+/// takePreparedInputs(). Commands that must see their inputs unevaluated
+/// (TAG, TO, ...) are run through the AST as before, so both engines produce
+/// the same results.
+///
+/// IF, IFELSE, and REPEAT statements whose runlists are literal Lists are
+/// compiled in place. The statements of the runlists become part of the
+/// enclosing code, and the control structure becomes opTest or opRepeat and
+/// jumps, so no ProcedureHelper is built and runList() isn't called for them.
+/// Each inlined runlist begins with opBody, which falls back to runList() if
+/// the runlist's AST has been rebuilt since it was compiled.
+///
+/// STOP, OUTPUT, and .MAYBEOUTPUT statements become opExit, which makes the
+/// statement itself the result, as excStop() and excOutput() do. The
+/// expression given to OUTPUT is evaluated by executeProcedureInScope() once
+/// the procedure's lines have finished, so that tail calls don't grow the
+/// stack.
+///
+//===----------------------------------------------------------------------===//
+
+#include "error.h"
+#include "kernel.h"
+#include "parser.h"
+#include <limits.h>
+#include <math.h>
+
+// Use the "labels as values" extension for the dispatch loop where it is
+// available. Otherwise fall back to a switch statement.
+#if defined(__GNUC__)
+#define VM_THREADED_DISPATCH
+#endif
+
+#ifdef VM_THREADED_DISPATCH
+#define VM_BEGIN() goto *dispatchTable[code[pc].opcode];
+#define VM_END()
+#define VM_OP(op) label_##op:
+#define VM_NEXT()                                                              \
+  ++pc;                                                                        \
+  goto *dispatchTable[code[pc].opcode];
+#define VM_JUMP() goto *dispatchTable[code[pc].opcode];
+#else
+#define VM_BEGIN()                                                             \
+  for (;;)                                                                     \
+    switch (code[pc].opcode) {
+#define VM_END() }
+#define VM_OP(op) case Instruction::op:
+#define VM_NEXT()                                                              \
+  ++pc;                                                                        \
+  continue;
+#define VM_JUMP() continue;
+#endif
+
+// A REPEAT loop that runInstructions() is running.
+struct RepeatLoop {
+  long remaining;
+  long savedRepcount;
+};
+
+void Kernel::setBytecodeEnabled(bool aIsEnabled) {
+  isBytecodeEnabled = aIsEnabled;
+}
+
+// These methods either don't take inputs, or need to see their inputs
+// unevaluated. Every other method begins by building a ProcedureHelper, which
+// evaluates all of the node's children in order.
+bool Kernel::isPreEvaluable(KernelMethod method) {
+  return (method != &Kernel::executeProcedure) &&
+         (method != &Kernel::executeMacro) &&
+         (method != &Kernel::executeLiteral) &&
+         (method != &Kernel::executeValueOf) &&
+         (method != &Kernel::excStop) && (method != &Kernel::excOutput) &&
+         (method != &Kernel::excDotMaybeoutput) &&
+         (method != &Kernel::excTag) && (method != &Kernel::excGotoCore) &&
+         (method != &Kernel::excTo) && (method != &Kernel::excFoo);
+}
+
+bool Kernel::takePreparedInputs(ASTNode *node, QVector<DatumP> &inputs) {
+  if ((preparedNode == NULL) || (preparedNode != node))
+    return false;
+  preparedNode = NULL;
+  for (int i = 0; i < preparedInputsCount; ++i) {
+    inputs.push_back(operandStack[preparedInputsBase + i]);
+  }
+  return true;
+}
+
+// Compile the children of node the way ProcedureHelper evaluates them.
+// Returns the number of inputs that will be on the operand stack.
+int Kernel::compileInputs(QVector<Instruction> &code, ASTNode *node) {
+  int count = node->countOfChildren();
+  for (int i = 0; i < count; ++i) {
+    DatumP child = node->childAtIndex(i);
+    if (child.isa() == Datum::procedureType) {
+      code.push_back(Instruction(Instruction::opLiteral, child));
+    } else {
+      compileNode(code, child, node);
+    }
+  }
+  return count;
+}
+
+void Kernel::compileNode(QVector<Instruction> &code, DatumP nodeP,
+                         ASTNode *parent) {
+  ASTNode *node = nodeP.astnodeValue();
+  KernelMethod method = node->kernel;
+
+  if (method == &Kernel::executeLiteral) {
+    code.push_back(Instruction(Instruction::opLiteral, node->childAtIndex(0)));
+    return;
+  }
+  if (method == &Kernel::executeValueOf) {
+    code.push_back(Instruction(Instruction::opValueOf, nodeP, 0, parent));
+    return;
+  }
+
+  bool isProcedure = (method == &Kernel::executeProcedure);
+  if (!isProcedure && !isPreEvaluable(method)) {
+    code.push_back(Instruction(Instruction::opEval, nodeP, 0, parent));
+    return;
+  }
+
+  // A procedure's inputs are evaluated inside its new variable scope.
+  if (isProcedure)
+    code.push_back(Instruction(Instruction::opEnterProcedure));
+
+  int count = compileInputs(code, node);
+  Instruction::Opcode op =
+      isProcedure ? Instruction::opCallProcedure : Instruction::opCall;
+  code.push_back(Instruction(op, nodeP, count, parent));
+}
+
+// Returns the List given to a control structure as inputP if its statements
+// can be compiled in place: it must be a literal List that parses, and that
+// isn't already being compiled. Otherwise returns NULL.
+List *Kernel::inlinableBody(const DatumP &inputP) {
+  if (!inputP.isASTNode())
+    return NULL;
+  ASTNode *input = inputP.astnodeValue();
+  if (input->kernel != &Kernel::executeLiteral)
+    return NULL;
+  DatumP bodyP = input->childAtIndex(0);
+  if (!bodyP.isList())
+    return NULL;
+  List *body = bodyP.listValue();
+  if (listsBeingCompiled.contains(body))
+    return NULL;
+
+  // A runlist with a syntax error reports it only if it is run.
+  CompileAheadScope scope(this);
+  try {
+    parser->astFromList(body);
+  } catch (Error *e) {
+    return NULL;
+  }
+  return body;
+}
+
+void Kernel::compileBody(QVector<Instruction> &code, List *body,
+                         List *owner) {
+  int enter = code.size();
+  Instruction enterBody(Instruction::opBody, DatumP(body));
+  enterBody.buildNumber = body->astBuildNumber;
+  code.push_back(enterBody);
+  owner->bytecodeInlinedLists.push_back({DatumP(body), body->astBuildNumber});
+
+  listsBeingCompiled.push_back(body);
+  const QList<DatumP> statements = body->astList;
+  for (auto &statement : statements) {
+    compileStatement(code, statement, owner);
+  }
+  listsBeingCompiled.pop_back();
+
+  code.push_back(Instruction(Instruction::opEndBody));
+  code[enter].count = code.size();
+}
+
+// Compile STOP, OUTPUT, .MAYBEOUTPUT, IF, IFELSE, and REPEAT statements
+// without calls to their KernelMethods. Returns false if statement has to be
+// compiled as an ordinary call.
+bool Kernel::compileControl(QVector<Instruction> &code, const DatumP &statement,
+                            List *owner) {
+  ASTNode *node = statement.astnodeValue();
+  KernelMethod method = node->kernel;
+  if ((method == &Kernel::excStop) || (method == &Kernel::excOutput) ||
+      (method == &Kernel::excDotMaybeoutput)) {
+    code.push_back(Instruction(Instruction::opExit, statement));
+    return true;
+  }
+
+  bool isIfelse = (method == &Kernel::excIfelse);
+  bool isRepeat = (method == &Kernel::excRepeat);
+  if ((method != &Kernel::excIf) && !isIfelse && !isRepeat)
+    return false;
+  int countOfBodies = isIfelse ? 2 : 1;
+  if (node->countOfChildren() != countOfBodies + 1)
+    return false;
+  // A traced control structure has to report its inputs.
+  if (parser->isTraced(node->nodeName.wordValue()->symbolValue()))
+    return false;
+  List *bodies[2];
+  for (int i = 0; i < countOfBodies; ++i) {
+    bodies[i] = inlinableBody(node->childAtIndex(i + 1));
+    if (bodies[i] == NULL)
+      return false;
+  }
+
+  compileNode(code, node->childAtIndex(0), node);
+  int test = code.size();
+  code.push_back(Instruction(isRepeat ? Instruction::opRepeat
+                                      : Instruction::opTest,
+                             statement));
+  int bodyStart = code.size();
+  compileBody(code, bodies[0], owner);
+  if (isRepeat)
+    code.push_back(Instruction(Instruction::opRepeatNext, DatumP(), bodyStart));
+  if (isIfelse) {
+    int jump = code.size();
+    code.push_back(Instruction(Instruction::opJump));
+    code[test].count = code.size();
+    compileBody(code, bodies[1], owner);
+    code[jump].count = code.size();
+  } else {
+    code[test].count = code.size();
+  }
+  return true;
+}
+
+void Kernel::compileStatement(QVector<Instruction> &code,
+                              const DatumP &statement, List *owner) {
+  code.push_back(Instruction(Instruction::opStatement));
+  if (compileControl(code, statement, owner))
+    return;
+  compileNode(code, statement, NULL);
+  code.push_back(Instruction(Instruction::opEndStatement));
+}
+
+void Kernel::compileList(List *aList) {
+  QVector<Instruction> &code = aList->bytecode;
+  code.clear();
+  aList->bytecodeTags.clear();
+  aList->bytecodeInlinedLists.clear();
+
+  listsBeingCompiled.push_back(aList);
+  const QList<DatumP> statements = aList->astList;
+  for (auto &statement : statements) {
+    ASTNode *a = statement.astnodeValue();
+    if (a->kernel == &Kernel::excTag) {
+      ASTNode *child = a->childAtIndex(0).astnodeValue();
+      if (child->kernel == &Kernel::executeLiteral) {
+        DatumP v = child->childAtIndex(0);
+        if (v.isWord()) {
+          QString tag = v.wordValue()->keyValue();
+          if (!aList->bytecodeTags.contains(tag))
+            aList->bytecodeTags[tag] = code.size();
+        }
+      }
+    }
+    compileStatement(code, statement, aList);
+  }
+  listsBeingCompiled.pop_back();
+  code.push_back(Instruction(Instruction::opHalt));
+}
+
+// Returns true if each runlist compiled into the bytecode of aList still has
+// the AST it was compiled from.
+bool Kernel::isBytecodeCurrent(List *aList) {
+  for (auto &inlined : aList->bytecodeInlinedLists) {
+    List *body = inlined.list.listValue();
+    if (!parser->isAstCurrent(body) ||
+        (body->astBuildNumber != inlined.buildNumber))
+      return false;
+  }
+  return true;
+}
+
+DatumP Kernel::checkedInput(DatumP value, const Instruction &instruction) {
+  if (instruction.parent != NULL) {
+    if (value == nothing) {
+      Error::didntOutput(instruction.node->nodeName,
+                         instruction.parent->nodeName);
+    }
+    if (value.isASTNode()) {
+      Error::notInsideProcedure(value.astnodeValue()->nodeName);
+    }
+  }
+  return value;
+}
+
+// The condition of an inlined IF or IFELSE is on top of the operand stack.
+// Anything other than TRUE or FALSE is given to ProcedureHelper, which runs a
+// list or rejects the input the same way it would for excIf().
+bool Kernel::testCondition(const Instruction &instruction) {
+  DatumP value = operandStack.last();
+  if (value.isWord()) {
+    QString key = value.wordValue()->keyValue();
+    if (key == "TRUE")
+      return true;
+    if (key == "FALSE")
+      return false;
+  }
+  preparedNode = instruction.node;
+  preparedInputsBase = operandStack.size() - 1;
+  preparedInputsCount = 1;
+  ProcedureHelper h(this, instruction.datum);
+  preparedNode = NULL;
+  return h.boolAtIndex(0, true);
+}
+
+// The count of an inlined REPEAT is on top of the operand stack.
+long Kernel::repeatCount(const Instruction &instruction) {
+  DatumP value = operandStack.last();
+  if (value.isWord()) {
+    double count = value.wordValue()->numberValue();
+    if (value.wordValue()->didNumberConversionSucceed() &&
+        (floor(count) == count) && (count >= 0) && (count <= INT_MAX))
+      return (long)count;
+  }
+  preparedNode = instruction.node;
+  preparedInputsBase = operandStack.size() - 1;
+  preparedInputsCount = 1;
+  ProcedureHelper h(this, instruction.datum);
+  preparedNode = NULL;
+  return h.validatedIntegerAtIndex(
+      0, [](long candidate) { return candidate >= 0; });
+}
+
+DatumP Kernel::runInstructions(const QVector<Instruction> &code, int pc,
+                               bool &didFinish) {
+#ifdef VM_THREADED_DISPATCH
+  // Must be in the same order as Instruction::Opcode
+  static const void *const dispatchTable[] = {
+      &&label_opStatement,       &&label_opEndStatement, &&label_opLiteral,
+      &&label_opValueOf,         &&label_opCall,         &&label_opEval,
+      &&label_opEnterProcedure,  &&label_opCallProcedure,
+      &&label_opTailProcedure,   &&label_opHalt,         &&label_opReturn,
+      &&label_opJump,            &&label_opTest,         &&label_opRepeat,
+      &&label_opRepeatNext,      &&label_opBody,         &&label_opEndBody,
+      &&label_opExit};
+#endif
+
+  const int stackBase = operandStack.size();
+  int openScopes = 0;
+  QVector<RepeatLoop> loops;
+  DatumP retval;
+
+  try {
+    VM_BEGIN()
+
+    VM_OP(opStatement) {
+      if (retval != nothing) {
+        if (retval.isASTNode()) {
+          if (!loops.isEmpty())
+            repcount = loops.first().savedRepcount;
+          didFinish = false;
+          return retval;
+        }
+        Error::dontSay(retval);
+      }
+      drainReleaseQueue(releaseBatchSize);
+      VM_NEXT()
+    }
+
+    VM_OP(opEndStatement) {
+      retval = operandStack.takeLast();
+      VM_NEXT()
+    }
+
+    VM_OP(opLiteral) {
+      operandStack.push_back(code[pc].datum);
+      VM_NEXT()
+    }
+
+    VM_OP(opValueOf) {
+      const Instruction &instruction = code[pc];
+      DatumP varnameP = instruction.node->childAtIndex(0);
+      DatumP value =
+          variables.datumForName(varnameP.wordValue()->symbolValue());
+      if (value == nothing)
+        value = Error::noValueRecoverable(varnameP);
+      operandStack.push_back(checkedInput(value, instruction));
+      VM_NEXT()
+    }
+
+    VM_OP(opCall) {
+      const Instruction &instruction = code[pc];
+      ASTNode *node = instruction.node;
+      KernelMethod method = node->kernel;
+      preparedNode = node;
+      preparedInputsBase = operandStack.size() - instruction.count;
+      preparedInputsCount = instruction.count;
+      DatumP result = (this->*method)(instruction.datum);
+      preparedNode = NULL;
+      operandStack.resize(operandStack.size() - instruction.count);
+      operandStack.push_back(checkedInput(result, instruction));
+      VM_NEXT()
+    }
+
+    VM_OP(opEval) {
+      const Instruction &instruction = code[pc];
+      KernelMethod method = instruction.node->kernel;
+      DatumP result = (this->*method)(instruction.datum);
+      operandStack.push_back(checkedInput(result, instruction));
+      VM_NEXT()
+    }
+
+    VM_OP(opEnterProcedure) {
+      variables.upScope();
+      ++openScopes;
+      if (procedureIterationDepth > maxIterationDepth) {
+        Error::stackOverflow();
+      }
+      VM_NEXT()
+    }
+
+    VM_OP(opCallProcedure) {
+      const Instruction &instruction = code[pc];
+      preparedNode = instruction.node;
+      preparedInputsBase = operandStack.size() - instruction.count;
+      preparedInputsCount = instruction.count;
+      DatumP result = executeProcedureInScope(instruction.datum);
+      preparedNode = NULL;
+      variables.downScope();
+      --openScopes;
+      operandStack.resize(operandStack.size() - instruction.count);
+      operandStack.push_back(checkedInput(result, instruction));
+      VM_NEXT()
+    }
+
+    VM_OP(opTailProcedure) {
+      const Instruction &instruction = code[pc];
+      preparedNode = instruction.node;
+      preparedInputsBase = operandStack.size() - instruction.count;
+      preparedInputsCount = instruction.count;
+      DatumP result = executeProcedureCore(instruction.datum);
+      preparedNode = NULL;
+      operandStack.resize(operandStack.size() - instruction.count);
+      operandStack.push_back(result);
+      VM_NEXT()
+    }
+
+    VM_OP(opHalt) {
+      didFinish = true;
+      return retval;
+    }
+
+    VM_OP(opReturn) {
+      didFinish = true;
+      return operandStack.takeLast();
+    }
+
+    VM_OP(opJump) {
+      pc = code[pc].count;
+      VM_JUMP()
+    }
+
+    VM_OP(opTest) {
+      const Instruction &instruction = code[pc];
+      bool isTrue = testCondition(instruction);
+      operandStack.pop_back();
+      if (isTrue) {
+        VM_NEXT()
+      }
+      pc = instruction.count;
+      VM_JUMP()
+    }
+
+    VM_OP(opRepeat) {
+      const Instruction &instruction = code[pc];
+      long count = repeatCount(instruction);
+      operandStack.pop_back();
+      if (count == 0) {
+        pc = instruction.count;
+        VM_JUMP()
+      }
+      loops.push_back({count, repcount});
+      repcount = 1;
+      VM_NEXT()
+    }
+
+    VM_OP(opRepeatNext) {
+      RepeatLoop &loop = loops.last();
+      --loop.remaining;
+      ++repcount;
+      if ((retval == nothing) && (loop.remaining > 0)) {
+        pc = code[pc].count;
+        VM_JUMP()
+      }
+      repcount = loop.savedRepcount;
+      loops.pop_back();
+      VM_NEXT()
+    }
+
+    VM_OP(opBody) {
+      const Instruction &instruction = code[pc];
+      List *body = instruction.datum.listValue();
+      if (parser->isAstCurrent(body) &&
+          (body->astBuildNumber == instruction.buildNumber)) {
+        VM_NEXT()
+      }
+      // The runlist has been changed or reparsed since it was compiled.
+      retval = runList(instruction.datum);
+      pc = instruction.count;
+      VM_JUMP()
+    }
+
+    VM_OP(opEndBody) {
+      processEventQueue();
+      VM_NEXT()
+    }
+
+    VM_OP(opExit) {
+      const Instruction &instruction = code[pc];
+      if (currentProcedure == nothing)
+        Error::notInsideProcedure(instruction.node->nodeName);
+      retval = instruction.datum;
+      VM_NEXT()
+    }
+
+    VM_END()
+  } catch (Error *e) {
+    operandStack.resize(stackBase);
+    preparedNode = NULL;
+    if (!loops.isEmpty())
+      repcount = loops.first().savedRepcount;
+    while (openScopes > 0) {
+      variables.downScope();
+      --openScopes;
+    }
+    throw e;
+  }
+  return retval;
+}
+
+DatumP Kernel::runBytecode(DatumP listP, const QString &startTag,
+                           bool &didFinish) {
+  List *aList = listP.listValue();
+  parser->astFromList(aList);
+  if (aList->bytecode.isEmpty() || !isBytecodeCurrent(aList))
+    compileList(aList);
+
+  // Take a shallow copy so that recompiling this list during execution
+  // doesn't disturb the running code.
+  const QVector<Instruction> code = aList->bytecode;
+  int pc = 0;
+  if (startTag != "") {
+    pc = aList->bytecodeTags.value(startTag, -1);
+    if (pc < 0) {
+      didFinish = true;
+      return nothing;
+    }
+  }
+  return runInstructions(code, pc, didFinish);
+}
+
+// Evaluate the expression given to OUTPUT. A procedure call here is a tail
+// call, so it runs in the scope of the procedure that is outputting.
+DatumP Kernel::runOutputExpression(const DatumP &nodeP) {
+  ASTNode *node = nodeP.astnodeValue();
+  if (node->bytecode.isEmpty()) {
+    QVector<Instruction> code;
+    if (node->kernel == &Kernel::executeProcedure) {
+      int count = compileInputs(code, node);
+      code.push_back(
+          Instruction(Instruction::opTailProcedure, nodeP, count, NULL));
+    } else {
+      compileNode(code, nodeP, NULL);
+    }
+    code.push_back(Instruction(Instruction::opReturn));
+    node->bytecode = code;
+  }
+
+  const QVector<Instruction> code = node->bytecode;
+  bool didFinish;
+  return runInstructions(code, 0, didFinish);
+}
@@ -175,7 +175,7 @@ void Kernel::sysPrint(const QString &text) { lprint(systemWriteStream, text); }
 
 // TRANSMITTERS
 
-DatumP Kernel::excPrint(DatumP node) {
+DatumP Kernel::excPrint(const DatumP &node) {
   ProcedureHelper h(this, node);
   QString printString = "";
   for (int i = 0; i < h.countOfChildren(); ++i) {
@@ -190,7 +190,7 @@ DatumP Kernel::excPrint(DatumP node) {
   return nothing;
 }
 
-DatumP Kernel::excType(DatumP node) {
+DatumP Kernel::excType(const DatumP &node) {
   ProcedureHelper h(this, node);
   QString printString = "";
   for (int i = 0; i < h.countOfChildren(); ++i) {
@@ -202,7 +202,7 @@ DatumP Kernel::excType(DatumP node) {
   return nothing;
 }
 
-DatumP Kernel::excShow(DatumP node) {
+DatumP Kernel::excShow(const DatumP &node) {
   ProcedureHelper h(this, node);
   QString printString = "";
   for (int i = 0; i < h.countOfChildren(); ++i) {
@@ -219,7 +219,7 @@ DatumP Kernel::excShow(DatumP node) {
 
 // RECEIVERS
 
-DatumP Kernel::excReadlist(DatumP node) {
+DatumP Kernel::excReadlist(const DatumP &node) {
   ProcedureHelper h(this, node);
   DatumP retval = readlistWithPrompt("", false, readStream);
   if (retval == nothing)
@@ -227,7 +227,7 @@ DatumP Kernel::excReadlist(DatumP node) {
   return h.ret(retval);
 }
 
-DatumP Kernel::excReadword(DatumP node) {
+DatumP Kernel::excReadword(const DatumP &node) {
   ProcedureHelper h(this, node);
   DatumP retval = readWordWithPrompt("", readStream);
   if (retval == nothing)
@@ -235,7 +235,7 @@ DatumP Kernel::excReadword(DatumP node) {
   return h.ret(retval);
 }
 
-DatumP Kernel::excReadrawline(DatumP node) {
+DatumP Kernel::excReadrawline(const DatumP &node) {
   ProcedureHelper h(this, node);
   DatumP retval = readRawLineWithPrompt("", readStream);
   if (retval == nothing)
@@ -243,7 +243,7 @@ DatumP Kernel::excReadrawline(DatumP node) {
   return h.ret(retval);
 }
 
-DatumP Kernel::excReadchar(DatumP node) {
+DatumP Kernel::excReadchar(const DatumP &node) {
   ProcedureHelper h(this, node);
   DatumP retval = readChar();
   if (retval == nothing)
@@ -251,7 +251,7 @@ DatumP Kernel::excReadchar(DatumP node) {
   return h.ret(retval);
 }
 
-DatumP Kernel::excReadchars(DatumP node) {
+DatumP Kernel::excReadchars(const DatumP &node) {
   ProcedureHelper h(this, node);
   int count = h.validatedIntegerAtIndex(
       0, [](long candidate) { return candidate >= 0; });
@@ -271,7 +271,7 @@ DatumP Kernel::excReadchars(DatumP node) {
   return h.ret(new Word(retval));
 }
 
-DatumP Kernel::excShell(DatumP node) {
+DatumP Kernel::excShell(const DatumP &node) {
   ProcedureHelper h(this, node);
   DatumP commandP = h.validatedDatumAtIndex(0, [](DatumP candidate) {
     if (candidate.isWord())
@@ -338,7 +338,7 @@ DatumP Kernel::excShell(DatumP node) {
 
 // FILE ACCESS
 
-DatumP Kernel::excSetprefix(DatumP node) {
+DatumP Kernel::excSetprefix(const DatumP &node) {
   ProcedureHelper h(this, node);
   DatumP newPrefix = h.validatedDatumAtIndex(0, [](DatumP candidate) {
     if (candidate.isList() && (candidate.listValue()->size() == 0))
@@ -354,7 +354,7 @@ DatumP Kernel::excSetprefix(DatumP node) {
   return nothing;
 }
 
-DatumP Kernel::excPrefix(DatumP node) {
+DatumP Kernel::excPrefix(const DatumP &node) {
   ProcedureHelper h(this, node);
   if (filePrefix == nothing) {
     return h.ret(new List);
@@ -362,7 +362,7 @@ DatumP Kernel::excPrefix(DatumP node) {
   return h.ret(filePrefix);
 }
 
-DatumP Kernel::excOpenread(DatumP node) {
+DatumP Kernel::excOpenread(const DatumP &node) {
   ProcedureHelper h(this, node);
   QIODevice::OpenMode openFlags = QIODevice::ReadOnly | QIODevice::Text;
   QTextStream *stream = open(h, openFlags);
@@ -371,7 +371,7 @@ DatumP Kernel::excOpenread(DatumP node) {
   return nothing;
 }
 
-DatumP Kernel::excOpenwrite(DatumP node) {
+DatumP Kernel::excOpenwrite(const DatumP &node) {
   ProcedureHelper h(this, node);
   QIODevice::OpenMode openFlags =
       QIODevice::WriteOnly | QIODevice::Truncate | QIODevice::Text;
@@ -381,7 +381,7 @@ DatumP Kernel::excOpenwrite(DatumP node) {
   return nothing;
 }
 
-DatumP Kernel::excOpenappend(DatumP node) {
+DatumP Kernel::excOpenappend(const DatumP &node) {
   ProcedureHelper h(this, node);
   QIODevice::OpenMode openFlags =
       QIODevice::WriteOnly | QIODevice::Append | QIODevice::Text;
@@ -391,7 +391,7 @@ DatumP Kernel::excOpenappend(DatumP node) {
   return nothing;
 }
 
-DatumP Kernel::excOpenupdate(DatumP node) {
+DatumP Kernel::excOpenupdate(const DatumP &node) {
   ProcedureHelper h(this, node);
   QIODevice::OpenMode openFlags = QIODevice::ReadWrite | QIODevice::Text;
   QTextStream *stream = open(h, openFlags);
@@ -401,7 +401,7 @@ DatumP Kernel::excOpenupdate(DatumP node) {
   return nothing;
 }
 
-DatumP Kernel::excClose(DatumP node) {
+DatumP Kernel::excClose(const DatumP &node) {
   ProcedureHelper h(this, node);
   DatumP filenameP = h.wordAtIndex(0);
   QString filename = filenameP.wordValue()->keyValue();
@@ -414,7 +414,7 @@ DatumP Kernel::excClose(DatumP node) {
   return nothing;
 }
 
-DatumP Kernel::excAllopen(DatumP node) {
+DatumP Kernel::excAllopen(const DatumP &node) {
   ProcedureHelper h(this, node);
   List *retval = new List;
   DatumP retvalP = h.ret(retval);
@@ -424,13 +424,13 @@ DatumP Kernel::excAllopen(DatumP node) {
   return retvalP;
 }
 
-DatumP Kernel::excCloseall(DatumP node) {
+DatumP Kernel::excCloseall(const DatumP &node) {
   ProcedureHelper h(this, node);
   closeAll();
   return h.ret();
 }
 
-DatumP Kernel::excErasefile(DatumP node) {
+DatumP Kernel::excErasefile(const DatumP &node) {
   ProcedureHelper h(this, node);
   DatumP filenameP = h.wordAtIndex(0);
 
@@ -441,7 +441,7 @@ DatumP Kernel::excErasefile(DatumP node) {
   return nothing;
 }
 
-DatumP Kernel::excDribble(DatumP node) {
+DatumP Kernel::excDribble(const DatumP &node) {
   ProcedureHelper h(this, node);
   DatumP filenameP = h.wordAtIndex(0);
 
@@ -456,25 +456,25 @@ DatumP Kernel::excDribble(DatumP node) {
   return nothing;
 }
 
-DatumP Kernel::excNodribble(DatumP node) {
+DatumP Kernel::excNodribble(const DatumP &node) {
   ProcedureHelper h(this, node);
   mainController()->setDribble("");
   return h.ret();
 }
 
-DatumP Kernel::excSetread(DatumP node) {
+DatumP Kernel::excSetread(const DatumP &node) {
   ProcedureHelper h(this, node);
   readStream = getStream(h);
   return nothing;
 }
 
-DatumP Kernel::excSetwrite(DatumP node) {
+DatumP Kernel::excSetwrite(const DatumP &node) {
   ProcedureHelper h(this, node);
   writeStream = getStream(h);
   return nothing;
 }
 
-DatumP Kernel::excReader(DatumP node) {
+DatumP Kernel::excReader(const DatumP &node) {
   ProcedureHelper h(this, node);
   if (readStream == NULL)
     return h.ret(new List);
@@ -483,7 +483,7 @@ DatumP Kernel::excReader(DatumP node) {
   return h.ret(new Word(retval));
 }
 
-DatumP Kernel::excWriter(DatumP node) {
+DatumP Kernel::excWriter(const DatumP &node) {
   ProcedureHelper h(this, node);
   if (writeStream == NULL)
     return h.ret(new List);
@@ -492,7 +492,7 @@ DatumP Kernel::excWriter(DatumP node) {
   return h.ret(new Word(retval));
 }
 
-DatumP Kernel::excSetreadpos(DatumP node) {
+DatumP Kernel::excSetreadpos(const DatumP &node) {
   ProcedureHelper h(this, node);
   long pos = h.validatedIntegerAtIndex(
       0, [](long candidate) { return candidate >= 0; });
@@ -502,7 +502,7 @@ DatumP Kernel::excSetreadpos(DatumP node) {
   return nothing;
 }
 
-DatumP Kernel::excSetwritepos(DatumP node) {
+DatumP Kernel::excSetwritepos(const DatumP &node) {
   ProcedureHelper h(this, node);
   long pos = h.validatedIntegerAtIndex(
       0, [](long candidate) { return candidate >= 0; });
@@ -512,7 +512,7 @@ DatumP Kernel::excSetwritepos(DatumP node) {
   return nothing;
 }
 
-DatumP Kernel::excReadpos(DatumP node) {
+DatumP Kernel::excReadpos(const DatumP &node) {
   ProcedureHelper h(this, node);
   double retval = 0;
 
@@ -522,7 +522,7 @@ DatumP Kernel::excReadpos(DatumP node) {
   return h.ret(new Word(retval));
 }
 
-DatumP Kernel::excWritepos(DatumP node) {
+DatumP Kernel::excWritepos(const DatumP &node) {
   ProcedureHelper h(this, node);
   double retval = 0;
 
@@ -534,7 +534,7 @@ DatumP Kernel::excWritepos(DatumP node) {
   return h.ret(new Word(retval));
 }
 
-DatumP Kernel::excEofp(DatumP node) {
+DatumP Kernel::excEofp(const DatumP &node) {
   ProcedureHelper h(this, node);
   bool retval =
       (readStream != NULL) ? readStream->atEnd() : mainController()->atEnd();
@@ -543,20 +543,20 @@ DatumP Kernel::excEofp(DatumP node) {
 
 // TERMINAL ACCESS
 
-DatumP Kernel::excKeyp(DatumP node) {
+DatumP Kernel::excKeyp(const DatumP &node) {
   ProcedureHelper h(this, node);
   bool retval = (readStream != NULL) ? !readStream->atEnd()
                                      : mainController()->keyQueueHasChars();
   return h.ret(retval);
 }
 
-DatumP Kernel::excCleartext(DatumP node) {
+DatumP Kernel::excCleartext(const DatumP &node) {
   ProcedureHelper h(this, node);
   mainController()->clearScreenText();
   return nothing;
 }
 
-DatumP Kernel::excSetcursor(DatumP node) {
+DatumP Kernel::excSetcursor(const DatumP &node) {
   ProcedureHelper h(this, node);
   QVector<double> v;
   h.validatedDatumAtIndex(0, [&v, this](DatumP candidate) {
@@ -577,7 +577,7 @@ DatumP Kernel::excSetcursor(DatumP node) {
   return nothing;
 }
 
-DatumP Kernel::excCursor(DatumP node) {
+DatumP Kernel::excCursor(const DatumP &node) {
   ProcedureHelper h(this, node);
   int row = 0, col = 0;
   mainController()->getTextCursorPos(row, col);
@@ -588,7 +588,7 @@ DatumP Kernel::excCursor(DatumP node) {
   return retvalP;
 }
 
-DatumP Kernel::excSettextcolor(DatumP node) {
+DatumP Kernel::excSettextcolor(const DatumP &node) {
   ProcedureHelper h(this, node);
   QColor foreground;
   // TODO: current background color might not be white
@@ -610,7 +610,7 @@ DatumP Kernel::excSettextcolor(DatumP node) {
   return nothing;
 }
 
-DatumP Kernel::excIncreasefont(DatumP node) {
+DatumP Kernel::excIncreasefont(const DatumP &node) {
   ProcedureHelper h(this, node);
   double f = mainController()->getTextSize();
   f += 2;
@@ -619,7 +619,7 @@ DatumP Kernel::excIncreasefont(DatumP node) {
   return h.ret();
 }
 
-DatumP Kernel::excDecreasefont(DatumP node) {
+DatumP Kernel::excDecreasefont(const DatumP &node) {
   ProcedureHelper h(this, node);
   double f = mainController()->getTextSize();
   f -= 2;
@@ -629,7 +629,7 @@ DatumP Kernel::excDecreasefont(DatumP node) {
   return h.ret();
 }
 
-DatumP Kernel::excSettextsize(DatumP node) {
+DatumP Kernel::excSettextsize(const DatumP &node) {
   ProcedureHelper h(this, node);
   double newSize = h.validatedNumberAtIndex(
       0, [](double candidate) { return candidate >= 1; });
@@ -637,26 +637,26 @@ DatumP Kernel::excSettextsize(DatumP node) {
   return nothing;
 }
 
-DatumP Kernel::excTextsize(DatumP node) {
+DatumP Kernel::excTextsize(const DatumP &node) {
   ProcedureHelper h(this, node);
   double size = mainController()->getTextSize();
   return h.ret(new Word(size));
 }
 
-DatumP Kernel::excSetfont(DatumP node) {
+DatumP Kernel::excSetfont(const DatumP &node) {
   ProcedureHelper h(this, node);
   QString fontName = h.wordAtIndex(0).wordValue()->printValue();
   mainController()->setFontName(fontName);
   return nothing;
 }
 
-DatumP Kernel::excFont(DatumP node) {
+DatumP Kernel::excFont(const DatumP &node) {
   ProcedureHelper h(this, node);
   QString retval = mainController()->getFontName();
   return h.ret(new Word(retval));
 }
 
-DatumP Kernel::excAllfonts(DatumP node) {
+DatumP Kernel::excAllfonts(const DatumP &node) {
   ProcedureHelper h(this, node);
   List *retval = new List;
   QStringList fonts = mainController()->getAllFontNames();
@@ -666,21 +666,21 @@ DatumP Kernel::excAllfonts(DatumP node) {
   return h.ret(retval);
 }
 
-DatumP Kernel::excCursorInsert(DatumP node) {
+DatumP Kernel::excCursorInsert(const DatumP &node) {
   ProcedureHelper h(this, node);
   cursorOverwrite = false;
   mainController()->setCursorOverwriteMode(false);
   return h.ret(nothing);
 }
 
-DatumP Kernel::excCursorOverwrite(DatumP node) {
+DatumP Kernel::excCursorOverwrite(const DatumP &node) {
   ProcedureHelper h(this, node);
   cursorOverwrite = true;
   mainController()->setCursorOverwriteMode(true);
   return h.ret(nothing);
 }
 
-DatumP Kernel::excCursorMode(DatumP node) {
+DatumP Kernel::excCursorMode(const DatumP &node) {
   ProcedureHelper h(this, node);
   QString retval = cursorOverwrite ? "OVERWRITE" : "INSERT";
   DatumP retvalP(new Word(retval));
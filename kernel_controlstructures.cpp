@@ -34,7 +34,7 @@ const QString inputlistStr = "*inputlist*";
 
 // CONTROL STRUCTURES
 
-DatumP Kernel::excRun(DatumP node) {
+DatumP Kernel::excRun(const DatumP &node) {
   ProcedureHelper h(this, node);
 
   DatumP instructionList = h.validatedDatumAtIndex(0, [](DatumP candidate) {
@@ -44,7 +44,7 @@ DatumP Kernel::excRun(DatumP node) {
   return h.ret(runList(instructionList));
 }
 
-DatumP Kernel::excRunresult(DatumP node) {
+DatumP Kernel::excRunresult(const DatumP &node) {
   ProcedureHelper h(this, node);
 
   DatumP instructionList = h.validatedDatumAtIndex(0, [](DatumP candidate) {
@@ -65,7 +65,7 @@ DatumP Kernel::excRunresult(DatumP node) {
   return retval;
 }
 
-DatumP Kernel::excBye(DatumP node) {
+DatumP Kernel::excBye(const DatumP &node) {
   ProcedureHelper h(this, node);
 
   Error::throwError(DatumP(new Word("SYSTEM")), nothing);
@@ -73,7 +73,7 @@ DatumP Kernel::excBye(DatumP node) {
   return h.ret();
 }
 
-DatumP Kernel::excRepeat(DatumP node) {
+DatumP Kernel::excRepeat(const DatumP &node) {
   ProcedureHelper h(this, node);
   long countValue = h.validatedIntegerAtIndex(
       0, [](long candidate) { return candidate >= 0; });
@@ -99,7 +99,7 @@ DatumP Kernel::excRepeat(DatumP node) {
   return h.ret(retval);
 }
 
-DatumP Kernel::excForever(DatumP node) {
+DatumP Kernel::excForever(const DatumP &node) {
   ProcedureHelper h(this, node);
   DatumP commandList = h.listAtIndex(0);
 
@@ -120,13 +120,13 @@ DatumP Kernel::excForever(DatumP node) {
   return h.ret(retval);
 }
 
-DatumP Kernel::excRepcount(DatumP node) {
+DatumP Kernel::excRepcount(const DatumP &node) {
   ProcedureHelper h(this, node);
 
   return h.ret(new Word(repcount));
 }
 
-DatumP Kernel::excIf(DatumP node) {
+DatumP Kernel::excIf(const DatumP &node) {
   ProcedureHelper h(this, node);
   DatumP retval;
   if (h.boolAtIndex(0, true)) {
@@ -135,7 +135,7 @@ DatumP Kernel::excIf(DatumP node) {
   return h.ret(retval);
 }
 
-DatumP Kernel::excIfelse(DatumP node) {
+DatumP Kernel::excIfelse(const DatumP &node) {
   ProcedureHelper h(this, node);
   DatumP retval;
   if (h.boolAtIndex(0, true)) {
@@ -146,7 +146,7 @@ DatumP Kernel::excIfelse(DatumP node) {
   return h.ret(retval);
 }
 
-DatumP Kernel::excTest(DatumP node) {
+DatumP Kernel::excTest(const DatumP &node) {
   ProcedureHelper h(this, node);
 
   bool testVal = h.boolAtIndex(0, true);
@@ -154,7 +154,7 @@ DatumP Kernel::excTest(DatumP node) {
   return nothing;
 }
 
-DatumP Kernel::excIftrue(DatumP node) {
+DatumP Kernel::excIftrue(const DatumP &node) {
   ProcedureHelper h(this, node);
   DatumP retval;
   if (!variables.isTested())
@@ -165,7 +165,7 @@ DatumP Kernel::excIftrue(DatumP node) {
   return h.ret(retval);
 }
 
-DatumP Kernel::excIffalse(DatumP node) {
+DatumP Kernel::excIffalse(const DatumP &node) {
   ProcedureHelper h(this, node);
   DatumP retval;
   if (!variables.isTested())
@@ -182,14 +182,14 @@ DatumP Kernel::excIffalse(DatumP node) {
 // The caller is responsible for dissecting the node and acting appropriately.
 //
 
-DatumP Kernel::excStop(DatumP node) {
+DatumP Kernel::excStop(const DatumP &node) {
   if (currentProcedure == nothing) {
     Error::notInsideProcedure(node.astnodeValue()->nodeName);
   }
   return node;
 }
 
-DatumP Kernel::excOutput(DatumP node) {
+DatumP Kernel::excOutput(const DatumP &node) {
   if (currentProcedure == nothing) {
     Error::notInsideProcedure(node.astnodeValue()->nodeName);
   }
@@ -197,14 +197,14 @@ DatumP Kernel::excOutput(DatumP node) {
   return node;
 }
 
-DatumP Kernel::excDotMaybeoutput(DatumP node) {
+DatumP Kernel::excDotMaybeoutput(const DatumP &node) {
   if (currentProcedure == nothing) {
     Error::notInsideProcedure(node.astnodeValue()->nodeName);
   }
   return node;
 }
 
-DatumP Kernel::excCatch(DatumP node) {
+DatumP Kernel::excCatch(const DatumP &node) {
   ProcedureHelper h(this, node);
   QString erract("ERRACT");
   QString tag = h.wordAtIndex(0).wordValue()->keyValue();
@@ -259,7 +259,7 @@ DatumP Kernel::excCatch(DatumP node) {
   return h.ret(retval);
 }
 
-DatumP Kernel::excThrow(DatumP node) {
+DatumP Kernel::excThrow(const DatumP &node) {
   ProcedureHelper h(this, node);
   DatumP tag = h.wordAtIndex(0);
   DatumP value;
@@ -274,7 +274,7 @@ DatumP Kernel::excThrow(DatumP node) {
   return nothing;
 }
 
-DatumP Kernel::excError(DatumP node) {
+DatumP Kernel::excError(const DatumP &node) {
   ProcedureHelper h(this, node);
 
   List *retval = new List;
@@ -295,13 +295,13 @@ DatumP Kernel::excError(DatumP node) {
   return h.ret(retval);
 }
 
-DatumP Kernel::excPause(DatumP node) {
+DatumP Kernel::excPause(const DatumP &node) {
   ProcedureHelper h(this, node);
 
   return h.ret(pause());
 }
 
-DatumP Kernel::excContinue(DatumP node) {
+DatumP Kernel::excContinue(const DatumP &node) {
   ProcedureHelper h(this, node);
 
   DatumP retval;
@@ -317,13 +317,13 @@ DatumP Kernel::excContinue(DatumP node) {
   return nothing;
 }
 
-DatumP Kernel::excTag(DatumP) { return nothing; }
+DatumP Kernel::excTag(const DatumP &) { return nothing; }
 
 // This doesn't do anything or get called. It's just a token that gets passed
 // when GOTO is used
-DatumP Kernel::excGotoCore(DatumP) { return nothing; }
+DatumP Kernel::excGotoCore(const DatumP &) { return nothing; }
 
-DatumP Kernel::excGoto(DatumP node) {
+DatumP Kernel::excGoto(const DatumP &node) {
   ProcedureHelper h(this, node);
   if (currentProcedure == nothing)
     Error::notInsideProcedure(node.astnodeValue()->nodeName);
@@ -344,7 +344,7 @@ DatumP Kernel::excGoto(DatumP node) {
 
 // TEMPLATE-BASED ITERATION
 
-DatumP Kernel::excApply(DatumP node) {
+DatumP Kernel::excApply(const DatumP &node) {
   ProcedureHelper h(this, node);
   enum Form { explicit_slot, named_procedure, lambda, procedure };
   Form f;
@@ -445,7 +445,7 @@ DatumP Kernel::excApply(DatumP node) {
 }
 
 // '?' operator
-DatumP Kernel::excNamedSlot(DatumP node) {
+DatumP Kernel::excNamedSlot(const DatumP &node) {
   ProcedureHelper h(this, node);
   DatumP inputList = variables.datumForName(inputlistStr);
   if (!inputList.isList())
@@ -460,7 +460,7 @@ DatumP Kernel::excNamedSlot(DatumP node) {
   return h.ret(inputList.listValue()->datumAtIndex((int)index));
 }
 
-DatumP Kernel::excMacrop(DatumP node) {
+DatumP Kernel::excMacrop(const DatumP &node) {
   ProcedureHelper h(this, node);
   bool retval = parser->isMacro(h.wordAtIndex(0).wordValue()->keyValue());
   return h.ret(retval);
@@ -32,7 +32,7 @@
 
 // CONSTRUCTORS
 
-DatumP Kernel::excWord(DatumP node) {
+DatumP Kernel::excWord(const DatumP &node) {
   ProcedureHelper h(this, node);
   QString retval = "";
   for (int i = 0; i < h.countOfChildren(); ++i) {
@@ -42,7 +42,7 @@ DatumP Kernel::excWord(DatumP node) {
   return h.ret(new Word(retval));
 }
 
-DatumP Kernel::excList(DatumP node) {
+DatumP Kernel::excList(const DatumP &node) {
   ProcedureHelper h(this, node);
   List *retval = new List;
   DatumP retvalP = h.ret(retval);
@@ -53,7 +53,7 @@ DatumP Kernel::excList(DatumP node) {
   return retvalP;
 }
 
-DatumP Kernel::excSentence(DatumP node) {
+DatumP Kernel::excSentence(const DatumP &node) {
   ProcedureHelper h(this, node);
   List *retval = new List;
   DatumP retvalP = h.ret(retval);
@@ -72,7 +72,7 @@ DatumP Kernel::excSentence(DatumP node) {
   return retvalP;
 }
 
-DatumP Kernel::excFput(DatumP node) {
+DatumP Kernel::excFput(const DatumP &node) {
   ProcedureHelper h(this, node);
   DatumP thing = h.datumAtIndex(0);
   DatumP list = h.validatedDatumAtIndex(1, [&thing](DatumP candidate) {
@@ -88,7 +88,7 @@ DatumP Kernel::excFput(DatumP node) {
   return h.ret(new Word(retval));
 }
 
-DatumP Kernel::excLput(DatumP node) {
+DatumP Kernel::excLput(const DatumP &node) {
   ProcedureHelper h(this, node);
   DatumP thing = h.datumAtIndex(0);
   DatumP list = h.validatedDatumAtIndex(1, [&thing](DatumP candidate) {
@@ -97,21 +97,14 @@ DatumP Kernel::excLput(DatumP node) {
     return candidate.isList();
   });
   if (list.isList()) {
-    List *retval = new List;
-    DatumP retvalP = h.ret(retval);
-    ListIterator iter = list.listValue()->newIterator();
-    while (iter.elementExists()) {
-      retval->append(iter.element());
-    }
-    retval->append(thing);
-    return retvalP;
+    return h.ret(list.listValue()->lput(thing));
   }
   QString retval = list.wordValue()->rawValue();
   retval.append(thing.wordValue()->rawValue());
   return h.ret(new Word(retval));
 }
 
-DatumP Kernel::excArray(DatumP node) {
+DatumP Kernel::excArray(const DatumP &node) {
   ProcedureHelper h(this, node);
   int origin = 1;
   int size = h.integerAtIndex(0);
@@ -121,7 +114,7 @@ DatumP Kernel::excArray(DatumP node) {
   return h.ret(new Array(origin, size));
 }
 
-DatumP Kernel::excListtoarray(DatumP node) {
+DatumP Kernel::excListtoarray(const DatumP &node) {
   ProcedureHelper h(this, node);
   int origin = 1;
   DatumP source = h.listAtIndex(0);
@@ -131,7 +124,7 @@ DatumP Kernel::excListtoarray(DatumP node) {
   return h.ret(new Array(origin, source.listValue()));
 }
 
-DatumP Kernel::excArraytolist(DatumP node) {
+DatumP Kernel::excArraytolist(const DatumP &node) {
   ProcedureHelper h(this, node);
   DatumP source = h.arrayAtIndex(0);
   return h.ret(new List(source.arrayValue()));
@@ -139,14 +132,14 @@ DatumP Kernel::excArraytolist(DatumP node) {
 
 // SELECTORS
 
-DatumP Kernel::excFirst(DatumP node) {
+DatumP Kernel::excFirst(const DatumP &node) {
   ProcedureHelper h(this, node);
   DatumP value = h.validatedDatumAtIndex(
       0, [](DatumP candidate) { return candidate.datumValue()->size() >= 1; });
   return h.ret(value.datumValue()->first());
 }
 
-DatumP Kernel::excFirsts(DatumP node) {
+DatumP Kernel::excFirsts(const DatumP &node) {
   ProcedureHelper h(this, node);
   List *retval = new List;
   DatumP retvalP = h.ret(retval);
@@ -163,21 +156,21 @@ DatumP Kernel::excFirsts(DatumP node) {
   return retvalP;
 }
 
-DatumP Kernel::excLast(DatumP node) {
+DatumP Kernel::excLast(const DatumP &node) {
   ProcedureHelper h(this, node);
   DatumP value = h.validatedDatumAtIndex(
       0, [](DatumP candidate) { return candidate.datumValue()->size() > 0; });
   return h.ret(value.datumValue()->last());
 }
 
-DatumP Kernel::excButfirst(DatumP node) {
+DatumP Kernel::excButfirst(const DatumP &node) {
   ProcedureHelper h(this, node);
   DatumP value = h.validatedDatumAtIndex(
       0, [](DatumP candidate) { return candidate.datumValue()->size() > 0; });
   return h.ret(value.datumValue()->butfirst());
 }
 
-DatumP Kernel::excButfirsts(DatumP node) {
+DatumP Kernel::excButfirsts(const DatumP &node) {
   ProcedureHelper h(this, node);
   List *retval = new List;
   DatumP retvalP = h.ret(retval);
@@ -194,14 +187,14 @@ DatumP Kernel::excButfirsts(DatumP node) {
   return retvalP;
 }
 
-DatumP Kernel::excButlast(DatumP node) {
+DatumP Kernel::excButlast(const DatumP &node) {
   ProcedureHelper h(this, node);
   DatumP value = h.validatedDatumAtIndex(
       0, [](DatumP candidate) { return candidate.datumValue()->size() > 0; });
   return h.ret(value.datumValue()->butlast());
 }
 
-DatumP Kernel::excItem(DatumP node) {
+DatumP Kernel::excItem(const DatumP &node) {
   ProcedureHelper h(this, node);
   DatumP thing = h.datumAtIndex(1);
   long index = h.validatedIntegerAtIndex(0, [&thing](long candidate) {
@@ -213,7 +206,7 @@ DatumP Kernel::excItem(DatumP node) {
 
 // MUTATORS
 
-DatumP Kernel::excSetitem(DatumP node) {
+DatumP Kernel::excSetitem(const DatumP &node) {
   ProcedureHelper h(this, node);
   DatumP array = h.validatedDatumAtIndex(1, [](DatumP candidate) {
     return candidate.isList() || candidate.isArray();
@@ -233,7 +226,7 @@ DatumP Kernel::excSetitem(DatumP node) {
   return nothing;
 }
 
-DatumP Kernel::excDotSetfirst(DatumP node) {
+DatumP Kernel::excDotSetfirst(const DatumP &node) {
   ProcedureHelper h(this, node);
   DatumP array = h.validatedDatumAtIndex(0, [](DatumP candidate) {
     if (!candidate.isList() && !candidate.isArray())
@@ -245,7 +238,7 @@ DatumP Kernel::excDotSetfirst(DatumP node) {
   return nothing;
 }
 
-DatumP Kernel::excDotSetbf(DatumP node) {
+DatumP Kernel::excDotSetbf(const DatumP &node) {
   ProcedureHelper h(this, node);
   DatumP thing = h.datumAtIndex(1);
   DatumP array = h.validatedDatumAtIndex(0, [&thing](DatumP candidate) {
@@ -259,7 +252,7 @@ DatumP Kernel::excDotSetbf(DatumP node) {
   return nothing;
 }
 
-DatumP Kernel::excDotSetitem(DatumP node) {
+DatumP Kernel::excDotSetitem(const DatumP &node) {
   ProcedureHelper h(this, node);
   DatumP array = h.validatedDatumAtIndex(1, [](DatumP candidate) {
     return candidate.isList() || candidate.isArray();
@@ -274,38 +267,38 @@ DatumP Kernel::excDotSetitem(DatumP node) {
 
 // PREDICATES
 
-DatumP Kernel::excWordp(DatumP node) {
+DatumP Kernel::excWordp(const DatumP &node) {
   ProcedureHelper h(this, node);
   DatumP src = h.datumAtIndex(0);
   return h.ret(src.isWord());
 }
 
-DatumP Kernel::excListp(DatumP node) {
+DatumP Kernel::excListp(const DatumP &node) {
   ProcedureHelper h(this, node);
   DatumP src = h.datumAtIndex(0);
   return h.ret(src.isList());
 }
 
-DatumP Kernel::excArrayp(DatumP node) {
+DatumP Kernel::excArrayp(const DatumP &node) {
   ProcedureHelper h(this, node);
   DatumP src = h.datumAtIndex(0);
   return h.ret(src.isArray());
 }
 
-DatumP Kernel::excEmptyp(DatumP node) {
+DatumP Kernel::excEmptyp(const DatumP &node) {
   ProcedureHelper h(this, node);
   DatumP src = h.datumAtIndex(0);
   return h.ret(src.datumValue()->size() == 0);
 }
 
-DatumP Kernel::excEqualp(DatumP node) {
+DatumP Kernel::excEqualp(const DatumP &node) {
   ProcedureHelper h(this, node);
   DatumP a = h.datumAtIndex(0);
   DatumP b = h.datumAtIndex(1);
   return h.ret(a.isEqual(b, varCASEIGNOREDP()));
 }
 
-DatumP Kernel::excNotequal(DatumP node) {
+DatumP Kernel::excNotequal(const DatumP &node) {
   ProcedureHelper h(this, node);
   DatumP a = h.datumAtIndex(0);
   DatumP b = h.datumAtIndex(1);
@@ -313,21 +306,21 @@ DatumP Kernel::excNotequal(DatumP node) {
 }
 
 // TODO case-sensitivity
-DatumP Kernel::excBeforep(DatumP node) {
+DatumP Kernel::excBeforep(const DatumP &node) {
   ProcedureHelper h(this, node);
   const QString &a = h.wordAtIndex(0).wordValue()->printValue();
   const QString &b = h.wordAtIndex(1).wordValue()->printValue();
   return h.ret(a < b);
 }
 
-DatumP Kernel::excDotEq(DatumP node) {
+DatumP Kernel::excDotEq(const DatumP &node) {
   ProcedureHelper h(this, node);
   DatumP a = h.datumAtIndex(0);
   DatumP b = h.datumAtIndex(1);
   return h.ret(a.isDotEqual(b));
 }
 
-DatumP Kernel::excMemberp(DatumP node) {
+DatumP Kernel::excMemberp(const DatumP &node) {
   ProcedureHelper h(this, node);
   DatumP container = h.validatedDatumAtIndex(1, [](DatumP candidate) {
     return candidate.isList() || candidate.isWord();
@@ -342,7 +335,7 @@ DatumP Kernel::excMemberp(DatumP node) {
   return h.ret(container.datumValue()->isMember(thing, varCASEIGNOREDP()));
 }
 
-DatumP Kernel::excSubstringp(DatumP node) {
+DatumP Kernel::excSubstringp(const DatumP &node) {
   ProcedureHelper h(this, node);
   DatumP thing = h.datumAtIndex(0);
   DatumP container = h.datumAtIndex(1);
@@ -351,7 +344,7 @@ DatumP Kernel::excSubstringp(DatumP node) {
   return h.ret(container.datumValue()->isMember(thing, varCASEIGNOREDP()));
 }
 
-DatumP Kernel::excNumberp(DatumP node) {
+DatumP Kernel::excNumberp(const DatumP &node) {
   ProcedureHelper h(this, node);
   DatumP thing = h.datumAtIndex(0);
   if (!thing.isWord())
@@ -360,7 +353,7 @@ DatumP Kernel::excNumberp(DatumP node) {
   return h.ret(thing.wordValue()->didNumberConversionSucceed());
 }
 
-DatumP Kernel::excVbarredp(DatumP node) {
+DatumP Kernel::excVbarredp(const DatumP &node) {
   ProcedureHelper h(this, node);
   DatumP thing = h.validatedDatumAtIndex(0, [](DatumP candidate) {
     if (!candidate.isWord())
@@ -373,14 +366,14 @@ DatumP Kernel::excVbarredp(DatumP node) {
 
 // QUERIES
 
-DatumP Kernel::excCount(DatumP node) {
+DatumP Kernel::excCount(const DatumP &node) {
   ProcedureHelper h(this, node);
   DatumP thing = h.datumAtIndex(0);
   double count = thing.datumValue()->size();
   return h.ret(new Word(count));
 }
 
-DatumP Kernel::excAscii(DatumP node) {
+DatumP Kernel::excAscii(const DatumP &node) {
   ProcedureHelper h(this, node);
   DatumP chr = h.validatedDatumAtIndex(0, [](DatumP candidate) {
     return candidate.isWord() && candidate.wordValue()->size() == 1;
@@ -390,7 +383,7 @@ DatumP Kernel::excAscii(DatumP node) {
   return h.ret(new Word(asc));
 }
 
-DatumP Kernel::excRawascii(DatumP node) {
+DatumP Kernel::excRawascii(const DatumP &node) {
   ProcedureHelper h(this, node);
   DatumP chr = h.validatedDatumAtIndex(0, [](DatumP candidate) {
     return candidate.isWord() && candidate.wordValue()->size() == 1;
@@ -400,7 +393,7 @@ DatumP Kernel::excRawascii(DatumP node) {
   return h.ret(new Word(asc));
 }
 
-DatumP Kernel::excChar(DatumP node) {
+DatumP Kernel::excChar(const DatumP &node) {
   ProcedureHelper h(this, node);
   long n = h.validatedIntegerAtIndex(0, [](long candidate) {
     return (candidate >= 0) && (candidate <= USHRT_MAX);
@@ -408,7 +401,7 @@ DatumP Kernel::excChar(DatumP node) {
   return h.ret(new Word(QChar((ushort)n)));
 }
 
-DatumP Kernel::excMember(DatumP node) {
+DatumP Kernel::excMember(const DatumP &node) {
   ProcedureHelper h(this, node);
   DatumP container = h.datumAtIndex(1);
   DatumP thing = h.validatedDatumAtIndex(0, [&container](DatumP candidate) {
@@ -417,28 +410,28 @@ DatumP Kernel::excMember(DatumP node) {
   return h.ret(container.datumValue()->fromMember(thing, varCASEIGNOREDP()));
 }
 
-DatumP Kernel::excLowercase(DatumP node) {
+DatumP Kernel::excLowercase(const DatumP &node) {
   ProcedureHelper h(this, node);
   const QString &phrase = h.wordAtIndex(0).wordValue()->printValue();
   QString retval = phrase.toLower();
   return h.ret(new Word(retval));
 }
 
-DatumP Kernel::excUppercase(DatumP node) {
+DatumP Kernel::excUppercase(const DatumP &node) {
   ProcedureHelper h(this, node);
   const QString &phrase = h.wordAtIndex(0).wordValue()->printValue();
   QString retval = phrase.toUpper();
   return h.ret(new Word(retval));
 }
 
-DatumP Kernel::excStandout(DatumP node) {
+DatumP Kernel::excStandout(const DatumP &node) {
   ProcedureHelper h(this, node);
   const QString &phrase = h.wordAtIndex(0).wordValue()->printValue();
   QString t = mainController()->addStandoutToString(phrase);
   return h.ret(new Word(t));
 }
 
-DatumP Kernel::excParse(DatumP node) {
+DatumP Kernel::excParse(const DatumP &node) {
   ProcedureHelper h(this, node);
   Parser p(this);
   DatumP word = h.validatedDatumAtIndex(
@@ -449,7 +442,7 @@ DatumP Kernel::excParse(DatumP node) {
   return h.ret(p.readlistWithPrompt("", false, &src));
 }
 
-DatumP Kernel::excRunparse(DatumP node) {
+DatumP Kernel::excRunparse(const DatumP &node) {
   ProcedureHelper h(this, node);
   Parser p(this);
   DatumP wordOrList = h.validatedDatumAtIndex(0, [](DatumP candidate) {
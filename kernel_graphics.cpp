@@ -45,7 +45,7 @@ DatumP listFromColor(QColor c) {
 
 // TURTLE MOTION
 
-DatumP Kernel::excForward(DatumP node) {
+DatumP Kernel::excForward(const DatumP &node) {
   ProcedureHelper h(this, node);
   double value = h.numberAtIndex(0);
 
@@ -54,7 +54,7 @@ DatumP Kernel::excForward(DatumP node) {
   return nothing;
 }
 
-DatumP Kernel::excBack(DatumP node) {
+DatumP Kernel::excBack(const DatumP &node) {
   ProcedureHelper h(this, node);
   double value = h.numberAtIndex(0);
 
@@ -63,7 +63,7 @@ DatumP Kernel::excBack(DatumP node) {
   return nothing;
 }
 
-DatumP Kernel::excLeft(DatumP node) {
+DatumP Kernel::excLeft(const DatumP &node) {
   ProcedureHelper h(this, node);
   double value = h.numberAtIndex(0);
 
@@ -72,7 +72,7 @@ DatumP Kernel::excLeft(DatumP node) {
   return nothing;
 }
 
-DatumP Kernel::excRight(DatumP node) {
+DatumP Kernel::excRight(const DatumP &node) {
   ProcedureHelper h(this, node);
   double value = h.numberAtIndex(0);
 
@@ -81,7 +81,7 @@ DatumP Kernel::excRight(DatumP node) {
   return nothing;
 }
 
-DatumP Kernel::excSetpos(DatumP node) {
+DatumP Kernel::excSetpos(const DatumP &node) {
   ProcedureHelper h(this, node);
 
   QVector<double> v;
@@ -104,7 +104,7 @@ DatumP Kernel::excSetpos(DatumP node) {
   return nothing;
 }
 
-DatumP Kernel::excSetXY(DatumP node) {
+DatumP Kernel::excSetXY(const DatumP &node) {
   ProcedureHelper h(this, node);
   double x = h.numberAtIndex(0);
   double y = h.numberAtIndex(1);
@@ -114,7 +114,7 @@ DatumP Kernel::excSetXY(DatumP node) {
   return nothing;
 }
 
-DatumP Kernel::excSetXYZ(DatumP node) {
+DatumP Kernel::excSetXYZ(const DatumP &node) {
   ProcedureHelper h(this, node);
   double x = h.numberAtIndex(0);
   double y = h.numberAtIndex(1);
@@ -125,7 +125,7 @@ DatumP Kernel::excSetXYZ(DatumP node) {
   return nothing;
 }
 
-DatumP Kernel::excSetX(DatumP node) {
+DatumP Kernel::excSetX(const DatumP &node) {
   ProcedureHelper h(this, node);
   double x = h.numberAtIndex(0);
 
@@ -134,7 +134,7 @@ DatumP Kernel::excSetX(DatumP node) {
   return nothing;
 }
 
-DatumP Kernel::excSetY(DatumP node) {
+DatumP Kernel::excSetY(const DatumP &node) {
   ProcedureHelper h(this, node);
   double y = h.numberAtIndex(0);
 
@@ -143,7 +143,7 @@ DatumP Kernel::excSetY(DatumP node) {
   return nothing;
 }
 
-DatumP Kernel::excSetZ(DatumP node) {
+DatumP Kernel::excSetZ(const DatumP &node) {
   ProcedureHelper h(this, node);
   double z = h.numberAtIndex(0);
 
@@ -152,7 +152,7 @@ DatumP Kernel::excSetZ(DatumP node) {
   return nothing;
 }
 
-DatumP Kernel::excSetheading(DatumP node) {
+DatumP Kernel::excSetheading(const DatumP &node) {
   ProcedureHelper h(this, node);
   double newHeading = h.numberAtIndex(0);
   char axis = 'Z';
@@ -173,14 +173,14 @@ DatumP Kernel::excSetheading(DatumP node) {
   return nothing;
 }
 
-DatumP Kernel::excHome(DatumP node) {
+DatumP Kernel::excHome(const DatumP &node) {
   ProcedureHelper h(this, node);
   mainTurtle()->home();
 
   return h.ret();
 }
 
-DatumP Kernel::excArc(DatumP node) {
+DatumP Kernel::excArc(const DatumP &node) {
   ProcedureHelper h(this, node);
   double angle = h.numberAtIndex(0);
   double radius = h.numberAtIndex(1);
@@ -196,7 +196,7 @@ DatumP Kernel::excArc(DatumP node) {
 
 // TURTLE MOTION QUERIES
 
-DatumP Kernel::excPos(DatumP node) {
+DatumP Kernel::excPos(const DatumP &node) {
   ProcedureHelper h(this, node);
   double x, y, z;
   mainTurtle()->getxyz(x, y, z);
@@ -210,7 +210,7 @@ DatumP Kernel::excPos(DatumP node) {
   return h.ret(retval);
 }
 
-DatumP Kernel::excHeading(DatumP node) {
+DatumP Kernel::excHeading(const DatumP &node) {
   ProcedureHelper h(this, node);
   char axis = 'Z';
   if (node.astnodeValue()->countOfChildren() == 2) {
@@ -228,7 +228,7 @@ DatumP Kernel::excHeading(DatumP node) {
   return h.ret(new Word(retval));
 }
 
-DatumP Kernel::excTowards(DatumP node) {
+DatumP Kernel::excTowards(const DatumP &node) {
   ProcedureHelper h(this, node);
   QVector<double> v;
   double x, y, z;
@@ -248,7 +248,7 @@ DatumP Kernel::excTowards(DatumP node) {
   return h.ret(new Word(retval));
 }
 
-DatumP Kernel::excScrunch(DatumP node) {
+DatumP Kernel::excScrunch(const DatumP &node) {
   ProcedureHelper h(this, node);
   double x = 0;
   double y = 0;
@@ -261,7 +261,7 @@ DatumP Kernel::excScrunch(DatumP node) {
 
 // TURTLE AND WINDOW CONTROL
 
-DatumP Kernel::excShowturtle(DatumP node) {
+DatumP Kernel::excShowturtle(const DatumP &node) {
   ProcedureHelper h(this, node);
   mainTurtle()->setIsTurtleVisible(true);
   mainController()->updateCanvas();
@@ -269,7 +269,7 @@ DatumP Kernel::excShowturtle(DatumP node) {
   return h.ret();
 }
 
-DatumP Kernel::excHideturtle(DatumP node) {
+DatumP Kernel::excHideturtle(const DatumP &node) {
   ProcedureHelper h(this, node);
   mainTurtle()->setIsTurtleVisible(false);
   mainController()->updateCanvas();
@@ -277,21 +277,21 @@ DatumP Kernel::excHideturtle(DatumP node) {
   return h.ret();
 }
 
-DatumP Kernel::excClean(DatumP node) {
+DatumP Kernel::excClean(const DatumP &node) {
   ProcedureHelper h(this, node);
   mainTurtle()->home(false);
   mainController()->clearScreen();
   return h.ret();
 }
 
-DatumP Kernel::excClearscreen(DatumP node) {
+DatumP Kernel::excClearscreen(const DatumP &node) {
   ProcedureHelper h(this, node);
   mainController()->clearScreen();
 
   return h.ret();
 }
 
-DatumP Kernel::excWrap(DatumP node) {
+DatumP Kernel::excWrap(const DatumP &node) {
   ProcedureHelper h(this, node);
   TurtleModeEnum newMode = turtleWrap;
   if (mainTurtle()->getMode() != newMode) {
@@ -301,7 +301,7 @@ DatumP Kernel::excWrap(DatumP node) {
   return h.ret();
 }
 
-DatumP Kernel::excWindow(DatumP node) {
+DatumP Kernel::excWindow(const DatumP &node) {
   ProcedureHelper h(this, node);
   TurtleModeEnum newMode = turtleWindow;
   if (mainTurtle()->getMode() != newMode) {
@@ -311,7 +311,7 @@ DatumP Kernel::excWindow(DatumP node) {
   return h.ret();
 }
 
-DatumP Kernel::excFence(DatumP node) {
+DatumP Kernel::excFence(const DatumP &node) {
   ProcedureHelper h(this, node);
   TurtleModeEnum newMode = turtleFence;
   if (mainTurtle()->getMode() != newMode) {
@@ -321,7 +321,7 @@ DatumP Kernel::excFence(DatumP node) {
   return h.ret();
 }
 
-DatumP Kernel::excBounds(DatumP node) {
+DatumP Kernel::excBounds(const DatumP &node) {
   ProcedureHelper h(this, node);
   double x, y;
   mainController()->getBounds(x, y);
@@ -331,7 +331,7 @@ DatumP Kernel::excBounds(DatumP node) {
   return h.ret(retval);
 }
 
-DatumP Kernel::excSetbounds(DatumP node) {
+DatumP Kernel::excSetbounds(const DatumP &node) {
   ProcedureHelper h(this, node);
   auto v = [](double candidate) { return candidate > 0; };
 
@@ -343,7 +343,7 @@ DatumP Kernel::excSetbounds(DatumP node) {
   return nothing;
 }
 
-DatumP Kernel::excFilled(DatumP node) {
+DatumP Kernel::excFilled(const DatumP &node) {
   ProcedureHelper h(this, node);
   QColor c;
   h.validatedDatumAtIndex(0, [&c, this](DatumP candidate) {
@@ -364,7 +364,7 @@ DatumP Kernel::excFilled(DatumP node) {
   return retval;
 }
 
-DatumP Kernel::excLabel(DatumP node) {
+DatumP Kernel::excLabel(const DatumP &node) {
   ProcedureHelper h(this, node);
   QString text = h.wordAtIndex(0).wordValue()->printValue();
   double x = 0, y = 0, z = 0;
@@ -375,7 +375,7 @@ DatumP Kernel::excLabel(DatumP node) {
   return nothing;
 }
 
-DatumP Kernel::excSetlabelheight(DatumP node) {
+DatumP Kernel::excSetlabelheight(const DatumP &node) {
   ProcedureHelper h(this, node);
   double height = h.validatedNumberAtIndex(
       0, [](double candidate) { return candidate > 0; });
@@ -383,25 +383,25 @@ DatumP Kernel::excSetlabelheight(DatumP node) {
   return nothing;
 }
 
-DatumP Kernel::excTextscreen(DatumP node) {
+DatumP Kernel::excTextscreen(const DatumP &node) {
   ProcedureHelper h(this, node);
   mainController()->setScreenMode(textScreenMode);
   return h.ret();
 }
 
-DatumP Kernel::excFullscreen(DatumP node) {
+DatumP Kernel::excFullscreen(const DatumP &node) {
   ProcedureHelper h(this, node);
   mainController()->setScreenMode(fullScreenMode);
   return h.ret();
 }
 
-DatumP Kernel::excSplitscreen(DatumP node) {
+DatumP Kernel::excSplitscreen(const DatumP &node) {
   ProcedureHelper h(this, node);
   mainController()->setScreenMode(splitScreenMode);
   return h.ret();
 }
 
-DatumP Kernel::excSetscrunch(DatumP node) {
+DatumP Kernel::excSetscrunch(const DatumP &node) {
   ProcedureHelper h(this, node);
   auto v = [](double candidate) { return candidate != 0; };
 
@@ -413,13 +413,13 @@ DatumP Kernel::excSetscrunch(DatumP node) {
 
 // TURTLE AND WINDOW QUERIES
 
-DatumP Kernel::excShownp(DatumP node) {
+DatumP Kernel::excShownp(const DatumP &node) {
   ProcedureHelper h(this, node);
   bool retval = mainTurtle()->isTurtleVisible();
   return h.ret(retval);
 }
 
-DatumP Kernel::excScreenmode(DatumP node) {
+DatumP Kernel::excScreenmode(const DatumP &node) {
   ProcedureHelper h(this, node);
   QString retval;
   switch (mainController()->getScreenMode()) {
@@ -439,7 +439,7 @@ DatumP Kernel::excScreenmode(DatumP node) {
   return h.ret(new Word(retval));
 }
 
-DatumP Kernel::excTurtlemode(DatumP node) {
+DatumP Kernel::excTurtlemode(const DatumP &node) {
   ProcedureHelper h(this, node);
   QString retval;
   switch (mainTurtle()->getMode()) {
@@ -460,13 +460,13 @@ DatumP Kernel::excTurtlemode(DatumP node) {
   return h.ret(new Word(retval));
 }
 
-DatumP Kernel::excLabelheight(DatumP node) {
+DatumP Kernel::excLabelheight(const DatumP &node) {
   ProcedureHelper h(this, node);
   double retval = labelFont.pointSizeF();
   return h.ret(new Word(retval));
 }
 
-DatumP Kernel::excMatrix(DatumP node) {
+DatumP Kernel::excMatrix(const DatumP &node) {
   ProcedureHelper h(this, node);
   List *retval = new List;
   const QMatrix4x4 &m = mainTurtle()->getMatrix();
@@ -482,42 +482,42 @@ DatumP Kernel::excMatrix(DatumP node) {
 
 // PEN AND BACKGROUND CONTROL
 
-DatumP Kernel::excPendown(DatumP node) {
+DatumP Kernel::excPendown(const DatumP &node) {
   ProcedureHelper h(this, node);
   mainTurtle()->setPenIsDown(true);
 
   return h.ret();
 }
 
-DatumP Kernel::excPenup(DatumP node) {
+DatumP Kernel::excPenup(const DatumP &node) {
   ProcedureHelper h(this, node);
   mainTurtle()->setPenIsDown(false);
 
   return h.ret();
 }
 
-DatumP Kernel::excPenpaint(DatumP node) {
+DatumP Kernel::excPenpaint(const DatumP &node) {
   ProcedureHelper h(this, node);
   mainTurtle()->setPenIsDown(true);
   mainTurtle()->setPenMode(penModePaint);
   return h.ret();
 }
 
-DatumP Kernel::excPenerase(DatumP node) {
+DatumP Kernel::excPenerase(const DatumP &node) {
   ProcedureHelper h(this, node);
   mainTurtle()->setPenIsDown(true);
   mainTurtle()->setPenMode(penModeErase);
   return h.ret();
 }
 
-DatumP Kernel::excPenreverse(DatumP node) {
+DatumP Kernel::excPenreverse(const DatumP &node) {
   ProcedureHelper h(this, node);
   mainTurtle()->setPenIsDown(true);
   mainTurtle()->setPenMode(penModeReverse);
   return h.ret();
 }
 
-DatumP Kernel::excSetpencolor(DatumP node) {
+DatumP Kernel::excSetpencolor(const DatumP &node) {
   ProcedureHelper h(this, node);
   QColor c;
   h.validatedDatumAtIndex(0, [&c, this](DatumP candidate) {
@@ -527,7 +527,7 @@ DatumP Kernel::excSetpencolor(DatumP node) {
   return nothing;
 }
 
-DatumP Kernel::excSetpalette(DatumP node) {
+DatumP Kernel::excSetpalette(const DatumP &node) {
   ProcedureHelper h(this, node);
   int colornumber = h.validatedIntegerAtIndex(0, [this](long candidate) {
     return (candidate >= 8) && (candidate < palette.size());
@@ -540,7 +540,7 @@ DatumP Kernel::excSetpalette(DatumP node) {
   return nothing;
 }
 
-DatumP Kernel::excSetpensize(DatumP node) {
+DatumP Kernel::excSetpensize(const DatumP &node) {
   ProcedureHelper h(this, node);
   double newSize = h.validatedNumberAtIndex(0, [](double candidate) {
     return mainTurtle()->isPenSizeValid(candidate);
@@ -549,7 +549,7 @@ DatumP Kernel::excSetpensize(DatumP node) {
   return nothing;
 }
 
-DatumP Kernel::excSetbackground(DatumP node) {
+DatumP Kernel::excSetbackground(const DatumP &node) {
   ProcedureHelper h(this, node);
   QColor c;
   h.validatedDatumAtIndex(0, [&c, this](DatumP candidate) {
@@ -561,12 +561,12 @@ DatumP Kernel::excSetbackground(DatumP node) {
 
 // PEN QUERIES
 
-DatumP Kernel::excPendownp(DatumP node) {
+DatumP Kernel::excPendownp(const DatumP &node) {
   ProcedureHelper h(this, node);
   return h.ret(mainTurtle()->isPenDown());
 }
 
-DatumP Kernel::excPenmode(DatumP node) {
+DatumP Kernel::excPenmode(const DatumP &node) {
   ProcedureHelper h(this, node);
   PenModeEnum pm = mainTurtle()->getPenMode();
   QString retval;
@@ -587,13 +587,13 @@ DatumP Kernel::excPenmode(DatumP node) {
   return h.ret(new Word(retval));
 }
 
-DatumP Kernel::excPencolor(DatumP node) {
+DatumP Kernel::excPencolor(const DatumP &node) {
   ProcedureHelper h(this, node);
   const QColor &c = mainTurtle()->getPenColor();
   return h.ret(listFromColor(c));
 }
 
-DatumP Kernel::excPalette(DatumP node) {
+DatumP Kernel::excPalette(const DatumP &node) {
   ProcedureHelper h(this, node);
   int colornumber = h.validatedIntegerAtIndex(0, [this](long candidate) {
     return (candidate >= 0) && (candidate < palette.size());
@@ -601,13 +601,13 @@ DatumP Kernel::excPalette(DatumP node) {
   return h.ret(listFromColor(palette[colornumber]));
 }
 
-DatumP Kernel::excPensize(DatumP node) {
+DatumP Kernel::excPensize(const DatumP &node) {
   ProcedureHelper h(this, node);
   double retval = mainTurtle()->getPenSize();
   return h.ret(new Word(retval));
 }
 
-DatumP Kernel::excBackground(DatumP node) {
+DatumP Kernel::excBackground(const DatumP &node) {
   ProcedureHelper h(this, node);
   QColor c = mainController()->getCanvasBackgroundColor();
 
@@ -616,7 +616,7 @@ DatumP Kernel::excBackground(DatumP node) {
 
 // SAVING AND LOADING PICTURES
 
-DatumP Kernel::excSavepict(DatumP node) {
+DatumP Kernel::excSavepict(const DatumP &node) {
   ProcedureHelper h(this, node);
   DatumP filenameP = h.wordAtIndex(0);
 
@@ -631,7 +631,7 @@ DatumP Kernel::excSavepict(DatumP node) {
 
 // MORE QUERIES
 
-DatumP Kernel::excMousepos(DatumP node) {
+DatumP Kernel::excMousepos(const DatumP &node) {
   ProcedureHelper h(this, node);
   List *retval = new List;
   DatumP retvalP = h.ret(retval);
@@ -640,7 +640,7 @@ DatumP Kernel::excMousepos(DatumP node) {
   return retvalP;
 }
 
-DatumP Kernel::excClickpos(DatumP node) {
+DatumP Kernel::excClickpos(const DatumP &node) {
   ProcedureHelper h(this, node);
   List *retval = new List;
   DatumP retvalP = h.ret(retval);
@@ -649,12 +649,12 @@ DatumP Kernel::excClickpos(DatumP node) {
   return retvalP;
 }
 
-DatumP Kernel::excButtonp(DatumP node) {
+DatumP Kernel::excButtonp(const DatumP &node) {
   ProcedureHelper h(this, node);
   return h.ret(mainController()->getIsMouseButtonDown());
 }
 
-DatumP Kernel::excButton(DatumP node) {
+DatumP Kernel::excButton(const DatumP &node) {
   ProcedureHelper h(this, node);
   return h.ret(new Word(mainController()->getButton()));
 }
@@ -27,10 +27,13 @@
 #include "error.h"
 #include "kernel.h"
 #include "parser.h"
+#include "workspaceimage.h"
+
+#include <QFileInfo>
 
 #include CONTROLLER_HEADER
 
-QString Kernel::executeText(const QString &text) {
+QString Kernel::executeText(const QString &text, WorkspaceImage *recorder) {
   QString inText = text;
   QString outText;
 
@@ -39,10 +42,56 @@ QString Kernel::executeText(const QString &text) {
 
   StreamRedirect sr(this, &inStream, &outStream);
 
-  bool shouldContinue = true;
-  while (shouldContinue) {
-    shouldContinue = getLineAndRunIt(false);
+  WorkspaceImage *oldRecorder = imageRecorder;
+  imageRecorder = recorder;
+  try {
+    bool shouldContinue = true;
+    while (shouldContinue) {
+      shouldContinue = getLineAndRunIt(false);
+    }
+  } catch (Error *e) {
+    imageRecorder = oldRecorder;
+    throw e;
+  }
+  imageRecorder = oldRecorder;
+  outStream.flush();
+  return outText;
+}
+
+// Run a text that was recorded in image. This does what executeText would have
+// done with the text, without reading it again. If shouldCompile is false, the
+// procedures it defines are parsed when they are first run.
+QString Kernel::executeImage(const WorkspaceImage &image, bool shouldCompile) {
+  QString inText;
+  QString outText;
+
+  QTextStream inStream(&inText, QIODevice::ReadOnly);
+  QTextStream outStream(&outText, QIODevice::WriteOnly);
+
+  StreamRedirect sr(this, &inStream, &outStream);
+
+  WorkspaceImage *oldRecorder = imageRecorder;
+  imageRecorder = NULL;
+  try {
+    for (auto &entry : image.entries) {
+      ProcedureScope ps(this, nothing);
+      if (entry.cmd != nothing) {
+        parser->defineProcedure(entry.cmd, entry.procname, entry.text,
+                                entry.sourceText, shouldCompile);
+        sysPrint(entry.procname.wordValue()->printValue());
+        sysPrint(" defined\n");
+      } else {
+        DatumP result = runList(entry.line);
+        if (result != nothing)
+          Error::dontSay(result);
+      }
+      drainReleaseQueue();
+    }
+  } catch (Error *e) {
+    imageRecorder = oldRecorder;
+    throw e;
   }
+  imageRecorder = oldRecorder;
   outStream.flush();
   return outText;
 }
@@ -133,51 +182,52 @@ DatumP Kernel::contentslistFromDatumP(DatumP sourceNode) {
 }
 
 void Kernel::processContentsListWithMethod(
-    DatumP contentslist, void (Workspace::*method)(const QString &)) {
+    DatumP contentslist, void (Workspace::*method)(Symbol)) {
   List *proceduresList = contentslist.listValue()->datumAtIndex(1).listValue();
   List *variablesList = contentslist.listValue()->datumAtIndex(2).listValue();
   List *propertiesList = contentslist.listValue()->datumAtIndex(3).listValue();
 
   ListIterator i = proceduresList->newIterator();
   while (i.elementExists()) {
-    QString procname = i.element().wordValue()->keyValue();
+    Symbol procname = i.element().wordValue()->symbolValue();
     (parser->*method)(procname);
   }
 
   i = variablesList->newIterator();
   while (i.elementExists()) {
-    QString varname = i.element().wordValue()->keyValue();
+    Symbol varname = i.element().wordValue()->symbolValue();
     (variables.*method)(varname);
   }
 
   i = propertiesList->newIterator();
   while (i.elementExists()) {
     DatumP listnameP = i.element();
-    QString listname = listnameP.wordValue()->keyValue();
+    Symbol listname = listnameP.wordValue()->symbolValue();
     (plists.*method)(listname);
   }
 }
 
 DatumP Kernel::queryContentsListWithMethod(
-    DatumP contentslist, bool (Workspace::*method)(const QString &)) {
+    DatumP contentslist, bool (Workspace::*method)(Symbol)) {
   List *proceduresList = contentslist.listValue()->datumAtIndex(1).listValue();
 
   if (proceduresList->size() > 0) {
-    QString procname = proceduresList->first().wordValue()->keyValue();
+    Symbol procname =
+        proceduresList->first().wordValue()->existingSymbolValue();
     return DatumP((parser->*method)(procname));
   }
 
   List *variablesList = contentslist.listValue()->datumAtIndex(2).listValue();
 
   if (variablesList->size() > 0) {
-    QString varname = variablesList->first().wordValue()->keyValue();
+    Symbol varname = variablesList->first().wordValue()->existingSymbolValue();
     return DatumP((variables.*method)(varname));
   }
 
   List *propertiesList = contentslist.listValue()->datumAtIndex(3).listValue();
 
   if (propertiesList->size() > 0) {
-    QString pname = propertiesList->first().wordValue()->keyValue();
+    Symbol pname = propertiesList->first().wordValue()->existingSymbolValue();
     return DatumP((plists.*method)(pname));
   }
   return nothing;
@@ -221,7 +271,7 @@ QString Kernel::createPrintoutFromContentsList(DatumP contentslist,
   i = propertiesList->newIterator();
   while (i.elementExists()) {
     DatumP listnameP = i.element();
-    QString listname = listnameP.wordValue()->keyValue();
+    Symbol listname = listnameP.wordValue()->existingSymbolValue();
     DatumP proplist = plists.getPropertyList(listname);
     ListIterator j = proplist.listValue()->newIterator();
     while (j.elementExists()) {
@@ -304,7 +354,7 @@ bool Kernel::varCASEIGNOREDP() {
 
 // PROCEDURE DEFINITION
 
-DatumP Kernel::excTo(DatumP node) {
+DatumP Kernel::excTo(const DatumP &node) {
   // None of the children of node are ASTNode. They have to be literal so there
   // is no procedurehelper here.
   if (currentProcedure != nothing) {
@@ -317,7 +367,7 @@ DatumP Kernel::excTo(DatumP node) {
   return nothing;
 }
 
-DatumP Kernel::excDefine(DatumP node) {
+DatumP Kernel::excDefine(const DatumP &node) {
   ProcedureHelper h(this, node);
   DatumP text = h.validatedListAtIndex(1, [](DatumP candidate) {
     ListIterator iter = candidate.listValue()->newIterator();
@@ -336,19 +386,19 @@ DatumP Kernel::excDefine(DatumP node) {
   return nothing;
 }
 
-DatumP Kernel::excText(DatumP node) {
+DatumP Kernel::excText(const DatumP &node) {
   ProcedureHelper h(this, node);
   DatumP procnameP = h.wordAtIndex(0);
   return h.ret(parser->procedureText(procnameP));
 }
 
-DatumP Kernel::excFulltext(DatumP node) {
+DatumP Kernel::excFulltext(const DatumP &node) {
   ProcedureHelper h(this, node);
   DatumP procnameP = h.wordAtIndex(0);
   return h.ret(parser->procedureFulltext(procnameP));
 }
 
-DatumP Kernel::excCopydef(DatumP node) {
+DatumP Kernel::excCopydef(const DatumP &node) {
   ProcedureHelper h(this, node);
   DatumP newname = h.wordAtIndex(0);
   DatumP oldname = h.wordAtIndex(1);
@@ -360,15 +410,15 @@ DatumP Kernel::excCopydef(DatumP node) {
 
 // VARIABLE DEFINITION
 
-DatumP Kernel::excMake(DatumP node) {
+DatumP Kernel::excMake(const DatumP &node) {
   ProcedureHelper h(this, node);
 
-  QString lvalue = h.wordAtIndex(0).wordValue()->keyValue();
+  Symbol lvalue = h.wordAtIndex(0).wordValue()->symbolValue();
   DatumP rvalue = h.datumAtIndex(1);
 
   variables.setDatumForName(rvalue, lvalue);
 
-  if (variables.isTraced(lvalue.toUpper())) {
+  if (variables.isTraced(lvalue)) {
     QString line = QString("Make \"%1 %2\n")
                        .arg(h.wordAtIndex(0).wordValue()->printValue())
                        .arg(parser->unreadDatum(rvalue));
@@ -378,7 +428,7 @@ DatumP Kernel::excMake(DatumP node) {
   return nothing;
 }
 
-DatumP Kernel::excSetfoo(DatumP node) {
+DatumP Kernel::excSetfoo(const DatumP &node) {
   ProcedureHelper h(this, node);
 
   QString foo = node.astnodeValue()->nodeName.wordValue()->keyValue();
@@ -403,7 +453,7 @@ DatumP Kernel::excSetfoo(DatumP node) {
   return nothing;
 }
 
-DatumP Kernel::excFoo(DatumP node) {
+DatumP Kernel::excFoo(const DatumP &node) {
   DatumP fooP = node.astnodeValue()->nodeName;
   QString foo = fooP.wordValue()->keyValue();
 
@@ -413,7 +463,7 @@ DatumP Kernel::excFoo(DatumP node) {
   return retval;
 }
 
-DatumP Kernel::excLocal(DatumP node) {
+DatumP Kernel::excLocal(const DatumP &node) {
   ProcedureHelper h(this, node);
   for (int i = 0; i < h.countOfChildren(); ++i) {
     DatumP var = h.validatedDatumAtIndex(i, [](DatumP candidate) {
@@ -429,28 +479,28 @@ DatumP Kernel::excLocal(DatumP node) {
       return false;
     });
     if (var.isWord()) {
-      makeVarLocal(var.wordValue()->keyValue());
+      makeVarLocal(var.wordValue()->symbolValue());
     } else {
       ListIterator j = var.listValue()->newIterator();
       while (j.elementExists()) {
         DatumP v = j.element();
-        makeVarLocal(v.wordValue()->keyValue());
+        makeVarLocal(v.wordValue()->symbolValue());
       }
     }
   }
   return nothing;
 }
 
-DatumP Kernel::excThing(DatumP node) {
+DatumP Kernel::excThing(const DatumP &node) {
   ProcedureHelper h(this, node);
-  QString varName = h.wordAtIndex(0).wordValue()->keyValue();
+  Symbol varName = h.wordAtIndex(0).wordValue()->existingSymbolValue();
   DatumP retval = h.ret(variables.datumForName(varName));
   if (retval == nothing)
     return h.ret(Error::noValueRecoverable(h.datumAtIndex(0)));
   return retval;
 }
 
-DatumP Kernel::excGlobal(DatumP node) {
+DatumP Kernel::excGlobal(const DatumP &node) {
   ProcedureHelper h(this, node);
   for (int i = 0; i < h.countOfChildren(); ++i) {
     DatumP var = h.validatedDatumAtIndex(i, [](DatumP candidate) {
@@ -466,12 +516,12 @@ DatumP Kernel::excGlobal(DatumP node) {
       return false;
     });
     if (var.isWord()) {
-      variables.setVarAsGlobal(var.wordValue()->keyValue());
+      variables.setVarAsGlobal(var.wordValue()->symbolValue());
     } else {
       ListIterator j = var.listValue()->newIterator();
       while (j.elementExists()) {
         DatumP v = j.element();
-        variables.setVarAsGlobal(v.wordValue()->keyValue());
+        variables.setVarAsGlobal(v.wordValue()->symbolValue());
       }
     }
   }
@@ -480,10 +530,10 @@ DatumP Kernel::excGlobal(DatumP node) {
 
 // PROPERTY LISTS
 
-DatumP Kernel::excPprop(DatumP node) {
+DatumP Kernel::excPprop(const DatumP &node) {
   ProcedureHelper h(this, node);
-  QString plistname = h.wordAtIndex(0).wordValue()->keyValue();
-  QString propname = h.wordAtIndex(1).wordValue()->keyValue();
+  Symbol plistname = h.wordAtIndex(0).wordValue()->symbolValue();
+  Symbol propname = h.wordAtIndex(1).wordValue()->symbolValue();
   DatumP value = h.datumAtIndex(2);
   plists.addProperty(plistname, propname, value);
   if (plists.isTraced(plistname)) {
@@ -496,27 +546,27 @@ DatumP Kernel::excPprop(DatumP node) {
   return nothing;
 }
 
-DatumP Kernel::excGprop(DatumP node) {
+DatumP Kernel::excGprop(const DatumP &node) {
   ProcedureHelper h(this, node);
-  QString plistname = h.wordAtIndex(0).wordValue()->keyValue();
-  QString propname = h.wordAtIndex(1).wordValue()->keyValue();
+  Symbol plistname = h.wordAtIndex(0).wordValue()->existingSymbolValue();
+  Symbol propname = h.wordAtIndex(1).wordValue()->existingSymbolValue();
   DatumP retval = h.ret(plists.getProperty(plistname, propname));
 
   return retval;
 }
 
-DatumP Kernel::excRemprop(DatumP node) {
+DatumP Kernel::excRemprop(const DatumP &node) {
   ProcedureHelper h(this, node);
-  QString plistname = h.wordAtIndex(0).wordValue()->keyValue();
-  QString propname = h.wordAtIndex(1).wordValue()->keyValue();
+  Symbol plistname = h.wordAtIndex(0).wordValue()->existingSymbolValue();
+  Symbol propname = h.wordAtIndex(1).wordValue()->existingSymbolValue();
   plists.removeProperty(plistname, propname);
 
   return nothing;
 }
 
-DatumP Kernel::excPlist(DatumP node) {
+DatumP Kernel::excPlist(const DatumP &node) {
   ProcedureHelper h(this, node);
-  QString plistname = h.wordAtIndex(0).wordValue()->keyValue();
+  Symbol plistname = h.wordAtIndex(0).wordValue()->existingSymbolValue();
   DatumP retval = plists.getPropertyList(plistname);
 
   return retval;
@@ -524,71 +574,71 @@ DatumP Kernel::excPlist(DatumP node) {
 
 // PREDICATES
 
-DatumP Kernel::excProcedurep(DatumP node) {
+DatumP Kernel::excProcedurep(const DatumP &node) {
   ProcedureHelper h(this, node);
   bool retval = parser->isProcedure(h.wordAtIndex(0).wordValue()->keyValue());
   return h.ret(retval);
 }
 
-DatumP Kernel::excPrimitivep(DatumP node) {
+DatumP Kernel::excPrimitivep(const DatumP &node) {
   ProcedureHelper h(this, node);
   bool retval = parser->isPrimitive(h.wordAtIndex(0).wordValue()->keyValue());
   return h.ret(retval);
 }
 
-DatumP Kernel::excDefinedp(DatumP node) {
+DatumP Kernel::excDefinedp(const DatumP &node) {
   ProcedureHelper h(this, node);
   bool retval = parser->isDefined(h.wordAtIndex(0).wordValue()->keyValue());
   return h.ret(retval);
 }
 
-DatumP Kernel::excNamep(DatumP node) {
+DatumP Kernel::excNamep(const DatumP &node) {
   ProcedureHelper h(this, node);
-  QString varname = h.wordAtIndex(0).wordValue()->keyValue();
+  Symbol varname = h.wordAtIndex(0).wordValue()->existingSymbolValue();
   bool retval = (variables.doesExist(varname));
   return h.ret(retval);
 }
 
-DatumP Kernel::excPlistp(DatumP node) {
+DatumP Kernel::excPlistp(const DatumP &node) {
   ProcedureHelper h(this, node);
-  QString listName = h.wordAtIndex(0).wordValue()->keyValue();
+  Symbol listName = h.wordAtIndex(0).wordValue()->existingSymbolValue();
   bool retval = plists.isPropertyList(listName);
   return h.ret(retval);
 }
 
 // QUERIES
 
-DatumP Kernel::excContents(DatumP node) {
+DatumP Kernel::excContents(const DatumP &node) {
   ProcedureHelper h(this, node);
   return h.ret(buildContentsList(showUnburied));
 }
 
-DatumP Kernel::excBuried(DatumP node) {
+DatumP Kernel::excBuried(const DatumP &node) {
   ProcedureHelper h(this, node);
   return h.ret(buildContentsList(showBuried));
 }
 
-DatumP Kernel::excTraced(DatumP node) {
+DatumP Kernel::excTraced(const DatumP &node) {
   ProcedureHelper h(this, node);
   return h.ret(buildContentsList(showTraced));
 }
 
-DatumP Kernel::excStepped(DatumP node) {
+DatumP Kernel::excStepped(const DatumP &node) {
   ProcedureHelper h(this, node);
   return h.ret(buildContentsList(showStepped));
 }
 
-DatumP Kernel::excProcedures(DatumP node) {
+DatumP Kernel::excProcedures(const DatumP &node) {
   ProcedureHelper h(this, node);
   return h.ret(parser->allProcedureNames(showUnburied));
 }
 
-DatumP Kernel::excPrimitives(DatumP node) {
+DatumP Kernel::excPrimitives(const DatumP &node) {
   ProcedureHelper h(this, node);
   return h.ret(parser->allPrimitiveProcedureNames());
 }
 
-DatumP Kernel::excNames(DatumP node) {
+DatumP Kernel::excNames(const DatumP &node) {
   ProcedureHelper h(this, node);
   List *retval = new List;
   retval->append(DatumP(new List));
@@ -596,7 +646,7 @@ DatumP Kernel::excNames(DatumP node) {
   return h.ret(retval);
 }
 
-DatumP Kernel::excPlists(DatumP node) {
+DatumP Kernel::excPlists(const DatumP &node) {
   ProcedureHelper h(this, node);
   List *retval = new List;
   retval->append(DatumP(new List));
@@ -605,19 +655,47 @@ DatumP Kernel::excPlists(DatumP node) {
   return h.ret(retval);
 }
 
-DatumP Kernel::excArity(DatumP node) {
+DatumP Kernel::excArity(const DatumP &node) {
   ProcedureHelper h(this, node);
   return h.ret(parser->arity(h.wordAtIndex(0)));
 }
 
-DatumP Kernel::excNodes(DatumP node) {
+// The statistics shouldn't count Datums that are only waiting to be deleted.
+DatumP Kernel::excNodes(const DatumP &node) {
   ProcedureHelper h(this, node);
+  drainReleaseQueue();
   return h.ret(nodes());
 }
 
+DatumP Kernel::excNodestats(const DatumP &node) {
+  ProcedureHelper h(this, node);
+  drainReleaseQueue();
+  return h.ret(nodeStats());
+}
+
+DatumP Kernel::excNodesjson(const DatumP &node) {
+  ProcedureHelper h(this, node);
+  drainReleaseQueue();
+  return h.ret(new Word(nodeStatsJSON()));
+}
+
+DatumP Kernel::excGc(const DatumP &node) {
+  ProcedureHelper h(this, node);
+  drainReleaseQueue();
+  collectCycles();
+  return nothing;
+}
+
+DatumP Kernel::excRecycle(const DatumP &node) {
+  ProcedureHelper h(this, node);
+  drainReleaseQueue();
+  int count = collectCycles();
+  return h.ret(new Word(count));
+}
+
 // INSPECTION
 
-DatumP Kernel::excPrintout(DatumP node) {
+DatumP Kernel::excPrintout(const DatumP &node) {
   ProcedureHelper h(this, node);
   DatumP contentslist;
   h.validatedDatumAtIndex(0, [&contentslist, this](DatumP candidate) {
@@ -631,7 +709,7 @@ DatumP Kernel::excPrintout(DatumP node) {
   return nothing;
 }
 
-DatumP Kernel::excPot(DatumP node) {
+DatumP Kernel::excPot(const DatumP &node) {
   ProcedureHelper h(this, node);
   DatumP contentslist;
   h.validatedDatumAtIndex(0, [&contentslist, this](DatumP candidate) {
@@ -664,7 +742,7 @@ DatumP Kernel::excPot(DatumP node) {
   i = propertiesList->newIterator();
   while (i.elementExists()) {
     DatumP listnameP = i.element();
-    QString listname = listnameP.wordValue()->keyValue();
+    Symbol listname = listnameP.wordValue()->existingSymbolValue();
     DatumP proplist = plists.getPropertyList(listname);
     if (proplist.listValue()->size() > 0) {
       QString line = QString("Plist %1 = %2\n")
@@ -679,7 +757,7 @@ DatumP Kernel::excPot(DatumP node) {
 
 // WORKSPACE CONTROL
 
-DatumP Kernel::excErase(DatumP node) {
+DatumP Kernel::excErase(const DatumP &node) {
   ProcedureHelper h(this, node);
   DatumP contentslist;
   h.validatedDatumAtIndex(0, [&contentslist, this](DatumP candidate) {
@@ -706,14 +784,14 @@ DatumP Kernel::excErase(DatumP node) {
   i = propertiesList->newIterator();
   while (i.elementExists()) {
     DatumP listnameP = i.element();
-    QString listname = listnameP.wordValue()->keyValue();
+    Symbol listname = listnameP.wordValue()->existingSymbolValue();
     plists.erasePropertyList(listname);
   }
 
   return nothing;
 }
 
-DatumP Kernel::excErall(DatumP node) {
+DatumP Kernel::excErall(const DatumP &node) {
   ProcedureHelper h(this, node);
   parser->eraseAllProcedures();
   variables.eraseAll();
@@ -722,28 +800,28 @@ DatumP Kernel::excErall(DatumP node) {
   return nothing;
 }
 
-DatumP Kernel::excErps(DatumP node) {
+DatumP Kernel::excErps(const DatumP &node) {
   ProcedureHelper h(this, node);
   parser->eraseAllProcedures();
 
   return nothing;
 }
 
-DatumP Kernel::excErns(DatumP node) {
+DatumP Kernel::excErns(const DatumP &node) {
   ProcedureHelper h(this, node);
   variables.eraseAll();
 
   return nothing;
 }
 
-DatumP Kernel::excErpls(DatumP node) {
+DatumP Kernel::excErpls(const DatumP &node) {
   ProcedureHelper h(this, node);
   plists.eraseAll();
 
   return nothing;
 }
 
-DatumP Kernel::excBury(DatumP node) {
+DatumP Kernel::excBury(const DatumP &node) {
   ProcedureHelper h(this, node);
   DatumP contentslist;
   h.validatedDatumAtIndex(0, [&contentslist, this](DatumP candidate) {
@@ -756,7 +834,7 @@ DatumP Kernel::excBury(DatumP node) {
   return nothing;
 }
 
-DatumP Kernel::excUnbury(DatumP node) {
+DatumP Kernel::excUnbury(const DatumP &node) {
   ProcedureHelper h(this, node);
   DatumP contentslist;
   h.validatedDatumAtIndex(0, [&contentslist, this](DatumP candidate) {
@@ -769,7 +847,7 @@ DatumP Kernel::excUnbury(DatumP node) {
   return nothing;
 }
 
-DatumP Kernel::excBuriedp(DatumP node) {
+DatumP Kernel::excBuriedp(const DatumP &node) {
   ProcedureHelper h(this, node);
   DatumP retval;
   h.validatedDatumAtIndex(0, [&retval, this](DatumP candidate) {
@@ -784,7 +862,7 @@ DatumP Kernel::excBuriedp(DatumP node) {
   return h.ret(retval);
 }
 
-DatumP Kernel::excTrace(DatumP node) {
+DatumP Kernel::excTrace(const DatumP &node) {
   ProcedureHelper h(this, node);
   DatumP contentslist;
   h.validatedDatumAtIndex(0, [&contentslist, this](DatumP candidate) {
@@ -797,7 +875,7 @@ DatumP Kernel::excTrace(DatumP node) {
   return nothing;
 }
 
-DatumP Kernel::excUntrace(DatumP node) {
+DatumP Kernel::excUntrace(const DatumP &node) {
   ProcedureHelper h(this, node);
   DatumP contentslist;
   h.validatedDatumAtIndex(0, [&contentslist, this](DatumP candidate) {
@@ -810,7 +888,7 @@ DatumP Kernel::excUntrace(DatumP node) {
   return nothing;
 }
 
-DatumP Kernel::excTracedp(DatumP node) {
+DatumP Kernel::excTracedp(const DatumP &node) {
   ProcedureHelper h(this, node);
   DatumP retval;
   h.validatedDatumAtIndex(0, [&retval, this](DatumP candidate) {
@@ -825,7 +903,7 @@ DatumP Kernel::excTracedp(DatumP node) {
   return h.ret(retval);
 }
 
-DatumP Kernel::excStep(DatumP node) {
+DatumP Kernel::excStep(const DatumP &node) {
   ProcedureHelper h(this, node);
   DatumP contentslist;
   h.validatedDatumAtIndex(0, [&contentslist, this](DatumP candidate) {
@@ -838,7 +916,7 @@ DatumP Kernel::excStep(DatumP node) {
   return nothing;
 }
 
-DatumP Kernel::excUnstep(DatumP node) {
+DatumP Kernel::excUnstep(const DatumP &node) {
   ProcedureHelper h(this, node);
   DatumP contentslist;
   h.validatedDatumAtIndex(0, [&contentslist, this](DatumP candidate) {
@@ -851,7 +929,7 @@ DatumP Kernel::excUnstep(DatumP node) {
   return nothing;
 }
 
-DatumP Kernel::excSteppedp(DatumP node) {
+DatumP Kernel::excSteppedp(const DatumP &node) {
   ProcedureHelper h(this, node);
   DatumP retval;
   h.validatedDatumAtIndex(0, [&retval, this](DatumP candidate) {
@@ -866,7 +944,7 @@ DatumP Kernel::excSteppedp(DatumP node) {
   return h.ret(retval);
 }
 
-DatumP Kernel::excEdit(DatumP node) {
+DatumP Kernel::excEdit(const DatumP &node) {
   ProcedureHelper h(this, node);
   if (h.countOfChildren() > 0) {
     DatumP contentslist;
@@ -888,14 +966,14 @@ DatumP Kernel::excEdit(DatumP node) {
   return nothing;
 }
 
-DatumP Kernel::excEditfile(DatumP node) {
+DatumP Kernel::excEditfile(const DatumP &node) {
   ProcedureHelper h(this, node);
   editFileName = h.wordAtIndex(0);
   editAndRunFile();
   return nothing;
 }
 
-DatumP Kernel::excSave(DatumP node) {
+DatumP Kernel::excSave(const DatumP &node) {
   ProcedureHelper h(this, node);
   if (h.countOfChildren() > 0) {
     editFileName = h.wordAtIndex(0);
@@ -921,7 +999,7 @@ DatumP Kernel::excSave(DatumP node) {
   return nothing;
 }
 
-DatumP Kernel::excLoad(DatumP node) {
+DatumP Kernel::excLoad(const DatumP &node) {
   ProcedureHelper h(this, node);
   editFileName = h.wordAtIndex(0);
   DatumP oldStartup = varSTARTUP();
@@ -932,9 +1010,26 @@ DatumP Kernel::excLoad(DatumP node) {
   if (!file.open(QIODevice::ReadWrite | QIODevice::Text)) {
     Error::cantOpen(editFileName);
   }
-  QTextStream in(&file);
-  QString fileText = in.readAll();
-  QString output = executeText(fileText);
+  QByteArray fileContents = file.readAll();
+
+  // An unchanged file is run from its image instead of being read again. The
+  // image holds tokens, not ASTs: an AST is bound to the primitives and
+  // Procedures of the workspace it was parsed in, so the procedures are
+  // compiled again as they are defined, just as they are when the file is
+  // read.
+  QString absolutePath = QFileInfo(filepath).absoluteFilePath();
+  QString imagePath = WorkspaceImage::cachePathForFile(absolutePath);
+  QByteArray imageKey = WorkspaceImage::keyForText(absolutePath, fileContents);
+  WorkspaceImage image;
+  QString output;
+  if (image.readFromFile(imagePath, imageKey)) {
+    output = executeImage(image);
+  } else {
+    QTextStream in(&fileContents);
+    QString fileText = in.readAll();
+    output = executeText(fileText, &image);
+    image.writeToFile(imagePath, imageKey);
+  }
   if (varLOADNOISILY()) {
     sysPrint(output);
   }
@@ -947,7 +1042,7 @@ DatumP Kernel::excLoad(DatumP node) {
   return h.ret(retval);
 }
 
-DatumP Kernel::excHelp(DatumP node) {
+DatumP Kernel::excHelp(const DatumP &node) {
   ProcedureHelper h(this, node);
   if (h.countOfChildren() > 0) {
     QString cmdName = h.wordAtIndex(0).wordValue()->keyValue();
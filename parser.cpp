@@ -27,7 +27,6 @@
 #include "parser.h"
 #include "error.h"
 #include "kernel.h"
-#include <qdatetime.h>
 #include <qdebug.h>
 
 #include CONTROLLER_HEADER
@@ -44,12 +43,480 @@ char lastNonSpaceChar(const QString &line) {
   return retval;
 }
 
-QHash<QString, Cmd_t> stringToCmd;
+struct PrimitiveEntry {
+  const char *name;
+  Cmd_t cmd;
+};
 
-void Parser::defineProcedure(DatumP cmd, DatumP procnameP, DatumP text,
-                             DatumP sourceText) {
-  lastProcedureCreatedTimestamp = QDateTime::currentMSecsSinceEpoch();
+// The primitive procedures, sorted by name so that primitiveForName() can find
+// them with a binary search. Keep the names in ASCII order when adding to it.
+// An alternate name has the same entry as the primitive it names, which
+// follows it in a comment.
+//
+// The numbers are the (MIN, default, MAX) counts of inputs:
+// (MIN = -1)     = All parameters are read as list, e.g. "TO PROC :p1"
+//                  becomes ["TO", "PROC", ":p1"]
+// (default = -1) = All parameters are consumed until end of line
+// (MAX = -1)     = All parameters are consumed within parens
+static constexpr PrimitiveEntry primitiveTable[] = {
+    {"*", {&Kernel::excProduct, 0, 2, -1}}, // PRODUCT
+    {"+", {&Kernel::excSum, 0, 2, -1}}, // SUM
+    {"-", {&Kernel::excMinus, 1, 1, 1}},
+    {"--", {&Kernel::excMinus, 1, 1, 1}}, // -
+    {".DEFMACRO", {&Kernel::excDefine, 2, 2, 2}}, // DEFINE
+    {".EQ", {&Kernel::excDotEq, 2, 2, 2}},
+    {".MACRO", {&Kernel::excTo, -1, -1, -1}}, // TO
+    {".MAYBEOUTPUT", {&Kernel::excDotMaybeoutput, 1, 1, 1}},
+    {".SETBF", {&Kernel::excDotSetbf, 2, 2, 2}},
+    {".SETFIRST", {&Kernel::excDotSetfirst, 2, 2, 2}},
+    {".SETITEM", {&Kernel::excDotSetitem, 3, 3, 3}},
+    {".SETSEGMENTSIZE", {&Kernel::excNoop, 1, 1, 1}},
+    {"/", {&Kernel::excQuotient, 1, 2, 2}}, // QUOTIENT
+    {"<", {&Kernel::excLessp, 2, 2, 2}}, // LESSP
+    {"<=", {&Kernel::excLessequalp, 2, 2, 2}}, // LESSEQUALP
+    {"<>", {&Kernel::excNotequal, 2, 2, 2}}, // NOTEQUALP
+    {"=", {&Kernel::excEqualp, 2, 2, 2}}, // EQUALP
+    {">", {&Kernel::excGreaterp, 2, 2, 2}}, // GREATERP
+    {">=", {&Kernel::excGreaterequalp, 2, 2, 2}}, // GREATEREQUALP
+    {"?", {&Kernel::excNamedSlot, 0, 0, 1}},
+    {"ALLFONTS", {&Kernel::excAllfonts, 0, 0, 0}},
+    {"ALLOPEN", {&Kernel::excAllopen, 0, 0, 0}},
+    {"AND", {&Kernel::excAnd, 0, 2, -1}},
+    {"APPLY", {&Kernel::excApply, 2, 2, 2}},
+    {"ARC", {&Kernel::excArc, 2, 2, 2}},
+    {"ARCTAN", {&Kernel::excArctan, 1, 1, 2}},
+    {"ARITY", {&Kernel::excArity, 1, 1, 1}},
+    {"ARRAY", {&Kernel::excArray, 1, 1, 2}},
+    {"ARRAY?", {&Kernel::excArrayp, 1, 1, 1}}, // ARRAYP
+    {"ARRAYP", {&Kernel::excArrayp, 1, 1, 1}},
+    {"ARRAYTOLIST", {&Kernel::excArraytolist, 1, 1, 1}},
+    {"ASCII", {&Kernel::excAscii, 1, 1, 1}},
+    {"ASHIFT", {&Kernel::excAshift, 2, 2, 2}},
+    {"BACK", {&Kernel::excBack, 1, 1, 1}},
+    {"BACKGROUND", {&Kernel::excBackground, 0, 0, 0}},
+    {"BEFORE?", {&Kernel::excBeforep, 2, 2, 2}}, // BEFOREP
+    {"BEFOREP", {&Kernel::excBeforep, 2, 2, 2}},
+    {"BF", {&Kernel::excButfirst, 1, 1, 1}}, // BUTFIRST
+    {"BFS", {&Kernel::excButfirsts, 1, 1, 1}}, // BUTFIRSTS
+    {"BG", {&Kernel::excBackground, 0, 0, 0}}, // BACKGROUND
+    {"BITAND", {&Kernel::excBitand, 0, 2, -1}},
+    {"BITNOT", {&Kernel::excBitnot, 1, 1, 1}},
+    {"BITOR", {&Kernel::excBitor, 0, 2, -1}},
+    {"BITXOR", {&Kernel::excBitxor, 0, 2, -1}},
+    {"BK", {&Kernel::excBack, 1, 1, 1}}, // BACK
+    {"BL", {&Kernel::excButlast, 1, 1, 1}}, // BUTLAST
+    {"BOUNDS", {&Kernel::excBounds, 0, 0, 0}},
+    {"BURIED", {&Kernel::excBuried, 0, 0, 0}},
+    {"BURIED?", {&Kernel::excBuriedp, 1, 1, 1}}, // BURIEDP
+    {"BURIEDP", {&Kernel::excBuriedp, 1, 1, 1}},
+    {"BURY", {&Kernel::excBury, 1, 1, 1}},
+    {"BUTFIRST", {&Kernel::excButfirst, 1, 1, 1}},
+    {"BUTFIRSTS", {&Kernel::excButfirsts, 1, 1, 1}},
+    {"BUTLAST", {&Kernel::excButlast, 1, 1, 1}},
+    {"BUTTON", {&Kernel::excButton, 0, 0, 0}},
+    {"BUTTON?", {&Kernel::excButtonp, 0, 0, 0}}, // BUTTONP
+    {"BUTTONP", {&Kernel::excButtonp, 0, 0, 0}},
+    {"BYE", {&Kernel::excBye, 0, 0, 0}},
+    {"CATCH", {&Kernel::excCatch, 2, 2, 2}},
+    {"CHAR", {&Kernel::excChar, 1, 1, 1}},
+    {"CLEAN", {&Kernel::excClean, 0, 0, 0}},
+    {"CLEARSCREEN", {&Kernel::excClearscreen, 0, 0, 0}},
+    {"CLEARTEXT", {&Kernel::excCleartext, 0, 0, 0}},
+    {"CLICKPOS", {&Kernel::excClickpos, 0, 0, 0}},
+    {"CLOSE", {&Kernel::excClose, 1, 1, 1}},
+    {"CLOSEALL", {&Kernel::excCloseall, 0, 0, 0}},
+    {"CO", {&Kernel::excContinue, 0, -1, 1}}, // CONTINUE
+    {"CONTENTS", {&Kernel::excContents, 0, 0, 0}},
+    {"CONTINUE", {&Kernel::excContinue, 0, -1, 1}},
+    {"COPYDEF", {&Kernel::excCopydef, 2, 2, 2}},
+    {"COS", {&Kernel::excCos, 1, 1, 1}},
+    {"COUNT", {&Kernel::excCount, 1, 1, 1}},
+    {"CS", {&Kernel::excClearscreen, 0, 0, 0}}, // CLEARSCREEN
+    {"CT", {&Kernel::excCleartext, 0, 0, 0}}, // CLEARTEXT
+    {"CURSOR", {&Kernel::excCursor, 0, 0, 0}},
+    {"CURSORINSERT", {&Kernel::excCursorInsert, 0, 0, 0}},
+    {"CURSORMODE", {&Kernel::excCursorMode, 0, 0, 0}},
+    {"CURSOROVERWRITE", {&Kernel::excCursorOverwrite, 0, 0, 0}},
+    {"DECREASEFONT", {&Kernel::excDecreasefont, 0, 0, 0}},
+    {"DEFINE", {&Kernel::excDefine, 2, 2, 2}},
+    {"DEFINED?", {&Kernel::excDefinedp, 1, 1, 1}}, // DEFINEDP
+    {"DEFINEDP", {&Kernel::excDefinedp, 1, 1, 1}},
+    {"DIFFERENCE", {&Kernel::excDifference, 2, 2, 2}},
+    {"DRIBBLE", {&Kernel::excDribble, 1, 1, 1}},
+    {"ED", {&Kernel::excEdit, 0, -1, 1}}, // EDIT
+    {"EDIT", {&Kernel::excEdit, 0, -1, 1}},
+    {"EDITFILE", {&Kernel::excEditfile, 1, 1, 1}},
+    {"EMPTY?", {&Kernel::excEmptyp, 1, 1, 1}}, // EMPTYP
+    {"EMPTYP", {&Kernel::excEmptyp, 1, 1, 1}},
+    {"EOF?", {&Kernel::excEofp, 0, 0, 0}}, // EOFP
+    {"EOFP", {&Kernel::excEofp, 0, 0, 0}},
+    {"EQUAL?", {&Kernel::excEqualp, 2, 2, 2}}, // EQUALP
+    {"EQUALP", {&Kernel::excEqualp, 2, 2, 2}},
+    {"ER", {&Kernel::excErase, 1, 1, 1}}, // ERASE
+    {"ERALL", {&Kernel::excErall, 0, 0, 0}},
+    {"ERASE", {&Kernel::excErase, 1, 1, 1}},
+    {"ERASEFILE", {&Kernel::excErasefile, 1, 1, 1}},
+    {"ERF", {&Kernel::excErasefile, 1, 1, 1}}, // ERASEFILE
+    {"ERNS", {&Kernel::excErns, 0, 0, 0}},
+    {"ERPLS", {&Kernel::excErpls, 0, 0, 0}},
+    {"ERPS", {&Kernel::excErps, 0, 0, 0}},
+    {"ERROR", {&Kernel::excError, 0, 0, 0}},
+    {"EXP", {&Kernel::excExp, 1, 1, 1}},
+    {"FD", {&Kernel::excForward, 1, 1, 1}}, // FORWARD
+    {"FENCE", {&Kernel::excFence, 0, 0, 0}},
+    {"FILLED", {&Kernel::excFilled, 2, 2, 2}},
+    {"FIRST", {&Kernel::excFirst, 1, 1, 1}},
+    {"FIRSTS", {&Kernel::excFirsts, 1, 1, 1}},
+    {"FONT", {&Kernel::excFont, 0, 0, 0}},
+    {"FOREVER", {&Kernel::excForever, 1, 1, 1}},
+    {"FORM", {&Kernel::excForm, 3, 3, 3}},
+    {"FORWARD", {&Kernel::excForward, 1, 1, 1}},
+    {"FPUT", {&Kernel::excFput, 2, 2, 2}},
+    {"FS", {&Kernel::excFullscreen, 0, 0, 0}}, // FULLSCREEN
+    {"FULLSCREEN", {&Kernel::excFullscreen, 0, 0, 0}},
+    {"FULLTEXT", {&Kernel::excFulltext, 1, 1, 1}},
+    {"GC", {&Kernel::excGc, 0, 0, -1}},
+    {"GLOBAL", {&Kernel::excGlobal, 1, 1, -1}},
+    {"GOTO", {&Kernel::excGoto, 1, 1, 1}},
+    {"GPROP", {&Kernel::excGprop, 2, 2, 2}},
+    {"GREATER?", {&Kernel::excGreaterp, 2, 2, 2}}, // GREATERP
+    {"GREATEREQUAL?", {&Kernel::excGreaterequalp, 2, 2, 2}}, // GREATEREQUALP
+    {"GREATEREQUALP", {&Kernel::excGreaterequalp, 2, 2, 2}},
+    {"GREATERP", {&Kernel::excGreaterp, 2, 2, 2}},
+    {"HEADING", {&Kernel::excHeading, 0, 0, 1}},
+    {"HELP", {&Kernel::excHelp, 0, -1, 1}},
+    {"HIDETURTLE", {&Kernel::excHideturtle, 0, 0, 0}},
+    {"HOME", {&Kernel::excHome, 0, 0, 0}},
+    {"HT", {&Kernel::excHideturtle, 0, 0, 0}}, // HIDETURTLE
+    {"IF", {&Kernel::excIf, 2, 2, 2}},
+    {"IFELSE", {&Kernel::excIfelse, 3, 3, 3}},
+    {"IFF", {&Kernel::excIffalse, 1, 1, 1}}, // IFFALSE
+    {"IFFALSE", {&Kernel::excIffalse, 1, 1, 1}},
+    {"IFT", {&Kernel::excIftrue, 1, 1, 1}}, // IFTRUE
+    {"IFTRUE", {&Kernel::excIftrue, 1, 1, 1}},
+    {"INCREASEFONT", {&Kernel::excIncreasefont, 0, 0, 0}},
+    {"INT", {&Kernel::excInt, 1, 1, 1}},
+    {"ITEM", {&Kernel::excItem, 2, 2, 2}},
+    {"KEY?", {&Kernel::excKeyp, 0, 0, 0}}, // KEYP
+    {"KEYP", {&Kernel::excKeyp, 0, 0, 0}},
+    {"LABEL", {&Kernel::excLabel, 1, 1, 1}},
+    {"LABELHEIGHT", {&Kernel::excLabelheight, 0, 0, 0}},
+    {"LAST", {&Kernel::excLast, 1, 1, 1}},
+    {"LEFT", {&Kernel::excLeft, 1, 1, 1}},
+    {"LESS?", {&Kernel::excLessp, 2, 2, 2}}, // LESSP
+    {"LESSEQUAL?", {&Kernel::excLessequalp, 2, 2, 2}}, // LESSEQUALP
+    {"LESSEQUALP", {&Kernel::excLessequalp, 2, 2, 2}},
+    {"LESSP", {&Kernel::excLessp, 2, 2, 2}},
+    {"LIST", {&Kernel::excList, 0, 2, -1}},
+    {"LIST?", {&Kernel::excListp, 1, 1, 1}}, // LISTP
+    {"LISTP", {&Kernel::excListp, 1, 1, 1}},
+    {"LISTTOARRAY", {&Kernel::excListtoarray, 1, 1, 2}},
+    {"LN", {&Kernel::excLn, 1, 1, 1}},
+    {"LOAD", {&Kernel::excLoad, 1, 1, 1}},
+    {"LOCAL", {&Kernel::excLocal, 1, 1, -1}},
+    {"LOG10", {&Kernel::excLog10, 1, 1, 1}},
+    {"LOWERCASE", {&Kernel::excLowercase, 1, 1, 1}},
+    {"LPUT", {&Kernel::excLput, 2, 2, 2}},
+    {"LSHIFT", {&Kernel::excLshift, 2, 2, 2}},
+    {"LT", {&Kernel::excLeft, 1, 1, 1}}, // LEFT
+    {"MACRO?", {&Kernel::excMacrop, 1, 1, 1}}, // MACROP
+    {"MACROP", {&Kernel::excMacrop, 1, 1, 1}},
+    {"MAKE", {&Kernel::excMake, 2, 2, 2}},
+    {"MATRIX", {&Kernel::excMatrix, 0, 0, 0}},
+    {"MEMBER", {&Kernel::excMember, 2, 2, 2}},
+    {"MEMBER?", {&Kernel::excMemberp, 2, 2, 2}}, // MEMBERP
+    {"MEMBERP", {&Kernel::excMemberp, 2, 2, 2}},
+    {"MINUS", {&Kernel::excMinus, 1, 1, 1}},
+    {"MODULO", {&Kernel::excModulo, 2, 2, 2}},
+    {"MOUSEPOS", {&Kernel::excMousepos, 0, 0, 0}},
+    {"NAME?", {&Kernel::excNamep, 1, 1, 1}}, // NAMEP
+    {"NAMEP", {&Kernel::excNamep, 1, 1, 1}},
+    {"NAMES", {&Kernel::excNames, 0, 0, 0}},
+    {"NODES", {&Kernel::excNodes, 0, 0, 0}},
+    {"NODESJSON", {&Kernel::excNodesjson, 0, 0, 0}},
+    {"NODESTATS", {&Kernel::excNodestats, 0, 0, 0}},
+    {"NODRIBBLE", {&Kernel::excNodribble, 0, 0, 0}},
+    {"NOREFRESH", {&Kernel::excNoop, 0, 0, 0}},
+    {"NOT", {&Kernel::excNot, 1, 1, 1}},
+    {"NOTEQUAL?", {&Kernel::excNotequal, 2, 2, 2}}, // NOTEQUALP
+    {"NOTEQUALP", {&Kernel::excNotequal, 2, 2, 2}},
+    {"NUMBER?", {&Kernel::excNumberp, 1, 1, 1}}, // NUMBERP
+    {"NUMBERP", {&Kernel::excNumberp, 1, 1, 1}},
+    {"OP", {&Kernel::excOutput, 1, 1, 1}}, // OUTPUT
+    {"OPENAPPEND", {&Kernel::excOpenappend, 1, 1, 1}},
+    {"OPENREAD", {&Kernel::excOpenread, 1, 1, 1}},
+    {"OPENUPDATE", {&Kernel::excOpenupdate, 1, 1, 1}},
+    {"OPENWRITE", {&Kernel::excOpenwrite, 1, 1, 1}},
+    {"OR", {&Kernel::excOr, 0, 2, -1}},
+    {"OUTPUT", {&Kernel::excOutput, 1, 1, 1}},
+    {"PALETTE", {&Kernel::excPalette, 1, 1, 1}},
+    {"PARSE", {&Kernel::excParse, 1, 1, 1}},
+    {"PAUSE", {&Kernel::excPause, 0, 0, 0}},
+    {"PC", {&Kernel::excPencolor, 0, 0, 0}}, // PENCOLOR
+    {"PD", {&Kernel::excPendown, 0, 0, 0}}, // PENDOWN
+    {"PE", {&Kernel::excPenerase, 0, 0, 0}}, // PENERASE
+    {"PENCOLOR", {&Kernel::excPencolor, 0, 0, 0}},
+    {"PENDOWN", {&Kernel::excPendown, 0, 0, 0}},
+    {"PENDOWN?", {&Kernel::excPendownp, 0, 0, 0}}, // PENDOWNP
+    {"PENDOWNP", {&Kernel::excPendownp, 0, 0, 0}},
+    {"PENERASE", {&Kernel::excPenerase, 0, 0, 0}},
+    {"PENMODE", {&Kernel::excPenmode, 0, 0, 0}},
+    {"PENPAINT", {&Kernel::excPenpaint, 0, 0, 0}},
+    {"PENPATTERN", {&Kernel::excNoop, 1, 1, 1}},
+    {"PENREVERSE", {&Kernel::excPenreverse, 0, 0, 0}},
+    {"PENSIZE", {&Kernel::excPensize, 0, 0, 0}},
+    {"PENUP", {&Kernel::excPenup, 0, 0, 0}},
+    {"PLIST", {&Kernel::excPlist, 1, 1, 1}},
+    {"PLIST?", {&Kernel::excPlistp, 1, 1, 1}}, // PLISTP
+    {"PLISTP", {&Kernel::excPlistp, 1, 1, 1}},
+    {"PLISTS", {&Kernel::excPlists, 0, 0, 0}},
+    {"PO", {&Kernel::excPrintout, 1, 1, 1}}, // PRINTOUT
+    {"POS", {&Kernel::excPos, 0, 0, 1}},
+    {"POT", {&Kernel::excPot, 1, 1, 1}},
+    {"POWER", {&Kernel::excPower, 2, 2, 2}},
+    {"PPROP", {&Kernel::excPprop, 3, 3, 3}},
+    {"PPT", {&Kernel::excPenpaint, 0, 0, 0}}, // PENPAINT
+    {"PR", {&Kernel::excPrint, 0, 1, -1}}, // PRINT
+    {"PREFIX", {&Kernel::excPrefix, 0, 0, 0}},
+    {"PRIMITIVE?", {&Kernel::excPrimitivep, 1, 1, 1}}, // PRIMITIVEP
+    {"PRIMITIVEP", {&Kernel::excPrimitivep, 1, 1, 1}},
+    {"PRIMITIVES", {&Kernel::excPrimitives, 0, 0, 0}},
+    {"PRINT", {&Kernel::excPrint, 0, 1, -1}},
+    {"PRINTOUT", {&Kernel::excPrintout, 1, 1, 1}},
+    {"PROCEDURE?", {&Kernel::excProcedurep, 1, 1, 1}}, // PROCEDUREP
+    {"PROCEDUREP", {&Kernel::excProcedurep, 1, 1, 1}},
+    {"PROCEDURES", {&Kernel::excProcedures, 0, 0, 0}},
+    {"PRODUCT", {&Kernel::excProduct, 0, 2, -1}},
+    {"PU", {&Kernel::excPenup, 0, 0, 0}}, // PENUP
+    {"PX", {&Kernel::excPenreverse, 0, 0, 0}}, // PENREVERSE
+    {"QUOTIENT", {&Kernel::excQuotient, 1, 2, 2}},
+    {"RADARCTAN", {&Kernel::excRadarctan, 1, 1, 2}},
+    {"RADCOS", {&Kernel::excRadcos, 1, 1, 1}},
+    {"RADSIN", {&Kernel::excRadsin, 1, 1, 1}},
+    {"RANDOM", {&Kernel::excRandom, 1, 1, 2}},
+    {"RAWASCII", {&Kernel::excRawascii, 1, 1, 1}},
+    {"RC", {&Kernel::excReadchar, 0, 0, 0}}, // READCHAR
+    {"RCS", {&Kernel::excReadchars, 1, 1, 1}}, // READCHARS
+    {"READCHAR", {&Kernel::excReadchar, 0, 0, 0}},
+    {"READCHARS", {&Kernel::excReadchars, 1, 1, 1}},
+    {"READER", {&Kernel::excReader, 0, 0, 0}},
+    {"READLIST", {&Kernel::excReadlist, 0, 0, 0}},
+    {"READPOS", {&Kernel::excReadpos, 0, 0, 0}},
+    {"READRAWLINE", {&Kernel::excReadrawline, 0, 0, 0}},
+    {"READWORD", {&Kernel::excReadword, 0, 0, 0}},
+    {"RECYCLE", {&Kernel::excRecycle, 0, 0, 0}},
+    {"REFRESH", {&Kernel::excNoop, 0, 0, 0}},
+    {"REMAINDER", {&Kernel::excRemainder, 2, 2, 2}},
+    {"REMPROP", {&Kernel::excRemprop, 2, 2, 2}},
+    {"REPCOUNT", {&Kernel::excRepcount, 0, 0, 0}},
+    {"REPEAT", {&Kernel::excRepeat, 2, 2, 2}},
+    {"RERANDOM", {&Kernel::excRerandom, 0, 0, 1}},
+    {"RIGHT", {&Kernel::excRight, 1, 1, 1}},
+    {"RL", {&Kernel::excReadlist, 0, 0, 0}}, // READLIST
+    {"ROUND", {&Kernel::excRound, 1, 1, 1}},
+    {"RT", {&Kernel::excRight, 1, 1, 1}}, // RIGHT
+    {"RUN", {&Kernel::excRun, 1, 1, 1}},
+    {"RUNPARSE", {&Kernel::excRunparse, 1, 1, 1}},
+    {"RUNRESULT", {&Kernel::excRunresult, 1, 1, 1}},
+    {"RW", {&Kernel::excReadword, 0, 0, 0}}, // READWORD
+    {"SAVE", {&Kernel::excSave, 0, -1, 1}},
+    {"SAVEPICT", {&Kernel::excSavepict, 1, 1, 1}},
+    {"SCREENMODE", {&Kernel::excScreenmode, 0, 0, 0}},
+    {"SCRUNCH", {&Kernel::excScrunch, 0, 0, 0}},
+    {"SE", {&Kernel::excSentence, 0, 2, -1}}, // SENTENCE
+    {"SENTENCE", {&Kernel::excSentence, 0, 2, -1}},
+    {"SETBACKGROUND", {&Kernel::excSetbackground, 1, 1, 1}},
+    {"SETBG", {&Kernel::excSetbackground, 1, 1, 1}}, // SETBACKGROUND
+    {"SETBOUNDS", {&Kernel::excSetbounds, 2, 2, 2}},
+    {"SETCURSOR", {&Kernel::excSetcursor, 1, 1, 1}},
+    {"SETFONT", {&Kernel::excSetfont, 1, 1, 1}},
+    {"SETH", {&Kernel::excSetheading, 1, 1, 2}}, // SETHEADING
+    {"SETHEADING", {&Kernel::excSetheading, 1, 1, 2}},
+    {"SETITEM", {&Kernel::excSetitem, 3, 3, 3}},
+    {"SETLABELHEIGHT", {&Kernel::excSetlabelheight, 1, 1, 1}},
+    {"SETPALETTE", {&Kernel::excSetpalette, 2, 2, 2}},
+    {"SETPC", {&Kernel::excSetpencolor, 1, 1, 1}}, // SETPENCOLOR
+    {"SETPENCOLOR", {&Kernel::excSetpencolor, 1, 1, 1}},
+    {"SETPENPATTERN", {&Kernel::excNoop, 1, 1, 1}},
+    {"SETPENSIZE", {&Kernel::excSetpensize, 1, 1, 1}},
+    {"SETPOS", {&Kernel::excSetpos, 1, 1, 1}},
+    {"SETPREFIX", {&Kernel::excSetprefix, 1, 1, 1}},
+    {"SETREAD", {&Kernel::excSetread, 1, 1, 1}},
+    {"SETREADPOS", {&Kernel::excSetreadpos, 1, 1, 1}},
+    {"SETSCRUNCH", {&Kernel::excSetscrunch, 2, 2, 2}},
+    {"SETTC", {&Kernel::excSettextcolor, 1, 2, 2}}, // SETTEXTCOLOR
+    {"SETTEXTCOLOR", {&Kernel::excSettextcolor, 1, 2, 2}},
+    {"SETTEXTSIZE", {&Kernel::excSettextsize, 1, 1, 1}},
+    {"SETWRITE", {&Kernel::excSetwrite, 1, 1, 1}},
+    {"SETWRITEPOS", {&Kernel::excSetwritepos, 1, 1, 1}},
+    {"SETX", {&Kernel::excSetX, 1, 1, 1}},
+    {"SETXY", {&Kernel::excSetXY, 2, 2, 2}},
+    {"SETY", {&Kernel::excSetY, 1, 1, 1}},
+    {"SHELL", {&Kernel::excShell, 1, 1, 2}},
+    {"SHOW", {&Kernel::excShow, 0, 1, -1}},
+    {"SHOWN?", {&Kernel::excShownp, 0, 0, 0}}, // SHOWNP
+    {"SHOWNP", {&Kernel::excShownp, 0, 0, 0}},
+    {"SHOWTURTLE", {&Kernel::excShowturtle, 0, 0, 0}},
+    {"SIN", {&Kernel::excSin, 1, 1, 1}},
+    {"SPLITSCREEN", {&Kernel::excSplitscreen, 0, 0, 0}},
+    {"SQRT", {&Kernel::excSqrt, 1, 1, 1}},
+    {"SS", {&Kernel::excSplitscreen, 0, 0, 0}}, // SPLITSCREEN
+    {"ST", {&Kernel::excShowturtle, 0, 0, 0}}, // SHOWTURTLE
+    {"STANDOUT", {&Kernel::excStandout, 1, 1, 1}},
+    {"STEP", {&Kernel::excStep, 1, 1, 1}},
+    {"STEPPED", {&Kernel::excStepped, 0, 0, 0}},
+    {"STEPPED?", {&Kernel::excSteppedp, 1, 1, 1}}, // STEPPEDP
+    {"STEPPEDP", {&Kernel::excSteppedp, 1, 1, 1}},
+    {"STOP", {&Kernel::excStop, 0, 0, 0}},
+    {"SUBSTRING?", {&Kernel::excSubstringp, 2, 2, 2}}, // SUBSTRINGP
+    {"SUBSTRINGP", {&Kernel::excSubstringp, 2, 2, 2}},
+    {"SUM", {&Kernel::excSum, 0, 2, -1}},
+    {"TAG", {&Kernel::excTag, 1, 1, 1}},
+    {"TEST", {&Kernel::excTest, 1, 1, 1}},
+    {"TEXT", {&Kernel::excText, 1, 1, 1}},
+    {"TEXTSCREEN", {&Kernel::excTextscreen, 0, 0, 0}},
+    {"TEXTSIZE", {&Kernel::excTextsize, 0, 0, 0}},
+    {"THING", {&Kernel::excThing, 1, 1, 1}},
+    {"THROW", {&Kernel::excThrow, 1, 1, 2}},
+    {"TO", {&Kernel::excTo, -1, -1, -1}},
+    {"TOWARDS", {&Kernel::excTowards, 1, 1, 1}},
+    {"TRACE", {&Kernel::excTrace, 1, 1, 1}},
+    {"TRACED", {&Kernel::excTraced, 0, 0, 0}},
+    {"TRACED?", {&Kernel::excTracedp, 1, 1, 1}}, // TRACEDP
+    {"TRACEDP", {&Kernel::excTracedp, 1, 1, 1}},
+    {"TS", {&Kernel::excTextscreen, 0, 0, 0}}, // TEXTSCREEN
+    {"TURTLEMODE", {&Kernel::excTurtlemode, 0, 0, 0}},
+    {"TYPE", {&Kernel::excType, 0, 1, -1}},
+    {"UNBURY", {&Kernel::excUnbury, 1, 1, 1}},
+    {"UNSTEP", {&Kernel::excUnstep, 1, 1, 1}},
+    {"UNTRACE", {&Kernel::excUntrace, 1, 1, 1}},
+    {"UPPERCASE", {&Kernel::excUppercase, 1, 1, 1}},
+    {"VBARRED?", {&Kernel::excVbarredp, 1, 1, 1}}, // VBARREDP
+    {"VBARREDP", {&Kernel::excVbarredp, 1, 1, 1}},
+    {"WAIT", {&Kernel::excWait, 1, 1, 1}},
+    {"WINDOW", {&Kernel::excWindow, 0, 0, 0}},
+    {"WORD", {&Kernel::excWord, 0, 2, -1}},
+    {"WORD?", {&Kernel::excWordp, 1, 1, 1}}, // WORDP
+    {"WORDP", {&Kernel::excWordp, 1, 1, 1}},
+    {"WRAP", {&Kernel::excWrap, 0, 0, 0}},
+    {"WRITEPOS", {&Kernel::excWritepos, 0, 0, 0}},
+    {"WRITER", {&Kernel::excWriter, 0, 0, 0}},
+};
+
+const int countOfPrimitives =
+    int(sizeof(primitiveTable) / sizeof(primitiveTable[0]));
+
+// Compare a key with the ASCII name of a primitive, like strcmp().
+static int compareWithName(const QString &key, const char *name) {
+  const QChar *k = key.constData();
+  int length = key.size();
+  int i = 0;
+  for (; (i < length) && (name[i] != '\0'); ++i) {
+    int diff = k[i].unicode() - (unsigned char)name[i];
+    if (diff != 0)
+      return diff;
+  }
+  if (i < length)
+    return 1;
+  return (name[i] == '\0') ? 0 : -1;
+}
+
+const Cmd_t *primitiveForName(const QString &name) {
+  int low = 0;
+  int high = countOfPrimitives - 1;
+  while (low <= high) {
+    int middle = (low + high) / 2;
+    int diff = compareWithName(name, primitiveTable[middle].name);
+    if (diff == 0)
+      return &primitiveTable[middle].cmd;
+    if (diff < 0)
+      high = middle - 1;
+    else
+      low = middle + 1;
+  }
+  return NULL;
+}
+
+void Parser::procedureNameChanged(Symbol procname) {
+  ++procedureGeneration;
+  procedureGenerations[procname] = procedureGeneration;
+}
+
+quint64 Parser::generationOfName(Symbol procname) {
+  return procedureGenerations.value(procname, 0);
+}
+
+void Parser::step(Symbol aName) {
+  Workspace::step(aName);
+  procedureNameChanged(aName);
+}
+
+void Parser::unstep(Symbol aName) {
+  Workspace::unstep(aName);
+  procedureNameChanged(aName);
+}
+
+void Parser::trace(Symbol aName) {
+  Workspace::trace(aName);
+  procedureNameChanged(aName);
+}
+
+void Parser::untrace(Symbol aName) {
+  Workspace::untrace(aName);
+  procedureNameChanged(aName);
+}
+
+// Returns true if a call parsed for one of these procedures can call the
+// other.
+static bool hasSameInputs(Procedure *a, Procedure *b) {
+  return (a->countOfMinParams == b->countOfMinParams) &&
+         (a->defaultNumber == b->defaultNumber) &&
+         (a->countOfMaxParams == b->countOfMaxParams) &&
+         (a->isMacro == b->isMacro);
+}
+
+ProcedureCell *Parser::cellForName(Symbol procsymbol) {
+  ProcedureCell *&cell = procedureCells[procsymbol];
+  if (cell == NULL)
+    cell = new ProcedureCell;
+  return cell;
+}
+
+// Make body the definition of procsymbol, or erase it if body is nothing.
+// Calls parsed for a definition that takes the same inputs find the new body
+// through the cell. Any other change means those calls must be parsed again.
+void Parser::setProcedure(Symbol procsymbol, DatumP body) {
+  auto iter = procedures.find(procsymbol);
+  bool isSameShape =
+      (iter != procedures.end()) && (body != nothing) &&
+      hasSameInputs(iter->procedureValue(), body.procedureValue());
+
+  if (body == nothing)
+    procedures.remove(procsymbol);
+  else
+    procedures[procsymbol] = body;
+  cellForName(procsymbol)->body = body;
+
+  if (!isSameShape)
+    procedureNameChanged(procsymbol);
+}
+
+// Point a procedure call at the current definition of its name. If the
+// definition now takes different inputs the call keeps the body it was parsed
+// with; the line it is in will be parsed again the next time it is run.
+void Parser::refreshProcedureCall(ASTNode *node) {
+  ProcedureCell *cell = node->procedureCell;
+  if (cell == NULL)
+    return;
+  const DatumP &body = node->childAtIndex(0);
+  if ((cell->body == body) || (cell->body == nothing))
+    return;
+  if (hasSameInputs(body.procedureValue(), cell->body.procedureValue()))
+    node->setChildAtIndex(0, cell->body);
+}
 
+void Parser::defineProcedure(DatumP cmd, DatumP procnameP, DatumP text,
+                             DatumP sourceText, bool shouldCompile) {
   procnameP.wordValue()->numberValue();
   if (procnameP.wordValue()->didNumberConversionSucceed())
     Error::doesntLike(cmd, procnameP);
@@ -60,15 +527,18 @@ void Parser::defineProcedure(DatumP cmd, DatumP procnameP, DatumP text,
   if ((firstChar == '"') || (firstChar == ':'))
     Error::doesntLike(cmd, procnameP);
 
-  if (stringToCmd.contains(procname))
+  if ((primitiveForName(procname) != NULL))
     Error::isPrimative(procnameP);
 
   DatumP procBody = createProcedure(cmd, text, sourceText);
 
-  procedures[procname] = procBody;
+  Symbol procsymbol = procnameP.wordValue()->symbolValue();
+  setProcedure(procsymbol, procBody);
+  if (shouldCompile)
+    compileProcedure(procBody.procedureValue());
 
   if (kernel->isInputRedirected() && kernel->varUNBURYONEDIT()) {
-    unbury(procname);
+    unbury(procsymbol);
   }
 }
 
@@ -121,6 +591,7 @@ DatumP Parser::createProcedure(DatumP cmd, DatumP text, DatumP sourceText) {
         if (paramName.size() < 1)
           Error::doesntLike(cmd, currentParam);
         body->requiredInputs.append(paramName);
+        body->requiredInputSymbols.append(symbolForKey(paramName));
         body->defaultNumber += 1;
         body->countOfMinParams += 1;
         body->countOfMaxParams += 1;
@@ -142,6 +613,7 @@ DatumP Parser::createProcedure(DatumP cmd, DatumP text, DatumP sourceText) {
           if (restName.size() < 1)
             Error::doesntLike(cmd, param);
           body->restInput = restName;
+          body->restInputSymbol = symbolForKey(restName);
           isRestDefined = true;
           body->countOfMaxParams = -1;
         } else {
@@ -159,6 +631,7 @@ DatumP Parser::createProcedure(DatumP cmd, DatumP text, DatumP sourceText) {
           if (name.size() < 1)
             Error::doesntLike(cmd, param);
           body->optionalInputs.append(name);
+          body->optionalInputSymbols.append(symbolForKey(name));
           body->optionalDefaults.append(defaultValue);
           isOptionalDefined = true;
           body->countOfMaxParams += 1;
@@ -174,8 +647,10 @@ DatumP Parser::createProcedure(DatumP cmd, DatumP text, DatumP sourceText) {
   body->instructionList = text.listValue()->butfirst();
 
   ListIterator lineIter = body->instructionList.listValue()->newIterator();
+  body->lines.reserve(body->instructionList.listValue()->size());
   while (lineIter.elementExists()) {
     DatumP lineP = lineIter.element();
+    body->lines.push_back(lineP);
     ListIterator wordIter = lineP.listValue()->newIterator();
     while (wordIter.elementExists()) {
       DatumP d = wordIter.element();
@@ -186,7 +661,7 @@ DatumP Parser::createProcedure(DatumP cmd, DatumP text, DatumP sourceText) {
           QString param = d.wordValue()->keyValue();
           if ((param.size() > 1) && (param)[0] == '"') {
             QString tag = param.right(param.size() - 1);
-            body->tagToLine[tag] = lineP;
+            body->tagToLine[tag] = body->lines.size() - 1;
           }
         }
       }
@@ -195,46 +670,66 @@ DatumP Parser::createProcedure(DatumP cmd, DatumP text, DatumP sourceText) {
   return bodyP;
 }
 
+// Parse every line of the procedure now, so that the first call doesn't pay
+// for it. A line that can't be parsed yet, such as one that calls a
+// procedure that hasn't been defined, is parsed again when it runs.
+void Parser::compileProcedure(Procedure *body) {
+  CompileAheadScope scope(kernel);
+  for (auto &lineP : body->lines) {
+    try {
+      astFromList(lineP.listValue());
+    } catch (Error *e) {
+      // The error will be reported if the line is run.
+    }
+  }
+}
+
 void Parser::copyProcedure(DatumP newnameP, DatumP oldnameP) {
-  lastProcedureCreatedTimestamp = QDateTime::currentMSecsSinceEpoch();
   QString newname = newnameP.wordValue()->keyValue();
   QString oldname = oldnameP.wordValue()->keyValue();
 
-  if (stringToCmd.contains(newname))
+  Symbol newsymbol = newnameP.wordValue()->symbolValue();
+  Symbol oldsymbol = oldnameP.wordValue()->symbolValue();
+
+  if ((primitiveForName(newname) != NULL))
     Error::isPrimative(newnameP);
 
-  if (procedures.contains(oldname)) {
-    procedures[newname] = procedures[oldname];
+  if (procedures.contains(oldsymbol)) {
+    setProcedure(newsymbol, procedures[oldsymbol]);
     return;
   }
-  if (primitiveAlternateNames.contains(oldname)) {
-    primitiveAlternateNames[newname] = primitiveAlternateNames[oldname];
+  if (primitiveAlternateNames.contains(oldsymbol)) {
+    primitiveAlternateNames[newsymbol] = primitiveAlternateNames[oldsymbol];
+    procedureNameChanged(newsymbol);
     return;
   }
-  if (stringToCmd.contains(oldname)) {
-    primitiveAlternateNames[newname] = stringToCmd[oldname];
+  const Cmd_t *primitive = primitiveForName(oldname);
+  if (primitive != NULL) {
+    primitiveAlternateNames[newsymbol] = *primitive;
+    procedureNameChanged(newsymbol);
     return;
   }
   Error::noHow(oldnameP);
 }
 
 void Parser::eraseProcedure(DatumP procnameP) {
-  lastProcedureCreatedTimestamp = QDateTime::currentMSecsSinceEpoch();
-
   QString procname = procnameP.wordValue()->keyValue();
-  if (stringToCmd.contains(procname))
+  Symbol procsymbol = procnameP.wordValue()->symbolValue();
+  if ((primitiveForName(procname) != NULL))
     Error::isPrimative(procnameP);
-  procedures.remove(procname);
+  if (procedures.contains(procsymbol))
+    setProcedure(procsymbol, nothing);
 }
 
 DatumP Parser::procedureText(DatumP procnameP) {
   QString procname = procnameP.wordValue()->keyValue();
+  Symbol procsymbol = procnameP.wordValue()->symbolValue();
 
-  if (stringToCmd.contains(procname))
+  if ((primitiveForName(procname) != NULL))
     Error::isPrimative(procnameP);
-  if (!procedures.contains(procname))
+  if (!procedures.contains(procsymbol))
     Error::noHow(procnameP);
-  Procedure *body = procedures[procname].procedureValue();
+  Procedure *body = procedures[procsymbol].procedureValue();
 
   List *retval = new List;
 
@@ -275,11 +770,12 @@ DatumP Parser::procedureText(DatumP procnameP) {
 
 DatumP Parser::procedureFulltext(DatumP procnameP, bool shouldValidate) {
   const QString procname = procnameP.wordValue()->keyValue();
-  if (stringToCmd.contains(procname))
+  Symbol procsymbol = procnameP.wordValue()->symbolValue();
+  if ((primitiveForName(procname) != NULL))
     Error::isPrimative(procnameP);
 
-  if (procedures.contains(procname)) {
-    Procedure *body = procedures[procname].procedureValue();
+  if (procedures.contains(procsymbol)) {
+    Procedure *body = procedures[procsymbol].procedureValue();
 
     List *retval = new List;
 
@@ -310,13 +806,14 @@ DatumP Parser::procedureFulltext(DatumP procnameP, bool shouldValidate) {
 
 QString Parser::procedureTitle(DatumP procnameP) {
   QString procname = procnameP.wordValue()->keyValue();
+  Symbol procsymbol = procnameP.wordValue()->symbolValue();
 
-  if (stringToCmd.contains(procname))
+  if ((primitiveForName(procname) != NULL))
     Error::isPrimative(procnameP);
-  if (!procedures.contains(procname))
+  if (!procedures.contains(procsymbol))
     Error::noHow(procnameP);
 
-  Procedure *body = procedures[procname].procedureValue();
+  Procedure *body = procedures[procsymbol].procedureValue();
 
   List *firstLine = new List;
 
@@ -383,7 +880,7 @@ void Parser::inputProcedure(DatumP nodeP, QTextStream *readStream) {
       (firstChar == ')'))
     Error::doesntLike(to, procnameP);
 
-  if (stringToCmd.contains(procname))
+  if ((primitiveForName(procname) != NULL))
     Error::procDefined(procnameP);
 
   DatumP textP(new List);
@@ -414,10 +911,10 @@ void Parser::inputProcedure(DatumP nodeP, QTextStream *readStream) {
   }
 
   defineProcedure(to, procnameP, textP, sourceText);
+  kernel->recordDefinition(to, procnameP, textP, sourceText);
 
   kernel->sysPrint(procnameP.wordValue()->printValue());
   kernel->sysPrint(" defined\n");
-  lastProcedureCreatedTimestamp = QDateTime::currentMSecsSinceEpoch();
 }
 
 DatumP Parser::readrawlineWithPrompt(const QString &prompt,
@@ -443,6 +940,7 @@ DatumP Parser::readwordWithPrompt(const QString &prompt,
   QString retval = "";
   bool isVbarred = false;
   bool isEscaped = false;
+  bool isFirstLine = true;
 
   DatumP line = readrawlineWithPrompt(prompt, readStream);
   if (line == nothing)
@@ -453,23 +951,37 @@ DatumP Parser::readwordWithPrompt(const QString &prompt,
       return DatumP(new Word(retval));
 
     const QString &t = line.wordValue()->rawValue();
-    retval.reserve(retval.size() + t.size());
-    for (auto c : t) {
+    const QChar *data = t.constData();
+    int size = t.size();
+    // The characters from runStart on haven't been copied to retval yet.
+    int runStart = 0;
+    for (int i = 0; i < size; ++i) {
+      QChar c = data[i];
       if (isEscaped) {
         isEscaped = false;
-        retval.push_back(charToRaw(c));
+        retval.append(charToRaw(c));
+        runStart = i + 1;
         continue;
       }
       if (c == '|') {
         isVbarred = !isVbarred;
       }
       if (c == '\\') {
+        retval.append(data + runStart, i - runStart);
         isEscaped = true;
+        runStart = i + 1;
         continue;
       }
-
-      retval.push_back(c);
     } // i
+
+    bool isContinued = isEscaped || isVbarred || (lastNonSpaceChar(t) == '~');
+
+    // A complete line without escapes is returned as it was read.
+    if (isFirstLine && !isContinued && (runStart == 0))
+      return line;
+    isFirstLine = false;
+    retval.append(data + runStart, size - runStart);
+
     // The end of the line
     if (isEscaped) {
       isEscaped = false;
@@ -492,39 +1004,93 @@ DatumP Parser::readwordWithPrompt(const QString &prompt,
   }; // forever
 }
 
-DatumP Parser::tokenizeListWithPrompt(const QString &prompt, int level,
-                                      bool makeArray, bool shouldRemoveComments,
-                                      QTextStream *readStream) {
-  DatumP lineP;
-  static QString src;
-  static QString::iterator iter;
-
-  if (level == 0) {
-    lineP = readwordWithPrompt(prompt, readStream);
+// A list or array being read by tokenizeListWithPrompt().
+struct OpenList {
+  DatumP listP;
+  bool isArray;
+};
 
-    if (lineP == nothing) return nothing;
+DatumP Parser::tokenizeListWithPrompt(const QString &prompt,
+                                      bool shouldRemoveComments,
+                                      QTextStream *readStream) {
+  DatumP lineP = readwordWithPrompt(prompt, readStream);
+  if (lineP == nothing)
+    return nothing;
 
-    src = lineP.wordValue()->rawValue();
-    iter = src.begin();
-  }
-  List *retval = new List;
-  DatumP retvalP(retval);
-  QString currentWord = "";
+  // The lists and arrays that haven't been closed yet, innermost last. The
+  // first is the list that is returned.
+  QVector<OpenList> openLists;
+  openLists.push_back({DatumP(new List), false});
+
+  QString src = lineP.wordValue()->rawValue();
+  const QChar *data = src.constData();
+
+  // Most words are a run of characters of src, and are copied out of it once
+  // when they are complete. A word that has characters removed or converted
+  // (by vertical bars or a line continuation) is built in currentWord instead.
+  int wordStart = -1;
+  int wordEnd = -1;
+  QString currentWord;
+  bool isWordCopied = false;
+  bool isCurrentWordVbarred = false;
+
+  auto addChar = [&](int position) {
+    if (!isWordCopied) {
+      if (wordStart < 0) {
+        wordStart = position;
+        wordEnd = position + 1;
+        return;
+      }
+      if (position == wordEnd) {
+        ++wordEnd;
+        return;
+      }
+      currentWord = src.mid(wordStart, wordEnd - wordStart);
+      isWordCopied = true;
+    }
+    currentWord.append(data[position]);
+  };
+
+  auto addRawChar = [&](QChar c) {
+    if (!isWordCopied) {
+      if (wordStart >= 0)
+        currentWord = src.mid(wordStart, wordEnd - wordStart);
+      isWordCopied = true;
+    }
+    currentWord.append(charToRaw(c));
+  };
+
+  auto finishWord = [&]() {
+    if (isWordCopied) {
+      if (currentWord.size() > 0)
+        openLists.last().listP.listValue()->append(
+            DatumP(new Word(currentWord, isCurrentWordVbarred)));
+      currentWord = QString();
+    } else if (wordStart >= 0) {
+      openLists.last().listP.listValue()->append(DatumP(
+          new Word(src.mid(wordStart, wordEnd - wordStart),
+                   isCurrentWordVbarred)));
+    }
+    wordStart = -1;
+    isWordCopied = false;
+    isCurrentWordVbarred = false;
+  };
 
   forever {
     bool isVbarred = false;
-    bool isCurrentWordVbarred = false;
+    int size = src.size();
+    int i = 0;
 
-    while (iter != src.end()) {
-      ushort c = iter->unicode();
-      ++iter;
+    while (i < size) {
+      ushort c = data[i].unicode();
+      ++i;
 
       if (isVbarred) {
         if (c == '|') {
           isVbarred = false;
           continue;
         }
-        currentWord.push_back(charToRaw(c));
+        addRawChar(c);
         continue;
       }
       if (c == '|') {
@@ -536,110 +1102,95 @@ DatumP Parser::tokenizeListWithPrompt(const QString &prompt, int level,
       if (c == '~') {
         // If this is the last character of the line then jump to the beginning
         // of the next line
-        QString::iterator lookAhead = iter;
-        while (*lookAhead == ' ')
-          ++lookAhead;
-        if (*lookAhead == '\n') {
+        int lookAhead = i;
+        while ((lookAhead < size) && (data[lookAhead] == ' '))
           ++lookAhead;
-          iter = lookAhead;
+        if ((lookAhead < size) && (data[lookAhead] == '\n')) {
+          i = lookAhead + 1;
           continue;
         }
       }
       if (((c == ';') ||
-           ((c == '#') && (iter != src.end()) && (iter->unicode() == '!'))) &&
-          shouldRemoveComments) {
-        // This is a comment
-        while ((iter != src.end()) && (*iter != '\n'))
-          ++iter;
-        // Consume the eol
-        if (iter != src.end())
-          ++iter;
-        continue;
-      }
-      if ((c == '#') && (iter != src.end()) && (iter->unicode() == '!') &&
+           ((c == '#') && (i < size) && (data[i].unicode() == '!'))) &&
           shouldRemoveComments) {
         // This is a comment
-        while ((iter != src.end()) && (*iter != '\n'))
-          ++iter;
+        while ((i < size) && (data[i] != '\n'))
+          ++i;
         // Consume the eol
-        if (iter != src.end())
-          ++iter;
+        if (i < size)
+          ++i;
         continue;
       }
       if ((c == ' ') || (c == '\t') || (c == '[') || (c == ']') || (c == '{') ||
           (c == '}')) {
         // This is a delimiter
-        if (currentWord.size() > 0) {
-          retval->append(DatumP(new Word(currentWord, isCurrentWordVbarred)));
-          currentWord = "";
-          isCurrentWordVbarred = false;
-        }
+        finishWord();
         switch (c) {
         case '[':
-          retval->append(tokenizeListWithPrompt(
-              "", level + 1, false, shouldRemoveComments, readStream));
+          openLists.push_back({DatumP(new List), false});
+          break;
+        case '{':
+          openLists.push_back({DatumP(new List), true});
           break;
-        case ']':
-          if ((level == 0) || makeArray) {
+        case ']': {
+          if ((openLists.size() == 1) || openLists.last().isArray) {
             Error::unexpectedCloseSquare();
           }
-          return retvalP;
+          DatumP sublist = openLists.takeLast().listP;
+          openLists.last().listP.listValue()->append(sublist);
+          break;
+        }
         case '}': {
-          if ((level == 0) || !makeArray) {
+          if ((openLists.size() == 1) || !openLists.last().isArray) {
             Error::unexpectedCloseBrace();
           }
           int origin = 1;
           // See if array has a custom origin
-          if (*iter == '@') {
-            QString originStr = "";
-            ++iter;
-            while ((*iter >= '0') && (*iter <= '9')) {
-              originStr += *iter;
-              ++iter;
-            }
-            origin = originStr.toInt();
+          if ((i < size) && (data[i] == '@')) {
+            ++i;
+            int originStart = i;
+            while ((i < size) && (data[i] >= '0') && (data[i] <= '9'))
+              ++i;
+            origin = src.mid(originStart, i - originStart).toInt();
           }
-          Array *ary = new Array(origin, retval);
-          return DatumP(ary);
-        }
-        case '{':
-          retval->append(tokenizeListWithPrompt(
-              "", level + 1, true, shouldRemoveComments, readStream));
+          DatumP sublist = openLists.takeLast().listP;
+          openLists.last().listP.listValue()->append(
+              DatumP(new Array(origin, sublist.listValue())));
           break;
+        }
         default:
           break;
         }
       } else {
-        currentWord.push_back(c);
+        addChar(i - 1);
       }
     }
     // This is the end of the read. Add the last word to the list.
-    if (currentWord.size() > 0) {
-      retval->append(DatumP(new Word(currentWord, isCurrentWordVbarred)));
-      currentWord = "";
-      isCurrentWordVbarred = false;
-    }
+    finishWord();
 
     // If this is the base-level list then we can just return
-    if (level == 0)
-      return DatumP(retval);
+    if (openLists.size() == 1)
+      return openLists.first().listP;
 
     // Get some more source material if we can
-    if (makeArray)
+    if (openLists.last().isArray)
       lineP = readwordWithPrompt("{ ", readStream);
     else
       lineP = readwordWithPrompt("[ ", readStream);
     if (lineP != nothing) {
       src = lineP.wordValue()->rawValue();
-      iter = src.begin();
+      data = src.constData();
       continue;
     }
-    // We have exhausted our source. Return what we have.
-    if (makeArray) {
-      Array *ary = new Array(1, retval);
-      return DatumP(ary);
+    // We have exhausted our source. Close whatever is still open.
+    while (openLists.size() > 1) {
+      OpenList inner = openLists.takeLast();
+      DatumP sublist = inner.listP;
+      if (inner.isArray)
+        sublist = DatumP(new Array(1, inner.listP.listValue()));
+      openLists.last().listP.listValue()->append(sublist);
     }
-    return retvalP;
+    return openLists.first().listP;
   }
 }
 
@@ -650,8 +1201,7 @@ DatumP Parser::readlistWithPrompt(const QString &prompt,
   isReadingList = true;
   DatumP retval;
   try {
-    retval = tokenizeListWithPrompt(prompt, 0, false, shouldRemoveComments,
-                                    readStream);
+    retval = tokenizeListWithPrompt(prompt, shouldRemoveComments, readStream);
   } catch (Error *e) {
     isReadingList = false;
     throw e;
@@ -666,43 +1216,107 @@ DatumP Parser::lastReadListSource() {
   return retval;
 }
 
+// The text of each Token::Operator.
+static const char *const operatorNames[Token::countOfOperators] = {
+    "", "=", "<>", "<", ">", "<=", ">=", "+", "-", "*", "/", "%", "--", "(", ")"};
+
+// Operators are shared Words that are never destroyed, so that runparse
+// doesn't allocate a Word for each one.
+static DatumP operatorWord(Token::Operator op) {
+  static Word *words[Token::countOfOperators] = {};
+  if (words[op] == NULL)
+    words[op] = new Word(operatorNames[op], false, false);
+  return DatumP(words[op]);
+}
+
+void Parser::runparseAppend(Token::Kind kind, DatumP datum,
+                            Token::Operator op) {
+  runparseTokens.push_back({kind, op, std::move(datum)});
+}
+
+void Parser::runparseAppendOperator(Token::Operator op) {
+  runparseAppend(Token::operatorToken, operatorWord(op), op);
+}
+
 void Parser::runparseSpecialchars(void) {
-  QString retval = *runparseCIter;
+  ushort c = runparseCIter->unicode();
   ++runparseCIter;
-  if (runparseCIter != runparseCEnd) {
-    QChar c = *runparseCIter;
-    // there are some cases where special chars are combined
-    if (((retval == "<") && (c == '=')) || ((retval == "<") && (c == '>')) ||
-        ((retval == ">") && (c == '='))) {
-      retval += c;
+  ushort next = (runparseCIter != runparseCEnd) ? runparseCIter->unicode() : 0;
+  Token::Operator op = Token::noOperator;
+  switch (c) {
+  case '+':
+    op = Token::plusOp;
+    break;
+  case '-':
+    op = Token::minusOp;
+    break;
+  case '*':
+    op = Token::timesOp;
+    break;
+  case '/':
+    op = Token::divideOp;
+    break;
+  case '%':
+    op = Token::remainderOp;
+    break;
+  case '(':
+    op = Token::openParenOp;
+    break;
+  case ')':
+    op = Token::closeParenOp;
+    break;
+  case '=':
+    op = Token::equalOp;
+    break;
+  // there are some cases where special chars are combined
+  case '<':
+    if (next == '=') {
+      op = Token::lessEqualOp;
       ++runparseCIter;
+    } else if (next == '>') {
+      op = Token::notEqualOp;
+      ++runparseCIter;
+    } else {
+      op = Token::lessOp;
+    }
+    break;
+  case '>':
+    if (next == '=') {
+      op = Token::greaterEqualOp;
+      ++runparseCIter;
+    } else {
+      op = Token::greaterOp;
     }
+    break;
+  default:
+    Q_ASSERT(false);
   }
-  runparseRetval->append(new Word(retval));
+  runparseAppendOperator(op);
 }
 
 void Parser::runparseString() {
-  QString retval = "";
-
   if (*runparseCIter == '?') {
-    retval = "?";
     ++runparseCIter;
     DatumP number = runparseNumber();
     if (number != nothing) {
-      runparseRetval->append(new Word("("));
-      runparseRetval->append(new Word("?"));
-      runparseRetval->append(number);
-      runparseRetval->append(new Word(")"));
+      static DatumP questionMark(new Word("?", false, false));
+      runparseAppendOperator(Token::openParenOp);
+      runparseAppend(Token::nameToken, questionMark);
+      runparseAppend(Token::numberToken, number);
+      runparseAppendOperator(Token::closeParenOp);
       return;
     }
+    --runparseCIter;
   }
 
+  QString::iterator start = runparseCIter;
   while ((runparseCIter != runparseCEnd) &&
          (!specialChars.contains(*runparseCIter))) {
-    retval += *runparseCIter;
     ++runparseCIter;
   }
-  runparseRetval->append(new Word(retval, isRunparseSourceSpecial));
+  Token::Kind kind = (*start == ':') ? Token::variableToken : Token::nameToken;
+  runparseAppend(kind, DatumP(new Word(QString(start, runparseCIter - start),
+                                       isRunparseSourceSpecial)));
 }
 
 void Parser::runparseMinus() {
@@ -715,13 +1329,13 @@ void Parser::runparseMinus() {
 
   DatumP number = runparseNumber();
   if (number != nothing) {
-    runparseRetval->append(number);
+    runparseAppend(Token::numberToken, number);
     return;
   }
 
   // This is a minus function
-  runparseRetval->append(DatumP(new Word("0")));
-  runparseRetval->append(DatumP(new Word("--")));
+  runparseAppend(Token::numberToken, DatumP(new Word(0)));
+  runparseAppendOperator(Token::unaryMinusOp);
   // discard the minus
   ++runparseCIter;
 }
@@ -730,11 +1344,9 @@ DatumP Parser::runparseNumber() {
   if (runparseCIter == runparseCEnd)
     return nothing;
   QString::iterator iter = runparseCIter;
-  QString result = "";
   bool hasDigit = false;
   QChar c = *iter;
   if (c == '-') {
-    result = "-";
     ++iter;
   }
 
@@ -742,7 +1354,6 @@ DatumP Parser::runparseNumber() {
     return nothing;
   c = *iter;
   while (c.isDigit()) {
-    result += c;
     ++iter;
     if (iter == runparseCEnd)
       goto numberSuccessful;
@@ -750,14 +1361,12 @@ DatumP Parser::runparseNumber() {
     hasDigit = true;
   }
   if (c == '.') {
-    result += c;
     ++iter;
     if ((iter == runparseCEnd) && hasDigit)
       goto numberSuccessful;
     c = *iter;
   }
   while (c.isDigit()) {
-    result += c;
     ++iter;
     if (iter == runparseCEnd)
       goto numberSuccessful;
@@ -769,7 +1378,6 @@ DatumP Parser::runparseNumber() {
     return nothing;
   hasDigit = false;
   if ((c == 'e') || (c == 'E')) {
-    result += c;
     ++iter;
     if (iter == runparseCEnd)
       return nothing;
@@ -779,14 +1387,12 @@ DatumP Parser::runparseNumber() {
   }
 
   if ((c == '+') || (c == '-')) {
-    result += c;
     ++iter;
     if (iter == runparseCEnd)
       return nothing;
     c = *iter;
   }
   while (c.isDigit()) {
-    result += c;
     ++iter;
     hasDigit = true;
     if (iter == runparseCEnd)
@@ -803,36 +1409,32 @@ DatumP Parser::runparseNumber() {
     return nothing;
 
 numberSuccessful:
-  double value = result.toDouble();
+  double value;
+  parseNumber(QString(runparseCIter, iter - runparseCIter), value);
   runparseCIter = iter;
   return DatumP(new Word(value));
 }
 
 void Parser::runparseQuotedWord() {
-  QString retval = "";
+  QString::iterator start = runparseCIter;
   while ((runparseCIter != runparseCEnd) && (*runparseCIter != '(') &&
          (*runparseCIter != ')')) {
-    retval += *runparseCIter;
     ++runparseCIter;
   }
-  runparseRetval->append(new Word(retval, isRunparseSourceSpecial));
+  runparseAppend(Token::quotedToken,
+                 DatumP(new Word(QString(start, runparseCIter - start),
+                                 isRunparseSourceSpecial)));
 }
 
-/*
-     * RUNPARSE wordorlist
-
-        outputs the list that would result if the input word or list were
-        entered as an instruction line; characters such as infix operators
-        and parentheses are separate members of the output.  Note that
-        sublists of a runparsed list are not themselves runparsed.
-     */
-DatumP Parser::runparse(DatumP src) {
+// Fill runparseTokens with the runparsed members of src.
+void Parser::runparseTokenize(DatumP src) {
   if (src.isWord()) {
     QString text = src.wordValue()->rawValue();
     QTextStream srcStream(&text, QIODevice::ReadOnly);
     src = readlistWithPrompt("", false, &srcStream);
   }
-  runparseRetval = new List;
+  runparseTokens.clear();
+  runparseTokens.reserve(src.listValue()->size());
   ListIterator iter = src.listValue()->newIterator();
 
   while (iter.elementExists()) {
@@ -862,30 +1464,79 @@ DatumP Parser::runparse(DatumP src) {
         if (number == nothing) {
           runparseString();
         } else {
-          runparseRetval->append(number);
+          runparseAppend(Token::numberToken, number);
         }
       } // while (cIter != oldWord.end())
     } else {
       // The element is not a word so we'll just push back whatever it was
-      runparseRetval->append(element);
+      runparseAppend(Token::listToken, element);
     }
   }
-  return DatumP(runparseRetval);
 }
 
-QList<DatumP> *Parser::astFromList(List *aList) {
-  if (aList->astParseTimeStamp <= lastProcedureCreatedTimestamp) {
-    aList->astParseTimeStamp = QDateTime::currentMSecsSinceEpoch();
+/*
+     * RUNPARSE wordorlist
+
+        outputs the list that would result if the input word or list were
+        entered as an instruction line; characters such as infix operators
+        and parentheses are separate members of the output.  Note that
+        sublists of a runparsed list are not themselves runparsed.
+     */
+DatumP Parser::runparse(DatumP src) {
+  runparseTokenize(src);
+  List *retval = new List;
+  for (auto &token : runparseTokens) {
+    retval->append(token.datum);
+  }
+  runparseTokens.clear();
+  return DatumP(retval);
+}
 
-    DatumP runParsedList = runparse(aList);
+bool Parser::isAstCurrent(List *aList) {
+  if (aList->astParseGeneration == 0)
+    return false;
+  if (aList->astParseGeneration == procedureGeneration)
+    return true;
+  for (auto iter = aList->astDependencies.constBegin();
+       iter != aList->astDependencies.constEnd(); ++iter) {
+    if (generationOfName(iter.key()) != iter.value())
+      return false;
+  }
+  // Nothing this list depends on has changed. Skip the check next time.
+  aList->astParseGeneration = procedureGeneration;
+  return true;
+}
 
-    listIter = runParsedList.listValue()->newIterator();
+QList<DatumP> *Parser::astFromList(List *aList) {
+  if (!isAstCurrent(aList)) {
+    aList->astParseGeneration = 0;
     aList->astList.clear();
-    advanceToken();
+    aList->astDependencies.clear();
+    aList->bytecode.clear();
+    aList->bytecodeTags.clear();
+    aList->bytecodeInlinedLists.clear();
+    aList->astBuildNumber = ++astBuildCount;
+
+    runparseTokenize(aList);
+    tokenIndex = 0;
+    QHash<Symbol, quint64> *oldDependencies = astDependencies;
+    astDependencies = &aList->astDependencies;
+    try {
+      advanceToken();
 
-    while (currentToken != nothing) {
-      aList->astList.push_back(parseExp());
+      while (currentToken != nothing) {
+        aList->astList.push_back(parseExp());
+      }
+    } catch (Error *e) {
+      astDependencies = oldDependencies;
+      runparseTokens.clear();
+      aList->astList.clear();
+      aList->astDependencies.clear();
+      throw e;
     }
+    astDependencies = oldDependencies;
+    runparseTokens.clear();
+    aList->astParseGeneration = procedureGeneration;
   }
   return &aList->astList;
 }
@@ -894,14 +1545,10 @@ QList<DatumP> *Parser::astFromList(List *aList) {
 
 DatumP Parser::parseExp() {
   DatumP left = parseSumexp();
-  while ((currentToken.isa() == Datum::wordType) &&
-         ((currentToken.wordValue()->printValue() == "=") ||
-          (currentToken.wordValue()->printValue() == "<>") ||
-          (currentToken.wordValue()->printValue() == ">") ||
-          (currentToken.wordValue()->printValue() == "<") ||
-          (currentToken.wordValue()->printValue() == ">=") ||
-          (currentToken.wordValue()->printValue() == "<="))) {
+  while ((currentKind == Token::operatorToken) &&
+         (currentOp >= Token::equalOp) && (currentOp <= Token::greaterEqualOp)) {
     DatumP op = currentToken;
+    Token::Operator opType = currentOp;
     advanceToken();
     DatumP right = parseSumexp();
 
@@ -909,32 +1556,39 @@ DatumP Parser::parseExp() {
     if (right == nothing)
       Error::notEnough(op);
 
-    if (op.wordValue()->printValue() == "=") {
+    switch (opType) {
+    case Token::equalOp:
       node.astnodeValue()->kernel = &Kernel::excEqualp;
-    } else if (op.wordValue()->printValue() == "<>") {
+      break;
+    case Token::notEqualOp:
       node.astnodeValue()->kernel = &Kernel::excNotequal;
-    } else if (op.wordValue()->printValue() == "<") {
+      break;
+    case Token::lessOp:
       node.astnodeValue()->kernel = &Kernel::excLessp;
-    } else if (op.wordValue()->printValue() == ">") {
+      break;
+    case Token::greaterOp:
       node.astnodeValue()->kernel = &Kernel::excGreaterp;
-    } else if (op.wordValue()->printValue() == "<=") {
+      break;
+    case Token::lessEqualOp:
       node.astnodeValue()->kernel = &Kernel::excLessequalp;
-    } else {
+      break;
+    default:
       node.astnodeValue()->kernel = &Kernel::excGreaterequalp;
+      break;
     }
     node.astnodeValue()->addChild(left);
     node.astnodeValue()->addChild(right);
-    left = node;
+    left = foldConstants(node);
   }
   return left;
 }
 
 DatumP Parser::parseSumexp() {
   DatumP left = parseMulexp();
-  while ((currentToken.isa() == Datum::wordType) &&
-         ((currentToken.wordValue()->printValue() == "+") ||
-          (currentToken.wordValue()->printValue() == "-"))) {
+  while ((currentKind == Token::operatorToken) &&
+         ((currentOp == Token::plusOp) || (currentOp == Token::minusOp))) {
     DatumP op = currentToken;
+    Token::Operator opType = currentOp;
     advanceToken();
     DatumP right = parseMulexp();
 
@@ -942,25 +1596,25 @@ DatumP Parser::parseSumexp() {
     if (right == nothing)
       Error::notEnough(op);
 
-    if (op.wordValue()->printValue() == "+") {
+    if (opType == Token::plusOp) {
       node.astnodeValue()->kernel = &Kernel::excSum;
     } else {
       node.astnodeValue()->kernel = &Kernel::excDifference;
     }
     node.astnodeValue()->addChild(left);
     node.astnodeValue()->addChild(right);
-    left = node;
+    left = foldConstants(node);
   }
   return left;
 }
 
 DatumP Parser::parseMulexp() {
   DatumP left = parseminusexp();
-  while ((currentToken.isa() == Datum::wordType) &&
-         ((currentToken.wordValue()->printValue() == "*") ||
-          (currentToken.wordValue()->printValue() == "/") ||
-          (currentToken.wordValue()->printValue() == "%"))) {
+  while ((currentKind == Token::operatorToken) &&
+         ((currentOp == Token::timesOp) || (currentOp == Token::divideOp) ||
+          (currentOp == Token::remainderOp))) {
     DatumP op = currentToken;
+    Token::Operator opType = currentOp;
     advanceToken();
     DatumP right = parseminusexp();
 
@@ -968,24 +1622,24 @@ DatumP Parser::parseMulexp() {
     if (right == nothing)
       Error::notEnough(op);
 
-    if (op.wordValue()->printValue() == "*") {
+    if (opType == Token::timesOp) {
       node.astnodeValue()->kernel = &Kernel::excProduct;
-    } else if (op.wordValue()->printValue() == "/") {
+    } else if (opType == Token::divideOp) {
       node.astnodeValue()->kernel = &Kernel::excQuotient;
     } else {
       node.astnodeValue()->kernel = &Kernel::excRemainder;
     }
     node.astnodeValue()->addChild(left);
     node.astnodeValue()->addChild(right);
-    left = node;
+    left = foldConstants(node);
   }
   return left;
 }
 
 DatumP Parser::parseminusexp() {
   DatumP left = parseTermexp();
-  while ((currentToken.isa() == Datum::wordType) &&
-         ((currentToken.wordValue()->printValue() == "--"))) {
+  while ((currentKind == Token::operatorToken) &&
+         (currentOp == Token::unaryMinusOp)) {
     DatumP op = currentToken;
     advanceToken();
     DatumP right = parseTermexp();
@@ -997,7 +1651,7 @@ DatumP Parser::parseminusexp() {
     node.astnodeValue()->kernel = &Kernel::excDifference;
     node.astnodeValue()->addChild(left);
     node.astnodeValue()->addChild(right);
-    left = node;
+    left = foldConstants(node);
   }
   return left;
 }
@@ -1025,17 +1679,15 @@ DatumP Parser::parseTermexp() {
   Q_ASSERT(currentToken.isa() == Datum::wordType);
 
   // See if it's an open paren
-  if (currentToken.wordValue()->printValue() == "(") {
+  if ((currentKind == Token::operatorToken) &&
+      (currentOp == Token::openParenOp)) {
     // This may be an expression or a vararg function
     DatumP retval;
 
     advanceToken();
-    if ((currentToken != nothing) && currentToken.isWord()) {
-      QString cmdString = currentToken.wordValue()->keyValue();
-      QChar firstChar = (cmdString)[0];
-      if ((firstChar != '"') && (firstChar != ':') &&
-          ((firstChar < '0') || (firstChar > '9')) &&
-          !specialChars.contains(firstChar)) {
+    if (currentKind == Token::nameToken) {
+      QChar firstChar = currentToken.wordValue()->keyValue()[0];
+      if ((firstChar < '0') || (firstChar > '9')) {
         retval = parseCommand(true);
       } else {
         retval = parseExp();
@@ -1045,8 +1697,8 @@ DatumP Parser::parseTermexp() {
     }
 
     // Make sure there is a closing paren
-    if ((!currentToken.isWord()) ||
-        (currentToken.wordValue()->printValue() != ")")) {
+    if ((currentKind != Token::operatorToken) ||
+        (currentOp != Token::closeParenOp)) {
 
       Error::parenNf();
     }
@@ -1055,8 +1707,9 @@ DatumP Parser::parseTermexp() {
     return retval;
   }
 
-  QChar firstChar = currentToken.wordValue()->rawValue().at(0);
-  if ((firstChar == '"') || (firstChar == ':')) {
+  if ((currentKind == Token::quotedToken) ||
+      (currentKind == Token::variableToken)) {
+    QChar firstChar = currentToken.wordValue()->rawValue().at(0);
     QString name = currentToken.wordValue()->rawValue().right(
         currentToken.wordValue()->rawValue().size() - 1);
     if (!currentToken.wordValue()->isForeverSpecial) {
@@ -1079,8 +1732,10 @@ DatumP Parser::parseTermexp() {
   }
 
   // See if it's a number
-  currentToken.wordValue()->numberValue();
-  if (currentToken.wordValue()->didNumberConversionSucceed()) {
+  if ((currentKind == Token::numberToken) ||
+      ((currentKind == Token::nameToken) &&
+       (currentToken.wordValue()->numberValue(),
+        currentToken.wordValue()->didNumberConversionSucceed()))) {
     DatumP node(new ASTNode("number"));
     node.astnodeValue()->kernel = &Kernel::executeLiteral;
     node.astnodeValue()->addChild(currentToken);
@@ -1115,40 +1770,43 @@ DatumP Parser::astnodeWithLiterals(DatumP cmd, DatumP params) {
 
 DatumP Parser::astnodeFromCommand(DatumP cmdP, int &minParams,
                                   int &defaultParams, int &maxParams) {
-  QString cmdString = cmdP.wordValue()->keyValue();
+  Symbol cmdSymbol = cmdP.wordValue()->symbolValue();
+
+  if (astDependencies != NULL)
+    astDependencies->insert(cmdSymbol, generationOfName(cmdSymbol));
 
-  Cmd_t command;
+  const Cmd_t *command;
   DatumP node = DatumP(new ASTNode(cmdP));
-  if (procedures.contains(cmdString)) {
-    DatumP procBody = procedures[cmdString];
+  auto procIter = procedures.find(cmdSymbol);
+  if (procIter != procedures.end()) {
+    DatumP procBody = *procIter;
     if (procBody.procedureValue()->isMacro)
       node.astnodeValue()->kernel = &Kernel::executeMacro;
     else
       node.astnodeValue()->kernel = &Kernel::executeProcedure;
     node.astnodeValue()->addChild(procBody);
+    node.astnodeValue()->procedureCell = cellForName(cmdSymbol);
     defaultParams = procBody.procedureValue()->defaultNumber;
     minParams = procBody.procedureValue()->countOfMinParams;
     maxParams = procBody.procedureValue()->countOfMaxParams;
-  } else if (stringToCmd.contains(cmdString) ||
-             primitiveAlternateNames.contains(cmdString)) {
-    command = primitiveAlternateNames.contains(cmdString)
-                  ? primitiveAlternateNames[cmdString]
-                  : stringToCmd[cmdString];
-    defaultParams = command.countOfDefaultParams;
-    minParams = command.countOfMinParams;
-    maxParams = command.countOfMaxParams;
-    node.astnodeValue()->kernel = command.method;
-  } else if (cmdString.startsWith("SET") && (cmdString.size() > 3) &&
-             kernel->varALLOWGETSET()) {
-    node.astnodeValue()->kernel = &Kernel::excSetfoo;
-    defaultParams = 1;
-    minParams = 1;
-    maxParams = 1;
+  } else if ((command = primitiveForSymbol(cmdSymbol)) != NULL) {
+    defaultParams = command->countOfDefaultParams;
+    minParams = command->countOfMinParams;
+    maxParams = command->countOfMaxParams;
+    node.astnodeValue()->kernel = command->method;
   } else if (kernel->varALLOWGETSET()) {
-    node.astnodeValue()->kernel = &Kernel::excFoo;
-    defaultParams = 0;
-    minParams = 0;
-    maxParams = 0;
+    const QString &cmdString = keyForSymbol(cmdSymbol);
+    if (cmdString.startsWith("SET") && (cmdString.size() > 3)) {
+      node.astnodeValue()->kernel = &Kernel::excSetfoo;
+      defaultParams = 1;
+      minParams = 1;
+      maxParams = 1;
+    } else {
+      node.astnodeValue()->kernel = &Kernel::excFoo;
+      defaultParams = 0;
+      minParams = 0;
+      maxParams = 0;
+    }
   } else {
     Error::noHow(cmdP);
   }
@@ -1159,9 +1817,9 @@ DatumP Parser::parseCommand(bool isVararg) {
   if (currentToken == nothing)
     return nothing;
   DatumP cmdP = currentToken;
-  QString cmdString = cmdP.wordValue()->keyValue();
 
-  if (cmdString == ")")
+  if ((currentKind == Token::operatorToken) &&
+      (currentOp == Token::closeParenOp))
     Error::unexpectedCloseParen();
 
   int defaultParams;
@@ -1176,8 +1834,8 @@ DatumP Parser::parseCommand(bool isVararg) {
   // isVararg: read all parameters until ')'
   if (isVararg) {
     while ((currentToken != nothing) &&
-           ((!currentToken.isWord()) ||
-            (currentToken.wordValue()->printValue() != ")"))) {
+           ((currentKind != Token::operatorToken) ||
+            (currentOp != Token::closeParenOp))) {
       DatumP child;
       if (minParams < 0) {
         child = currentToken;
@@ -1218,37 +1876,142 @@ DatumP Parser::parseCommand(bool isVararg) {
   if ((countOfChildren > maxParams) && (maxParams > -1))
     Error::tooMany(node.astnodeValue()->nodeName);
 
-  return node;
+  return foldConstants(node);
+}
+
+// Returns true if the literal d is a number, and sets value to it.
+static bool isNumberLiteral(const DatumP &d, double &value) {
+  if (!d.isWord())
+    return false;
+  value = d.wordValue()->numberValue();
+  return d.wordValue()->didNumberConversionSucceed();
+}
+
+// Returns true if method always gives the same output for these inputs,
+// the output can't be changed, it has no side effects, and it won't raise an
+// error.
+static bool isFoldable(KernelMethod method, const QVector<DatumP> &inputs) {
+  int count = inputs.size();
+  QVector<double> numbers(count);
+  bool areNumbers = true;
+  for (int i = 0; i < count; ++i) {
+    if (!isNumberLiteral(inputs[i], numbers[i]))
+      areNumbers = false;
+  }
+
+  if ((method == &Kernel::excSum) || (method == &Kernel::excProduct) ||
+      (method == &Kernel::excDifference) || (method == &Kernel::excMinus) ||
+      (method == &Kernel::excLessp) || (method == &Kernel::excGreaterp) ||
+      (method == &Kernel::excLessequalp) ||
+      (method == &Kernel::excGreaterequalp) || (method == &Kernel::excSin) ||
+      (method == &Kernel::excCos))
+    return areNumbers;
+
+  // Comparing words depends on CASEIGNOREDP, so only numbers are folded.
+  if ((method == &Kernel::excEqualp) || (method == &Kernel::excNotequal))
+    return areNumbers;
+
+  if (method == &Kernel::excQuotient)
+    return areNumbers && (numbers[count - 1] != 0);
+
+  if (method == &Kernel::excRemainder)
+    return areNumbers && (numbers[0] == floor(numbers[0])) &&
+           (numbers[1] == floor(numbers[1])) && (numbers[1] != 0);
+
+  if (method == &Kernel::excSqrt)
+    return areNumbers && (numbers[0] >= 0);
+
+  if (method == &Kernel::excWord) {
+    for (auto &input : inputs) {
+      if (!input.isWord())
+        return false;
+    }
+    return true;
+  }
+
+  // LIST is never folded. Each call must output a new list, since its caller
+  // may change it with .SETFIRST, .SETITEM, or .SETBF.
+  return false;
+}
+
+// If nodeP is a pure primitive whose inputs are all literals, evaluate it now
+// and return a literal node with the result. Otherwise return nodeP.
+DatumP Parser::foldConstants(DatumP nodeP) {
+  ASTNode *node = nodeP.astnodeValue();
+  QVector<DatumP> inputs;
+  for (int i = 0; i < node->countOfChildren(); ++i) {
+    DatumP childP = node->childAtIndex(i);
+    if ((childP.isa() != Datum::astnodeType) ||
+        (childP.astnodeValue()->kernel != &Kernel::executeLiteral))
+      return nodeP;
+    inputs.push_back(childP.astnodeValue()->childAtIndex(0));
+  }
+  if (!isFoldable(node->kernel, inputs))
+    return nodeP;
+
+  // A traced or stepped primitive must still run every time. Record the name
+  // so that tracing it later discards this AST.
+  Symbol name = node->nodeName.wordValue()->symbolValue();
+  if (astDependencies != NULL)
+    astDependencies->insert(name, generationOfName(name));
+  if (isTraced(name) || isStepped(name))
+    return nodeP;
+
+  KernelMethod method = node->kernel;
+  DatumP value = (kernel->*method)(nodeP);
+
+  DatumP retval(new ASTNode(node->nodeName));
+  retval.astnodeValue()->kernel = &Kernel::executeLiteral;
+  retval.astnodeValue()->addChild(value);
+  return retval;
 }
 
 void Parser::advanceToken() {
-  if (listIter.elementExists()) {
-    currentToken = listIter.element();
+  if (tokenIndex < runparseTokens.size()) {
+    const Token &token = runparseTokens[tokenIndex];
+    currentToken = token.datum;
+    currentKind = token.kind;
+    currentOp = token.op;
+    ++tokenIndex;
   } else {
     currentToken = nothing;
+    currentKind = Token::noToken;
+    currentOp = Token::noOperator;
   }
 }
 
+const Cmd_t *Parser::primitiveForSymbol(Symbol procsymbol) {
+  if (procsymbol == noSymbol)
+    return NULL;
+  auto iter = primitiveAlternateNames.find(procsymbol);
+  if (iter != primitiveAlternateNames.end())
+    return &*iter;
+  return primitivesBySymbol.value(procsymbol);
+}
+
+// The queries below don't create a Symbol for the name. A name without one
+// can't have a definition.
 bool Parser::isProcedure(QString procname) {
-  return (primitiveAlternateNames.contains(procname) ||
-          stringToCmd.contains(procname) || procedures.contains(procname));
+  Symbol procsymbol = findSymbol(procname);
+  return (procedures.contains(procsymbol) ||
+          (primitiveForSymbol(procsymbol) != NULL));
 }
 
 bool Parser::isMacro(QString procname) {
-  if (procedures.contains(procname)) {
-    DatumP procedure = procedures[procname];
+  Symbol procsymbol = findSymbol(procname);
+  if (procedures.contains(procsymbol)) {
+    DatumP procedure = procedures[procsymbol];
     return procedure.procedureValue()->isMacro;
   }
   return false;
 }
 
 bool Parser::isPrimitive(QString procname) {
-  return (primitiveAlternateNames.contains(procname) ||
-          stringToCmd.contains(procname));
+  return (primitiveForSymbol(findSymbol(procname)) != NULL);
 }
 
 bool Parser::isDefined(QString procname) {
-  return (procedures.contains(procname));
+  return (procedures.contains(findSymbol(procname)));
 }
 
 DatumP Parser::allProcedureNames(showContents_t showWhat) {
@@ -1257,7 +2020,7 @@ DatumP Parser::allProcedureNames(showContents_t showWhat) {
   for (auto &name : procedures.keys()) {
 
     if (shouldInclude(showWhat, name))
-      retval->append(DatumP(new Word(name)));
+      retval->append(DatumP(new Word(keyForSymbol(name))));
   }
   return DatumP(retval);
 }
@@ -1265,7 +2028,7 @@ DatumP Parser::allProcedureNames(showContents_t showWhat) {
 void Parser::eraseAllProcedures() {
   for (auto &iter : procedures.keys()) {
     if (!isBuried(iter)) {
-      procedures.remove(iter);
+      setProcedure(iter, nothing);
     }
   }
 }
@@ -1273,29 +2036,25 @@ void Parser::eraseAllProcedures() {
 DatumP Parser::allPrimitiveProcedureNames() {
   List *retval = new List;
 
-  for (auto name : stringToCmd.keys()) {
-    retval->append(DatumP(new Word(name)));
+  for (auto &entry : primitiveTable) {
+    retval->append(DatumP(new Word(entry.name)));
   }
   return DatumP(retval);
 }
 
 DatumP Parser::arity(DatumP nameP) {
   int minParams, defParams, maxParams;
-  QString procname = nameP.wordValue()->keyValue();
+  Symbol procsymbol = nameP.wordValue()->existingSymbolValue();
 
-  if (procedures.contains(procname)) {
-    DatumP command = procedures[procname];
+  if (procedures.contains(procsymbol)) {
+    DatumP command = procedures[procsymbol];
     minParams = command.procedureValue()->countOfMinParams;
     defParams = command.procedureValue()->defaultNumber;
     maxParams = command.procedureValue()->countOfMaxParams;
-  } else if (primitiveAlternateNames.contains(procname) ||
-             stringToCmd.contains(procname)) {
-    Cmd_t command = primitiveAlternateNames.contains(procname)
-                        ? primitiveAlternateNames[procname]
-                        : stringToCmd[procname];
-    minParams = command.countOfMinParams;
-    defParams = command.countOfDefaultParams;
-    maxParams = command.countOfMaxParams;
+  } else if (const Cmd_t *command = primitiveForSymbol(procsymbol)) {
+    minParams = command->countOfMinParams;
+    defParams = command->countOfDefaultParams;
+    maxParams = command->countOfMaxParams;
   } else {
     Error::noHow(nameP);
     return nothing;
@@ -1408,400 +2167,31 @@ QString Parser::printoutDatum(DatumP aDatum) {
 }
 
 Parser::Parser(Kernel *aKernel) {
-  lastProcedureCreatedTimestamp = QDateTime::currentMSecsSinceEpoch();
+  procedureGeneration = 1;
   kernel = aKernel;
+  currentKind = Token::noToken;
+  currentOp = Token::noOperator;
+  tokenIndex = 0;
   listSourceText = new List;
-  if (stringToCmd.size() > 0)
-    return;
 
-  // DATA STRUCTURE PRIMITIVES (MIN, default, MAX)
-  // (MIN = -1)     = All parameters are read as list, e.g. "TO PROC :p1"
-  // becomes ["TO", "PROC", ":p1"] (default = -1) = All parameters are consumed
-  // until end of line (MAX = -1)     = All parameters are consumed within
-  // parens
-  stringToCmd["SAVE"] = {&Kernel::excShow, 0, -1, 1};
-
-  stringToCmd["WORD"] = {&Kernel::excWord, 0, 2, -1};
-  stringToCmd["LIST"] = {&Kernel::excList, 0, 2, -1};
-  stringToCmd["SENTENCE"] = {&Kernel::excSentence, 0, 2, -1};
-  stringToCmd["SE"] = stringToCmd["SENTENCE"];
-  stringToCmd["FPUT"] = {&Kernel::excFput, 2, 2, 2};
-  stringToCmd["LPUT"] = {&Kernel::excLput, 2, 2, 2};
-  stringToCmd["ARRAY"] = {&Kernel::excArray, 1, 1, 2};
-  stringToCmd["LISTTOARRAY"] = {&Kernel::excListtoarray, 1, 1, 2};
-  stringToCmd["ARRAYTOLIST"] = {&Kernel::excArraytolist, 1, 1, 1};
-  stringToCmd["READLIST"] = {&Kernel::excReadlist, 0, 0, 0};
-  stringToCmd["RL"] = stringToCmd["READLIST"];
-  stringToCmd["READWORD"] = {&Kernel::excReadword, 0, 0, 0};
-  stringToCmd["RW"] = stringToCmd["READWORD"];
-  stringToCmd["READRAWLINE"] = {&Kernel::excReadrawline, 0, 0, 0};
-  stringToCmd["READCHAR"] = {&Kernel::excReadchar, 0, 0, 0};
-  stringToCmd["RC"] = stringToCmd["READCHAR"];
-  stringToCmd["READCHARS"] = {&Kernel::excReadchars, 1, 1, 1};
-  stringToCmd["RCS"] = stringToCmd["READCHARS"];
-  stringToCmd["SHELL"] = {&Kernel::excShell, 1, 1, 2};
-
-  stringToCmd["SETPREFIX"] = {&Kernel::excSetprefix, 1, 1, 1};
-  stringToCmd["PREFIX"] = {&Kernel::excPrefix, 0, 0, 0};
-  stringToCmd["OPENREAD"] = {&Kernel::excOpenread, 1, 1, 1};
-  stringToCmd["OPENWRITE"] = {&Kernel::excOpenwrite, 1, 1, 1};
-  stringToCmd["OPENAPPEND"] = {&Kernel::excOpenappend, 1, 1, 1};
-  stringToCmd["OPENUPDATE"] = {&Kernel::excOpenupdate, 1, 1, 1};
-  stringToCmd["ALLOPEN"] = {&Kernel::excAllopen, 0, 0, 0};
-  stringToCmd["SETREAD"] = {&Kernel::excSetread, 1, 1, 1};
-  stringToCmd["SETWRITE"] = {&Kernel::excSetwrite, 1, 1, 1};
-  stringToCmd["READER"] = {&Kernel::excReader, 0, 0, 0};
-  stringToCmd["WRITER"] = {&Kernel::excWriter, 0, 0, 0};
-  stringToCmd["READPOS"] = {&Kernel::excReadpos, 0, 0, 0};
-  stringToCmd["WRITEPOS"] = {&Kernel::excWritepos, 0, 0, 0};
-  stringToCmd["SETREADPOS"] = {&Kernel::excSetreadpos, 1, 1, 1};
-  stringToCmd["SETWRITEPOS"] = {&Kernel::excSetwritepos, 1, 1, 1};
-  stringToCmd["EOFP"] = {&Kernel::excEofp, 0, 0, 0};
-  stringToCmd["EOF?"] = stringToCmd["EOFP"];
-  stringToCmd["KEYP"] = {&Kernel::excKeyp, 0, 0, 0};
-  stringToCmd["KEY?"] = stringToCmd["KEYP"];
-  stringToCmd["DRIBBLE"] = {&Kernel::excDribble, 1, 1, 1};
-  stringToCmd["NODRIBBLE"] = {&Kernel::excNodribble, 0, 0, 0};
-
-  stringToCmd["CLEARTEXT"] = {&Kernel::excCleartext, 0, 0, 0};
-  stringToCmd["CT"] = stringToCmd["CLEARTEXT"];
-  stringToCmd["CURSORINSERT"] = {&Kernel::excCursorInsert, 0, 0, 0};
-  stringToCmd["CURSOROVERWRITE"] = {&Kernel::excCursorOverwrite, 0, 0, 0};
-  stringToCmd["CURSORMODE"] = {&Kernel::excCursorMode, 0, 0, 0};
-
-  stringToCmd["CLOSE"] = {&Kernel::excClose, 1, 1, 1};
-  stringToCmd["CLOSEALL"] = {&Kernel::excCloseall, 0, 0, 0};
-  stringToCmd["ERASEFILE"] = {&Kernel::excErasefile, 1, 1, 1};
-  stringToCmd["ERF"] = stringToCmd["ERASEFILE"];
-
-  stringToCmd["FIRST"] = {&Kernel::excFirst, 1, 1, 1};
-  stringToCmd["LAST"] = {&Kernel::excLast, 1, 1, 1};
-  stringToCmd["BUTFIRST"] = {&Kernel::excButfirst, 1, 1, 1};
-  stringToCmd["BF"] = stringToCmd["BUTFIRST"];
-  stringToCmd["FIRSTS"] = {&Kernel::excFirsts, 1, 1, 1};
-  stringToCmd["BUTFIRSTS"] = {&Kernel::excButfirsts, 1, 1, 1};
-  stringToCmd["BFS"] = stringToCmd["BUTFIRSTS"];
-  stringToCmd["BUTLAST"] = {&Kernel::excButlast, 1, 1, 1};
-  stringToCmd["BL"] = stringToCmd["BUTLAST"];
-  stringToCmd["ITEM"] = {&Kernel::excItem, 2, 2, 2};
-
-  stringToCmd["SETITEM"] = {&Kernel::excSetitem, 3, 3, 3};
-  stringToCmd[".SETFIRST"] = {&Kernel::excDotSetfirst, 2, 2, 2};
-  stringToCmd[".SETBF"] = {&Kernel::excDotSetbf, 2, 2, 2};
-  stringToCmd[".SETITEM"] = {&Kernel::excDotSetitem, 3, 3, 3};
-
-  stringToCmd["WORDP"] = {&Kernel::excWordp, 1, 1, 1};
-  stringToCmd["WORD?"] = stringToCmd["WORDP"];
-  stringToCmd["LISTP"] = {&Kernel::excListp, 1, 1, 1};
-  stringToCmd["LIST?"] = stringToCmd["LISTP"];
-  stringToCmd["ARRAYP"] = {&Kernel::excArrayp, 1, 1, 1};
-  stringToCmd["ARRAY?"] = stringToCmd["ARRAYP"];
-  stringToCmd["EMPTYP"] = {&Kernel::excEmptyp, 1, 1, 1};
-  stringToCmd["EMPTY?"] = stringToCmd["EMPTYP"];
-  stringToCmd["EQUALP"] = {&Kernel::excEqualp, 2, 2, 2};
-  stringToCmd["EQUAL?"] = stringToCmd["EQUALP"];
-  stringToCmd["NOTEQUALP"] = {&Kernel::excNotequal, 2, 2, 2};
-  stringToCmd["NOTEQUAL?"] = stringToCmd["NOTEQUALP"];
-  stringToCmd["BEFOREP"] = {&Kernel::excBeforep, 2, 2, 2};
-  stringToCmd["BEFORE?"] = stringToCmd["BEFOREP"];
-  stringToCmd[".EQ"] = {&Kernel::excDotEq, 2, 2, 2};
-  stringToCmd["MEMBERP"] = {&Kernel::excMemberp, 2, 2, 2};
-  stringToCmd["MEMBER?"] = stringToCmd["MEMBERP"];
-  stringToCmd["SUBSTRINGP"] = {&Kernel::excSubstringp, 2, 2, 2};
-  stringToCmd["SUBSTRING?"] = stringToCmd["SUBSTRINGP"];
-  stringToCmd["NUMBERP"] = {&Kernel::excNumberp, 1, 1, 1};
-  stringToCmd["NUMBER?"] = stringToCmd["NUMBERP"];
-  stringToCmd["VBARREDP"] = {&Kernel::excVbarredp, 1, 1, 1};
-  stringToCmd["VBARRED?"] = stringToCmd["VBARREDP"];
-
-  stringToCmd["COUNT"] = {&Kernel::excCount, 1, 1, 1};
-  stringToCmd["ASCII"] = {&Kernel::excAscii, 1, 1, 1};
-  stringToCmd["RAWASCII"] = {&Kernel::excRawascii, 1, 1, 1};
-  stringToCmd["CHAR"] = {&Kernel::excChar, 1, 1, 1};
-  stringToCmd["MEMBER"] = {&Kernel::excMember, 2, 2, 2};
-  stringToCmd["LOWERCASE"] = {&Kernel::excLowercase, 1, 1, 1};
-  stringToCmd["UPPERCASE"] = {&Kernel::excUppercase, 1, 1, 1};
-  stringToCmd["STANDOUT"] = {&Kernel::excStandout, 1, 1, 1};
-  stringToCmd["PARSE"] = {&Kernel::excParse, 1, 1, 1};
-  stringToCmd["RUNPARSE"] = {&Kernel::excRunparse, 1, 1, 1};
-
-  stringToCmd["MINUS"] = {&Kernel::excMinus, 1, 1, 1};
-  stringToCmd["-"] = {&Kernel::excMinus, 1, 1, 1};
-  stringToCmd["--"] = stringToCmd["-"];
-
-  stringToCmd["PRINT"] = {&Kernel::excPrint, 0, 1, -1};
-  stringToCmd["PR"] = stringToCmd["PRINT"];
-  stringToCmd["TYPE"] = {&Kernel::excType, 0, 1, -1};
-  stringToCmd["SHOW"] = {&Kernel::excShow, 0, 1, -1};
-  stringToCmd["MAKE"] = {&Kernel::excMake, 2, 2, 2};
-  stringToCmd["REPEAT"] = {&Kernel::excRepeat, 2, 2, 2};
-  stringToCmd["SQRT"] = {&Kernel::excSqrt, 1, 1, 1};
-  stringToCmd["RANDOM"] = {&Kernel::excRandom, 1, 1, 2};
-  stringToCmd["RERANDOM"] = {&Kernel::excRerandom, 0, 0, 1};
-  stringToCmd["THING"] = {&Kernel::excThing, 1, 1, 1};
-  stringToCmd["WAIT"] = {&Kernel::excWait, 1, 1, 1};
-  stringToCmd["SETCURSOR"] = {&Kernel::excSetcursor, 1, 1, 1};
-  stringToCmd["CURSOR"] = {&Kernel::excCursor, 0, 0, 0};
-  stringToCmd["SETTEXTCOLOR"] = {&Kernel::excSettextcolor, 1, 2, 2};
-  stringToCmd["SETTC"] = stringToCmd["SETTEXTCOLOR"];
-  stringToCmd["SETTEXTSIZE"] = {&Kernel::excSettextsize, 1, 1, 1};
-  stringToCmd["INCREASEFONT"] = {&Kernel::excIncreasefont, 0, 0, 0};
-  stringToCmd["DECREASEFONT"] = {&Kernel::excDecreasefont, 0, 0, 0};
-  stringToCmd["SETTEXTSIZE"] = {&Kernel::excSettextsize, 1, 1, 1};
-  stringToCmd["TEXTSIZE"] = {&Kernel::excTextsize, 0, 0, 0};
-  stringToCmd["SETFONT"] = {&Kernel::excSetfont, 1, 1, 1};
-  stringToCmd["FONT"] = {&Kernel::excFont, 0, 0, 0};
-  stringToCmd["ALLFONTS"] = {&Kernel::excAllfonts, 0, 0, 0};
-
-  stringToCmd["FORWARD"] = {&Kernel::excForward, 1, 1, 1};
-  stringToCmd["FD"] = stringToCmd["FORWARD"];
-  stringToCmd["BACK"] = {&Kernel::excBack, 1, 1, 1};
-  stringToCmd["BK"] = stringToCmd["BACK"];
-  stringToCmd["RIGHT"] = {&Kernel::excRight, 1, 1, 1};
-  stringToCmd["RT"] = stringToCmd["RIGHT"];
-  stringToCmd["LEFT"] = {&Kernel::excLeft, 1, 1, 1};
-  stringToCmd["LT"] = stringToCmd["LEFT"];
-  stringToCmd["CLEARSCREEN"] = {&Kernel::excClearscreen, 0, 0, 0};
-  stringToCmd["CS"] = stringToCmd["CLEARSCREEN"];
-  stringToCmd["CLEAN"] = {&Kernel::excClean, 0, 0, 0};
-  stringToCmd["PENUP"] = {&Kernel::excPenup, 0, 0, 0};
-  stringToCmd["PU"] = stringToCmd["PENUP"];
-  stringToCmd["PENDOWN"] = {&Kernel::excPendown, 0, 0, 0};
-  stringToCmd["PD"] = stringToCmd["PENDOWN"];
-  stringToCmd["PENDOWNP"] = {&Kernel::excPendownp, 0, 0, 0};
-  stringToCmd["PENDOWN?"] = stringToCmd["PENDOWNP"];
-  stringToCmd["HIDETURTLE"] = {&Kernel::excHideturtle, 0, 0, 0};
-  stringToCmd["HT"] = stringToCmd["HIDETURTLE"];
-  stringToCmd["SHOWTURTLE"] = {&Kernel::excShowturtle, 0, 0, 0};
-  stringToCmd["ST"] = stringToCmd["SHOWTURTLE"];
-  // stringToCmd["SETXYZ"]         = {&Kernel::excSetXYZ, 3,3,3};
-  stringToCmd["SETXY"] = {&Kernel::excSetXY, 2, 2, 2};
-  stringToCmd["SETX"] = {&Kernel::excSetX, 1, 1, 1};
-  stringToCmd["SETY"] = {&Kernel::excSetY, 1, 1, 1};
-  // stringToCmd["SETZ"]           = {&Kernel::excSetZ, 1,1,1};
-  stringToCmd["SETPOS"] = {&Kernel::excSetpos, 1, 1, 1};
-  stringToCmd["POS"] = {&Kernel::excPos, 0, 0, 1};
-  stringToCmd["HOME"] = {&Kernel::excHome, 0, 0, 0};
-  stringToCmd["HEADING"] = {&Kernel::excHeading, 0, 0, 1};
-  stringToCmd["SETHEADING"] = {&Kernel::excSetheading, 1, 1, 2};
-  stringToCmd["SETH"] = stringToCmd["SETHEADING"];
-  stringToCmd["ARC"] = {&Kernel::excArc, 2, 2, 2};
-  stringToCmd["TOWARDS"] = {&Kernel::excTowards, 1, 1, 1};
-  stringToCmd["SCRUNCH"] = {&Kernel::excScrunch, 0, 0, 0};
-  stringToCmd["SETSCRUNCH"] = {&Kernel::excSetscrunch, 2, 2, 2};
-  stringToCmd["LABEL"] = {&Kernel::excLabel, 1, 1, 1};
-  stringToCmd["LABELHEIGHT"] = {&Kernel::excLabelheight, 0, 0, 0};
-  stringToCmd["SETLABELHEIGHT"] = {&Kernel::excSetlabelheight, 1, 1, 1};
-  stringToCmd["SHOWNP"] = {&Kernel::excShownp, 0, 0, 0};
-  stringToCmd["SHOWN?"] = stringToCmd["SHOWNP"];
-  stringToCmd["SETPENCOLOR"] = {&Kernel::excSetpencolor, 1, 1, 1};
-  stringToCmd["SETPC"] = stringToCmd["SETPENCOLOR"];
-  stringToCmd["PENCOLOR"] = {&Kernel::excPencolor, 0, 0, 0};
-  stringToCmd["PC"] = stringToCmd["PENCOLOR"];
-  stringToCmd["SETPALETTE"] = {&Kernel::excSetpalette, 2, 2, 2};
-  stringToCmd["PALETTE"] = {&Kernel::excPalette, 1, 1, 1};
-  stringToCmd["BACKGROUND"] = {&Kernel::excBackground, 0, 0, 0};
-  stringToCmd["BG"] = stringToCmd["BACKGROUND"];
-  stringToCmd["SETBACKGROUND"] = {&Kernel::excSetbackground, 1, 1, 1};
-  stringToCmd["SETBG"] = stringToCmd["SETBACKGROUND"];
-  stringToCmd["SAVEPICT"] = {&Kernel::excSavepict, 1, 1, 1};
-
-  stringToCmd["PENPAINT"] = {&Kernel::excPenpaint, 0, 0, 0};
-  stringToCmd["PPT"] = stringToCmd["PENPAINT"];
-  stringToCmd["PENERASE"] = {&Kernel::excPenerase, 0, 0, 0};
-  stringToCmd["PE"] = stringToCmd["PENERASE"];
-  stringToCmd["PENREVERSE"] = {&Kernel::excPenreverse, 0, 0, 0};
-  stringToCmd["PX"] = stringToCmd["PENREVERSE"];
-  stringToCmd["PENMODE"] = {&Kernel::excPenmode, 0, 0, 0};
-  stringToCmd["SETPENSIZE"] = {&Kernel::excSetpensize, 1, 1, 1};
-  stringToCmd["PENSIZE"] = {&Kernel::excPensize, 0, 0, 0};
-  stringToCmd["FILLED"] = {&Kernel::excFilled, 2, 2, 2};
-
-  stringToCmd["WRAP"] = {&Kernel::excWrap, 0, 0, 0};
-  stringToCmd["FENCE"] = {&Kernel::excFence, 0, 0, 0};
-  stringToCmd["WINDOW"] = {&Kernel::excWindow, 0, 0, 0};
-  stringToCmd["TURTLEMODE"] = {&Kernel::excTurtlemode, 0, 0, 0};
-
-  stringToCmd["MOUSEPOS"] = {&Kernel::excMousepos, 0, 0, 0};
-  stringToCmd["CLICKPOS"] = {&Kernel::excClickpos, 0, 0, 0};
-  stringToCmd["BOUNDS"] = {&Kernel::excBounds, 0, 0, 0};
-  stringToCmd["SETBOUNDS"] = {&Kernel::excSetbounds, 2, 2, 2};
-
-  stringToCmd["TEXTSCREEN"] = {&Kernel::excTextscreen, 0, 0, 0};
-  stringToCmd["TS"] = stringToCmd["TEXTSCREEN"];
-  stringToCmd["FULLSCREEN"] = {&Kernel::excFullscreen, 0, 0, 0};
-  stringToCmd["FS"] = stringToCmd["FULLSCREEN"];
-  stringToCmd["SPLITSCREEN"] = {&Kernel::excSplitscreen, 0, 0, 0};
-  stringToCmd["SS"] = stringToCmd["SPLITSCREEN"];
-  stringToCmd["SCREENMODE"] = {&Kernel::excScreenmode, 0, 0, 0};
-
-  stringToCmd["BUTTONP"] = {&Kernel::excButtonp, 0, 0, 0};
-  stringToCmd["BUTTON?"] = stringToCmd["BUTTONP"];
-  stringToCmd["BUTTON"] = {&Kernel::excButton, 0, 0, 0};
-
-  stringToCmd["MATRIX"] = {&Kernel::excMatrix, 0, 0, 0}; // for debugging
-
-  stringToCmd["SUM"] = {&Kernel::excSum, 0, 2, -1};
-  stringToCmd["DIFFERENCE"] = {&Kernel::excDifference, 2, 2, 2};
-  stringToCmd["PRODUCT"] = {&Kernel::excProduct, 0, 2, -1};
-  stringToCmd["QUOTIENT"] = {&Kernel::excQuotient, 1, 2, 2};
-  stringToCmd["REMAINDER"] = {&Kernel::excRemainder, 2, 2, 2};
-  stringToCmd["MODULO"] = {&Kernel::excModulo, 2, 2, 2};
-  stringToCmd["INT"] = {&Kernel::excInt, 1, 1, 1};
-  stringToCmd["EXP"] = {&Kernel::excExp, 1, 1, 1};
-  stringToCmd["LOG10"] = {&Kernel::excLog10, 1, 1, 1};
-  stringToCmd["LN"] = {&Kernel::excLn, 1, 1, 1};
-  stringToCmd["SIN"] = {&Kernel::excSin, 1, 1, 1};
-  stringToCmd["RADSIN"] = {&Kernel::excRadsin, 1, 1, 1};
-  stringToCmd["COS"] = {&Kernel::excCos, 1, 1, 1};
-  stringToCmd["RADCOS"] = {&Kernel::excRadcos, 1, 1, 1};
-  stringToCmd["ARCTAN"] = {&Kernel::excArctan, 1, 1, 2};
-  stringToCmd["RADARCTAN"] = {&Kernel::excRadarctan, 1, 1, 2};
-  stringToCmd["ROUND"] = {&Kernel::excRound, 1, 1, 1};
-  stringToCmd["POWER"] = {&Kernel::excPower, 2, 2, 2};
-  stringToCmd["BITAND"] = {&Kernel::excBitand, 0, 2, -1};
-  stringToCmd["BITOR"] = {&Kernel::excBitor, 0, 2, -1};
-  stringToCmd["BITXOR"] = {&Kernel::excBitxor, 0, 2, -1};
-  stringToCmd["BITNOT"] = {&Kernel::excBitnot, 1, 1, 1};
-  stringToCmd["ASHIFT"] = {&Kernel::excAshift, 2, 2, 2};
-  stringToCmd["LSHIFT"] = {&Kernel::excLshift, 2, 2, 2};
-  stringToCmd["AND"] = {&Kernel::excAnd, 0, 2, -1};
-  stringToCmd["OR"] = {&Kernel::excOr, 0, 2, -1};
-  stringToCmd["NOT"] = {&Kernel::excNot, 1, 1, 1};
-
-  stringToCmd["FORM"] = {&Kernel::excForm, 3, 3, 3};
-
-  stringToCmd["LESSP"] = {&Kernel::excLessp, 2, 2, 2};
-  stringToCmd["LESS?"] = stringToCmd["LESSP"];
-  stringToCmd["GREATERP"] = {&Kernel::excGreaterp, 2, 2, 2};
-  stringToCmd["GREATER?"] = stringToCmd["GREATERP"];
-  stringToCmd["LESSEQUALP"] = {&Kernel::excLessequalp, 2, 2, 2};
-  stringToCmd["LESSEQUAL?"] = stringToCmd["LESSEQUALP"];
-  stringToCmd["GREATEREQUALP"] = {&Kernel::excGreaterequalp, 2, 2, 2};
-  stringToCmd["GREATEREQUAL?"] = stringToCmd["GREATEREQUALP"];
-
-  stringToCmd["DEFINE"] = {&Kernel::excDefine, 2, 2, 2};
-  stringToCmd["TEXT"] = {&Kernel::excText, 1, 1, 1};
-  stringToCmd["FULLTEXT"] = {&Kernel::excFulltext, 1, 1, 1};
-  stringToCmd["COPYDEF"] = {&Kernel::excCopydef, 2, 2, 2};
-  stringToCmd["LOCAL"] = {&Kernel::excLocal, 1, 1, -1};
-  stringToCmd["GLOBAL"] = {&Kernel::excGlobal, 1, 1, -1};
-
-  stringToCmd["PPROP"] = {&Kernel::excPprop, 3, 3, 3};
-  stringToCmd["GPROP"] = {&Kernel::excGprop, 2, 2, 2};
-  stringToCmd["REMPROP"] = {&Kernel::excRemprop, 2, 2, 2};
-  stringToCmd["PLIST"] = {&Kernel::excPlist, 1, 1, 1};
-
-  stringToCmd["PROCEDUREP"] = {&Kernel::excProcedurep, 1, 1, 1};
-  stringToCmd["PROCEDURE?"] = stringToCmd["PROCEDUREP"];
-  stringToCmd["PRIMITIVEP"] = {&Kernel::excPrimitivep, 1, 1, 1};
-  stringToCmd["PRIMITIVE?"] = stringToCmd["PRIMITIVEP"];
-  stringToCmd["DEFINEDP"] = {&Kernel::excDefinedp, 1, 1, 1};
-  stringToCmd["DEFINED?"] = stringToCmd["DEFINEDP"];
-  stringToCmd["NAMEP"] = {&Kernel::excNamep, 1, 1, 1};
-  stringToCmd["NAME?"] = stringToCmd["NAMEP"];
-  stringToCmd["PLISTP"] = {&Kernel::excPlistp, 1, 1, 1};
-  stringToCmd["PLIST?"] = stringToCmd["PLISTP"];
-
-  stringToCmd["CONTENTS"] = {&Kernel::excContents, 0, 0, 0};
-  stringToCmd["BURIED"] = {&Kernel::excBuried, 0, 0, 0};
-  stringToCmd["TRACED"] = {&Kernel::excTraced, 0, 0, 0};
-  stringToCmd["STEPPED"] = {&Kernel::excStepped, 0, 0, 0};
-  stringToCmd["PROCEDURES"] = {&Kernel::excProcedures, 0, 0, 0};
-  stringToCmd["PRIMITIVES"] = {&Kernel::excPrimitives, 0, 0, 0};
-  stringToCmd["NAMES"] = {&Kernel::excNames, 0, 0, 0};
-  stringToCmd["PLISTS"] = {&Kernel::excPlists, 0, 0, 0};
-  stringToCmd["ARITY"] = {&Kernel::excArity, 1, 1, 1};
-  stringToCmd["NODES"] = {&Kernel::excNodes, 0, 0, 0};
-
-  stringToCmd["PRINTOUT"] = {&Kernel::excPrintout, 1, 1, 1};
-  stringToCmd["PO"] = stringToCmd["PRINTOUT"];
-  stringToCmd["POT"] = {&Kernel::excPot, 1, 1, 1};
-
-  stringToCmd["ERASE"] = {&Kernel::excErase, 1, 1, 1};
-  stringToCmd["ER"] = stringToCmd["ERASE"];
-  stringToCmd["ERALL"] = {&Kernel::excErall, 0, 0, 0};
-  stringToCmd["ERPS"] = {&Kernel::excErps, 0, 0, 0};
-  stringToCmd["ERNS"] = {&Kernel::excErns, 0, 0, 0};
-  stringToCmd["ERPLS"] = {&Kernel::excErpls, 0, 0, 0};
-  stringToCmd["BURY"] = {&Kernel::excBury, 1, 1, 1};
-  stringToCmd["UNBURY"] = {&Kernel::excUnbury, 1, 1, 1};
-  stringToCmd["BURIEDP"] = {&Kernel::excBuriedp, 1, 1, 1};
-  stringToCmd["BURIED?"] = stringToCmd["BURIEDP"];
-  stringToCmd["TRACE"] = {&Kernel::excTrace, 1, 1, 1};
-  stringToCmd["UNTRACE"] = {&Kernel::excUntrace, 1, 1, 1};
-  stringToCmd["TRACEDP"] = {&Kernel::excTracedp, 1, 1, 1};
-  stringToCmd["TRACED?"] = stringToCmd["TRACEDP"];
-  stringToCmd["STEP"] = {&Kernel::excStep, 1, 1, 1};
-  stringToCmd["UNSTEP"] = {&Kernel::excUnstep, 1, 1, 1};
-  stringToCmd["STEPPEDP"] = {&Kernel::excSteppedp, 1, 1, 1};
-  stringToCmd["STEPPED?"] = stringToCmd["STEPPEDP"];
-  stringToCmd["EDIT"] = {&Kernel::excEdit, 0, -1, 1};
-  stringToCmd["ED"] = stringToCmd["EDIT"];
-  stringToCmd["EDITFILE"] = {&Kernel::excEditfile, 1, 1, 1};
-  stringToCmd["SAVE"] = {&Kernel::excSave, 0, -1, 1};
-  stringToCmd["LOAD"] = {&Kernel::excLoad, 1, 1, 1};
-  stringToCmd["HELP"] = {&Kernel::excHelp, 0, -1, 1};
-
-  // CONTROL STRUCTURES
-
-  stringToCmd["RUN"] = {&Kernel::excRun, 1, 1, 1};
-  stringToCmd["RUNRESULT"] = {&Kernel::excRunresult, 1, 1, 1};
-  stringToCmd["FOREVER"] = {&Kernel::excForever, 1, 1, 1};
-  stringToCmd["REPCOUNT"] = {&Kernel::excRepcount, 0, 0, 0};
-  stringToCmd["IF"] = {&Kernel::excIf, 2, 2, 2};
-  stringToCmd["IFELSE"] = {&Kernel::excIfelse, 3, 3, 3};
-  stringToCmd["TEST"] = {&Kernel::excTest, 1, 1, 1};
-  stringToCmd["IFTRUE"] = {&Kernel::excIftrue, 1, 1, 1};
-  stringToCmd["IFT"] = stringToCmd["IFTRUE"];
-  stringToCmd["IFFALSE"] = {&Kernel::excIffalse, 1, 1, 1};
-  stringToCmd["IFF"] = stringToCmd["IFFALSE"];
-  stringToCmd["STOP"] = {&Kernel::excStop, 0, 0, 0};
-  stringToCmd["OUTPUT"] = {&Kernel::excOutput, 1, 1, 1};
-  stringToCmd["OP"] = stringToCmd["OUTPUT"];
-  stringToCmd["CATCH"] = {&Kernel::excCatch, 2, 2, 2};
-  stringToCmd["THROW"] = {&Kernel::excThrow, 1, 1, 2};
-  stringToCmd["ERROR"] = {&Kernel::excError, 0, 0, 0};
-  stringToCmd["PAUSE"] = {&Kernel::excPause, 0, 0, 0};
-  stringToCmd["CONTINUE"] = {&Kernel::excContinue, 0, -1, 1};
-  stringToCmd["CO"] = stringToCmd["CONTINUE"];
-  stringToCmd["BYE"] = {&Kernel::excBye, 0, 0, 0};
-  stringToCmd[".MAYBEOUTPUT"] = {&Kernel::excDotMaybeoutput, 1, 1, 1};
-  stringToCmd["TAG"] = {&Kernel::excTag, 1, 1, 1};
-  stringToCmd["GOTO"] = {&Kernel::excGoto, 1, 1, 1};
-
-  stringToCmd["APPLY"] = {&Kernel::excApply, 2, 2, 2};
-  stringToCmd["?"] = {&Kernel::excNamedSlot, 0, 0, 1};
-
-  stringToCmd["TO"] = {&Kernel::excTo, -1, -1, -1};
-  stringToCmd[".MACRO"] = stringToCmd["TO"];
-  stringToCmd[".DEFMACRO"] = stringToCmd["DEFINE"];
-  stringToCmd["MACROP"] = {&Kernel::excMacrop, 1, 1, 1};
-  stringToCmd["MACRO?"] = stringToCmd["MACROP"];
-
-  stringToCmd["GC"] = {&Kernel::excNoop, 0, 0, -1};
-  stringToCmd[".SETSEGMENTSIZE"] = {&Kernel::excNoop, 1, 1, 1};
-  stringToCmd["SETPENPATTERN"] = {&Kernel::excNoop, 1, 1, 1};
-  stringToCmd["PENPATTERN"] = {&Kernel::excNoop, 1, 1, 1};
-  stringToCmd["REFRESH"] = {&Kernel::excNoop, 0, 0, 0};
-  stringToCmd["NOREFRESH"] = {&Kernel::excNoop, 0, 0, 0};
-
-  stringToCmd["+"] = stringToCmd["SUM"]; // {&Kernel::executeWrongUseOf, 0,0,0};
-  stringToCmd["*"] =
-      stringToCmd["PRODUCT"]; // {&Kernel::executeWrongUseOf, 0,0,0};
-  stringToCmd["/"] =
-      stringToCmd["QUOTIENT"]; // {&Kernel::executeWrongUseOf, 0,0,0};
-  stringToCmd[">"] =
-      stringToCmd["GREATERP"]; // {&Kernel::executeWrongUseOf, 0,0,0};
-  stringToCmd["<"] =
-      stringToCmd["LESSP"]; // {&Kernel::executeWrongUseOf, 0,0,0};
-  stringToCmd["="] =
-      stringToCmd["EQUALP"]; // {&Kernel::executeWronstringToCmd["PRODUCT"]; //
-                             // gUseOf, 0,0,0};
-  stringToCmd[">="] =
-      stringToCmd["GREATEREQUALP"]; // {&Kernel::executeWrongUseOf, 0,0,0};
-  stringToCmd["<="] =
-      stringToCmd["LESSEQUALP"]; // {&Kernel::executeWrongUseOf, 0,0,0};
-  stringToCmd["<>"] =
-      stringToCmd["NOTEQUALP"]; // {&Kernel::executeWrongUseOf, 0,0,0};
+  // primitiveForName() relies on the table being sorted.
+  for (int i = 1; i < countOfPrimitives; ++i) {
+    Q_ASSERT(compareWithName(primitiveTable[i].name,
+                             primitiveTable[i - 1].name) > 0);
+  }
+
+  // Give every primitive name a Symbol, so that a command finds its primitive
+  // without looking up its name.
+  for (auto &entry : primitiveTable) {
+    Symbol name = symbolForKey(entry.name);
+    if (name >= primitivesBySymbol.size())
+      primitivesBySymbol.resize(name + 1);
+    primitivesBySymbol[name] = &entry.cmd;
+  }
+}
+
+Parser::~Parser() {
+  for (auto cell : procedureCells) {
+    delete cell;
+  }
 }
@@ -35,6 +35,46 @@ class Parser;
 class Kernel;
 class QTextStream;
 
+/// \brief A member of a runparsed instruction list.
+///
+/// runparse classifies each member as it is produced, so that the expression
+/// parser can test the kind and operator of a token instead of comparing its
+/// text.
+struct Token {
+  enum Kind {
+    noToken,       // The end of the list
+    operatorToken, // An infix operator or a parenthesis, given by op
+    numberToken,   // A number, already converted
+    quotedToken,   // A word beginning with a quotation mark
+    variableToken, // A word beginning with a colon
+    nameToken,     // Any other word
+    listToken      // A list or an array
+  };
+
+  enum Operator {
+    noOperator,
+    equalOp,        // =
+    notEqualOp,     // <>
+    lessOp,         // <
+    greaterOp,      // >
+    lessEqualOp,    // <=
+    greaterEqualOp, // >=
+    plusOp,         // +
+    minusOp,        // -
+    timesOp,        // *
+    divideOp,       // /
+    remainderOp,    // %
+    unaryMinusOp,   // --
+    openParenOp,    // (
+    closeParenOp,   // )
+    countOfOperators
+  };
+
+  Kind kind;
+  Operator op;
+  DatumP datum;
+};
+
 struct Cmd_t {
   KernelMethod method;
   int countOfMinParams;
@@ -42,24 +82,52 @@ struct Cmd_t {
   int countOfMaxParams;
 };
 
+/// Returns the primitive named name, or NULL if there is none.
+const Cmd_t *primitiveForName(const QString &name);
+
+/// The current definition of a procedure name. Every call of the name points
+/// at the same cell, so redefining the procedure reaches all of its calls
+/// without parsing them again.
+struct ProcedureCell {
+  DatumP body;
+};
+
 typedef DatumP (Parser::*ParserMethod)(void);
 
 class Parser : public Workspace {
-  qint64 lastProcedureCreatedTimestamp;
-  DatumP tokenizeListWithPrompt(const QString &prompt, int level, bool isArray,
+  // AST cache invalidation. Every change to the meaning of a procedure name
+  // bumps procedureGeneration and records the new value for that name. A
+  // cached AST is valid as long as every name it resolved still has the
+  // generation it had when the AST was built.
+  quint64 procedureGeneration;
+  QHash<Symbol, quint64> procedureGenerations;
+  QHash<Symbol, quint64> *astDependencies = NULL;
+  void procedureNameChanged(Symbol procname);
+  quint64 generationOfName(Symbol procname);
+
+  // The number of times any List's AST has been built.
+  quint64 astBuildCount = 0;
+
+  DatumP tokenizeListWithPrompt(const QString &prompt,
                                 bool shouldRemoveComments,
                                 QTextStream *readStream);
   bool isReadingList = false;
   DatumP listSourceText;
   DatumP lastReadListSource();
   DatumP currentToken;
+  Token::Kind currentKind;
+  Token::Operator currentOp;
   Kernel *kernel;
 
   // For runparse and it's supporting methods:
-  List *runparseRetval;
+  QVector<Token> runparseTokens;
   QString::iterator runparseCIter;
   QString::iterator runparseCEnd;
   bool isRunparseSourceSpecial;
+  void runparseTokenize(DatumP src);
+  void runparseAppend(Token::Kind kind, DatumP datum,
+                      Token::Operator op = Token::noOperator);
+  void runparseAppendOperator(Token::Operator op);
   void runparseSpecialchars(void);
   void runparseMinus(void);
   DatumP runparseNumber(void); // returns a number if successful
@@ -67,7 +135,7 @@ class Parser : public Workspace {
   void runparseString();
 
   void advanceToken();
-  ListIterator listIter;
+  int tokenIndex;
 
   DatumP parseExp();
   DatumP parseSumexp();
@@ -75,24 +143,36 @@ class Parser : public Workspace {
   DatumP parseminusexp();
   DatumP parseTermexp();
   DatumP parseCommand(bool isVararg);
+  DatumP foldConstants(DatumP nodeP);
   DatumP astnodeFromCommand(DatumP command, int &minParams, int &defaultParams,
                             int &maxParams);
 
-  QHash<QString, DatumP> procedures;
-  QHash<QString, Cmd_t> primitiveAlternateNames;
+  QHash<Symbol, DatumP> procedures;
+  QHash<Symbol, ProcedureCell *> procedureCells;
+  ProcedureCell *cellForName(Symbol procsymbol);
+  void setProcedure(Symbol procsymbol, DatumP body);
+  QHash<Symbol, Cmd_t> primitiveAlternateNames;
+  // The primitive for each Symbol, or NULL. Filled in by the constructor.
+  QVector<const Cmd_t *> primitivesBySymbol;
+  // Returns the primitive, or the alternate name made by COPYDEF, for a name.
+  const Cmd_t *primitiveForSymbol(Symbol procsymbol);
 
 public:
   DatumP readrawlineWithPrompt(const QString &prompt, QTextStream *readStream);
   DatumP readwordWithPrompt(const QString &prompt, QTextStream *readStream);
   Parser(Kernel *aKernel);
+  ~Parser();
   DatumP readlistWithPrompt(const QString &prompt, bool shouldRemoveComments,
                             QTextStream *readStream);
   DatumP runparse(DatumP src);
   QList<DatumP> *astFromList(List *aList);
+  bool isAstCurrent(List *aList);
 
   DatumP createProcedure(DatumP cmd, DatumP text, DatumP sourceText);
+  void refreshProcedureCall(ASTNode *node);
+  void compileProcedure(Procedure *body);
   void defineProcedure(DatumP cmd, DatumP procnameP, DatumP text,
-                       DatumP sourceText);
+                       DatumP sourceText, bool shouldCompile = true);
   void inputProcedure(DatumP nodeP, QTextStream *readStream);
   void copyProcedure(DatumP newnameP, DatumP oldnameP);
   void eraseProcedure(DatumP procnameP);
@@ -113,6 +193,16 @@ public:
 
   DatumP astnodeWithLiterals(DatumP cmd, DatumP params);
 
+  // Tracing or stepping a name changes how it must be parsed.
+  using Workspace::step;
+  using Workspace::trace;
+  using Workspace::unstep;
+  using Workspace::untrace;
+  void step(Symbol aName) override;
+  void unstep(Symbol aName) override;
+  void trace(Symbol aName) override;
+  void untrace(Symbol aName) override;
+
   QString unreadDatum(DatumP aDatum, bool isInList = false);
   QString unreadList(List *aList, bool isInList = false);
   QString unreadWord(Word *aWord, bool isInList = false);
@@ -128,17 +218,23 @@ public:
   QStringList optionalInputs;
   QList<DatumP> optionalDefaults;
   QString restInput;
+
+  // The Symbols of the input names above, used to bind them at each call.
+  QVector<Symbol> requiredInputSymbols;
+  QVector<Symbol> optionalInputSymbols;
+  Symbol restInputSymbol = noSymbol;
   int defaultNumber;
   int countOfMinParams;
   int countOfMaxParams;
-  QHash<const QString, DatumP> tagToLine;
+  // The lines of instructionList, so they can be reached by index.
+  QVector<DatumP> lines;
+  QHash<const QString, int> tagToLine;
   bool isMacro;
   DatumP sourceText;
 
   DatumP instructionList;
-  DatumType isa() { return Datum::procedureType; }
-
   Procedure() {
+    setDatumType(procedureType, sizeof(Procedure));
     instructionList = DatumP(new List);
     countOfMaxParams = -1;
     countOfMinParams = 0;
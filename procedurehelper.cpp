@@ -40,26 +40,30 @@ const int dIndent = 1;
 
 void ProcedureHelper::setParser(Parser *aParser) { parser = aParser; }
 
-ProcedureHelper::ProcedureHelper(Kernel *aParent, DatumP sourceNode) {
+ProcedureHelper::ProcedureHelper(Kernel *aParent, const DatumP &sourceNode) {
   parent = aParent;
   node = sourceNode.astnodeValue();
   parameters.reserve(node->countOfChildren());
-  isTraced = parser->isTraced(node->nodeName.wordValue()->keyValue());
-
-  for (int i = 0; i < node->countOfChildren(); ++i) {
-    if (node->childAtIndex(i).isa() == Datum::procedureType) {
-      parameters.push_back(node->childAtIndex(i));
-    } else {
-      ASTNode *child = node->childAtIndex(i).astnodeValue();
-      KernelMethod method = child->kernel;
-      DatumP param = (parent->*method)(child);
-      if (param == nothing) {
-        Error::didntOutput(child->nodeName, node->nodeName);
-      }
-      if (param.isASTNode()) {
-        Error::notInsideProcedure(param.astnodeValue()->nodeName);
+  isTraced = parser->isTraced(node->nodeName.wordValue()->symbolValue());
+
+  // The bytecode engine may have already evaluated the inputs.
+  if (!parent->takePreparedInputs(node, parameters)) {
+    for (int i = 0; i < node->countOfChildren(); ++i) {
+      const DatumP &childP = node->childAtIndex(i);
+      if (childP.isa() == Datum::procedureType) {
+        parameters.push_back(childP);
+      } else {
+        ASTNode *child = childP.astnodeValue();
+        KernelMethod method = child->kernel;
+        DatumP param = (parent->*method)(childP);
+        if (param == nothing) {
+          Error::didntOutput(child->nodeName, node->nodeName);
+        }
+        if (param.isASTNode()) {
+          Error::notInsideProcedure(param.astnodeValue()->nodeName);
+        }
+        parameters.push_back(std::move(param));
       }
-      parameters.push_back(param);
     }
   }
 
@@ -67,7 +71,7 @@ ProcedureHelper::ProcedureHelper(Kernel *aParent, DatumP sourceNode) {
     QString line = indent() + "( %1 ";
     line = line.arg(node->nodeName.wordValue()->printValue());
     for (int i = 0; i < parameters.size(); ++i) {
-      DatumP param = parameters[i];
+      const DatumP &param = parameters[i];
       if (param.isa() != Datum::procedureType)
         line += parser->unreadDatum(parameters[i]) + " ";
     }
@@ -228,7 +232,7 @@ DatumP ProcedureHelper::ret(Datum *aVal) {
 }
 
 DatumP ProcedureHelper::ret(DatumP aVal) {
-  returnValue = aVal;
+  returnValue = std::move(aVal);
   return returnValue;
 }
 
@@ -50,7 +50,7 @@ public:
   bool isTraced;
   static void setParser(Parser *aParser);
   ProcedureHelper() { exit(1); }
-  ProcedureHelper(Kernel *aParent, DatumP sourceNode);
+  ProcedureHelper(Kernel *aParent, const DatumP &sourceNode);
   ~ProcedureHelper();
 
   int countOfChildren() { return parameters.size(); }
@@ -29,24 +29,22 @@
 
 PropertyLists::PropertyLists() {}
 
-void PropertyLists::addProperty(const QString &plistname,
-                                const QString &propname, DatumP value) {
+void PropertyLists::addProperty(Symbol plistname, Symbol propname,
+                                DatumP value) {
   if (!plists.contains(plistname)) {
-    plists.insert(plistname, QHash<QString, DatumP>());
+    plists.insert(plistname, QHash<Symbol, DatumP>());
   }
 
   plists[plistname][propname] = value;
 }
 
-DatumP PropertyLists::getProperty(const QString &plistname,
-                                  const QString &propname) {
+DatumP PropertyLists::getProperty(Symbol plistname, Symbol propname) {
   if (plists.contains(plistname) && plists[plistname].contains(propname))
     return plists[plistname][propname];
   return DatumP(new List);
 }
 
-void PropertyLists::removeProperty(const QString &plistname,
-                                   const QString &propname) {
+void PropertyLists::removeProperty(Symbol plistname, Symbol propname) {
   if (plists.contains(plistname)) {
     plists[plistname].remove(propname);
     if (plists[plistname].isEmpty())
@@ -54,14 +52,14 @@ void PropertyLists::removeProperty(const QString &plistname,
   }
 }
 
-DatumP PropertyLists::getPropertyList(const QString &plistname) {
+DatumP PropertyLists::getPropertyList(Symbol plistname) {
   List *retval = new List;
   if (plists.contains(plistname)) {
-    QList<QString> keys = plists[plistname].keys();
+    QList<Symbol> keys = plists[plistname].keys();
     QList<DatumP> values = plists[plistname].values();
-    QList<QString>::iterator kIter = keys.begin();
+    QList<Symbol>::iterator kIter = keys.begin();
     for (auto &vIter : values) {
-      retval->append(DatumP(new Word(*kIter)));
+      retval->append(DatumP(new Word(keyForSymbol(*kIter))));
       retval->append(vIter);
       ++kIter;
     }
@@ -69,11 +67,11 @@ DatumP PropertyLists::getPropertyList(const QString &plistname) {
   return DatumP(retval);
 }
 
-void PropertyLists::erasePropertyList(const QString &plistname) {
+void PropertyLists::erasePropertyList(Symbol plistname) {
   plists.remove(plistname);
 }
 
-bool PropertyLists::isPropertyList(const QString &plistname) {
+bool PropertyLists::isPropertyList(Symbol plistname) {
   return plists.contains(plistname);
 }
 
@@ -81,13 +79,13 @@ DatumP PropertyLists::allPLists(showContents_t showWhat) {
   List *retval = new List;
   for (auto &name : plists.keys()) {
     if (shouldInclude(showWhat, name))
-      retval->append(DatumP(new Word(name)));
+      retval->append(DatumP(new Word(keyForSymbol(name))));
   }
   return DatumP(retval);
 }
 
 void PropertyLists::eraseAll() {
-  QStringList listnames = plists.keys();
+  QList<Symbol> listnames = plists.keys();
 
   for (auto &name : listnames) {
     if (!isBuried(name)) {
@@ -31,20 +31,19 @@
 #include <datum.h>
 
 class PropertyLists : public Workspace {
-  QHash<QString, QHash<QString, DatumP>> plists;
+  QHash<Symbol, QHash<Symbol, DatumP>> plists;
 
 public:
   PropertyLists();
 
-  void addProperty(const QString &plistname, const QString &propname,
-                   DatumP value);
-  DatumP getProperty(const QString &plistname, const QString &propname);
-  void removeProperty(const QString &plistname, const QString &propname);
-  DatumP getPropertyList(const QString &plistname);
-  void erasePropertyList(const QString &plistname);
+  void addProperty(Symbol plistname, Symbol propname, DatumP value);
+  DatumP getProperty(Symbol plistname, Symbol propname);
+  void removeProperty(Symbol plistname, Symbol propname);
+  DatumP getPropertyList(Symbol plistname);
+  void erasePropertyList(Symbol plistname);
   void eraseAll();
 
-  bool isPropertyList(const QString &plistname);
+  bool isPropertyList(Symbol plistname);
 
   DatumP allPLists(showContents_t showWhat);
 };
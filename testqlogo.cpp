@@ -19,13 +19,21 @@
 #include CONTROLLER_HEADER
 #include "kernel.h"
 #include "turtle.h"
+#include "workspaceimage.h"
 #include <QDateTime>
+#include <QFile>
+#include <QFileInfo>
+#include <QTemporaryDir>
 #include <QtTest>
 
 class TestQLogo : public QObject {
   Q_OBJECT
   qint64 startTime;
 
+  // Holds the images made by LOAD, so that the tests don't write to the
+  // user's cache.
+  QTemporaryDir cacheDir;
+
 public:
   TestQLogo();
   ~TestQLogo();
@@ -33,9 +41,33 @@ public:
 private Q_SLOTS:
   void testKernel_data();
   void testKernel();
+  void testKernelBytecode_data();
+  void testKernelBytecode();
+  void benchmarkRunList_data();
+  void benchmarkRunList();
+  void testLoadImage();
+  void testLibraryImage();
+  void benchmarkLoad_data();
+  void benchmarkLoad();
 };
 
-TestQLogo::TestQLogo() { startTime = QDateTime::currentMSecsSinceEpoch(); }
+TestQLogo::TestQLogo() {
+  startTime = QDateTime::currentMSecsSinceEpoch();
+  WorkspaceImage::setCacheDirectory(cacheDir.path());
+}
+
+static void writeFile(const QString &path, const QByteArray &contents) {
+  QFile file(path);
+  QVERIFY(file.open(QIODevice::WriteOnly | QIODevice::Truncate));
+  file.write(contents);
+}
+
+static QByteArray readFile(const QString &path) {
+  QFile file(path);
+  if (!file.open(QIODevice::ReadOnly))
+    return QByteArray();
+  return file.readAll();
+}
 
 TestQLogo::~TestQLogo() {
   qint64 endTime = QDateTime::currentMSecsSinceEpoch();
@@ -55,6 +87,196 @@ void TestQLogo::testKernel() {
   QCOMPARE(output, expectedOuput);
 }
 
+// Run the same tests with the bytecode engine enabled.
+void TestQLogo::testKernelBytecode() {
+  Controller c;
+  c.kernel->setBytecodeEnabled(true);
+  QFETCH(QString, input);
+  QFETCH(QString, expectedOuput);
+  QString output = c.run(input);
+  QCOMPARE(output, expectedOuput);
+}
+
+void TestQLogo::testKernelBytecode_data() { testKernel_data(); }
+
+// Time runList on a few loops that are dominated by primitive calls, and
+// report the number of retains each one makes. Each input is run by both
+// engines.
+void TestQLogo::benchmarkRunList() {
+  Controller c;
+  QFETCH(QString, input);
+  QFETCH(bool, isBytecodeEnabled);
+  c.kernel->setBytecodeEnabled(isBytecodeEnabled);
+  quint64 startCount = Datum::countOfRetains;
+  c.run(input);
+  qDebug() << "retains:" << (Datum::countOfRetains - startCount);
+  QBENCHMARK { c.run(input); }
+}
+
+void TestQLogo::benchmarkRunList_data() {
+  QTest::addColumn<QString>("input");
+  QTest::addColumn<bool>("isBytecodeEnabled");
+
+  static const struct {
+    const char *name;
+    const char *input;
+  } inputs[] = {
+      {"arithmetic", "make \"a 0\n"
+                     "repeat 10000 [make \"a :a + 1]\n"},
+      {"list building", "make \"a []\n"
+                        "repeat 10000 [make \"a fput repcount :a]\n"},
+      {"procedure calls", "to fib :n\n"
+                          "if :n < 2 [output :n]\n"
+                          "output (fib :n - 1) + (fib :n - 2)\n"
+                          "end\n"
+                          "ignore fib 15\n"},
+      {"nested control",
+       "make \"a 0\n"
+       "repeat 100 [repeat 100 [ifelse 0 = remainder repcount 3 "
+       "[make \"a :a + 1] [if :a > 0 [make \"a :a - 1]]]]\n"},
+  };
+
+  for (auto &input : inputs) {
+    QString name(input.name);
+    QTest::newRow(qPrintable(name + " (AST)")) << QString(input.input) << false;
+    QTest::newRow(qPrintable(name + " (bytecode)"))
+        << QString(input.input) << true;
+  }
+}
+
+// LOAD makes an image of a file the first time, runs the image while the
+// file is unchanged, and reads the file again if it changed, if the image is
+// damaged, or if the file can't be replayed. Running the image behaves the
+// same as reading the file.
+void TestQLogo::testLoadImage() {
+  QTemporaryDir sourceDir;
+  QString sourcePath = sourceDir.filePath("image.lg");
+  QString absolutePath = QFileInfo(sourcePath).absoluteFilePath();
+  QString imagePath = WorkspaceImage::cachePathForFile(absolutePath);
+  QString load =
+      QString("setprefix \"|%1|\nload \"image.lg\n").arg(sourceDir.path());
+  Controller c;
+
+  // A miss runs the file and saves its image.
+  QByteArray text = "to f\n"
+                    "output \"fromproc\n"
+                    "end\n"
+                    "make \"x \"fromfile\n";
+  writeFile(sourcePath, text);
+  QVERIFY(!QFile::exists(imagePath));
+  QCOMPARE(c.run(load + "print :x\nprint f\n"),
+           QString("fromfile\nfromproc\n"));
+  QVERIFY(QFile::exists(imagePath));
+
+  // A hit runs the image. Change the image to show that it, and not the
+  // file, was run.
+  QByteArray key = WorkspaceImage::keyForText(absolutePath, text);
+  WorkspaceImage image;
+  QVERIFY(image.readFromFile(imagePath, key));
+  QCOMPARE(image.entries.size(), 2);
+  List *line = new List;
+  line->append(DatumP(new Word("make")));
+  line->append(DatumP(new Word("\"x")));
+  line->append(DatumP(new Word("\"fromimage")));
+  image.entries.last().line = DatumP(line);
+  QVERIFY(image.writeToFile(imagePath, key));
+  QCOMPARE(c.run("erall\n" + load + "print :x\nprint f\n"),
+           QString("fromimage\nfromproc\n"));
+
+  // A changed file is read again, and its image replaced.
+  text = "make \"x \"changed\n";
+  writeFile(sourcePath, text);
+  QCOMPARE(c.run(load + "print :x\n"), QString("changed\n"));
+  key = WorkspaceImage::keyForText(absolutePath, text);
+  QVERIFY(image.readFromFile(imagePath, key));
+
+  // A damaged image is ignored and replaced.
+  QByteArray imageData = readFile(imagePath);
+  writeFile(imagePath, imageData.left(imageData.size() / 2));
+  QCOMPARE(c.run("make \"x 0\n" + load + "print :x\n"), QString("changed\n"));
+  QVERIFY(image.readFromFile(imagePath, key));
+  writeFile(imagePath, "not an image");
+  QCOMPARE(c.run("make \"x 0\n" + load + "print :x\n"), QString("changed\n"));
+  QVERIFY(image.readFromFile(imagePath, key));
+
+  // A procedure with a line that can't be parsed reports the same error
+  // whether the file was read or its image was run.
+  QFile::remove(imagePath);
+  writeFile(sourcePath, "to g\n"
+                        "print (sqrt 2\n"
+                        "end\n");
+  QString cold = c.run("erall\n" + load + "g\n");
+  QVERIFY(cold.contains("')' not found"));
+  QVERIFY(QFile::exists(imagePath));
+  QCOMPARE(c.run("erall\n" + load + "g\n"), cold);
+
+  // A file that reads from itself can't be replayed, so it has no image.
+  QFile::remove(imagePath);
+  writeFile(sourcePath, "make \"x readlist\n"
+                        "print \"skipped\n");
+  QCOMPARE(c.run(load + "show :x\n"), QString("[print \"skipped]\n"));
+  QVERIFY(!QFile::exists(imagePath));
+}
+
+// The library is read the first time and run from its image after that.
+// Both ways define the same procedures.
+void TestQLogo::testLibraryImage() {
+  QString imagePath = WorkspaceImage::cachePath("library.qli");
+  QString check = "show buried\n"
+                  "show map \"text first buried\n";
+  QString cold;
+  QFile::remove(imagePath);
+  {
+    Controller c;
+    c.kernel->initLibrary();
+    cold = c.run(check);
+  }
+  QVERIFY(cold.contains("foreach"));
+  QVERIFY(QFile::exists(imagePath));
+
+  Controller c;
+  c.kernel->initLibrary();
+  QCOMPARE(c.run(check), cold);
+}
+
+void TestQLogo::benchmarkLoad_data() {
+  QTest::addColumn<bool>("isCached");
+  QTest::newRow("cold") << false;
+  QTest::newRow("cached") << true;
+}
+
+// Time LOAD of a file of 200 procedures, reading the file each time (cold)
+// or running its image.
+void TestQLogo::benchmarkLoad() {
+  QFETCH(bool, isCached);
+  QTemporaryDir sourceDir;
+  QString sourcePath = sourceDir.filePath("bench.lg");
+  QString imagePath = WorkspaceImage::cachePathForFile(
+      QFileInfo(sourcePath).absoluteFilePath());
+  QByteArray text;
+  for (int i = 0; i < 200; ++i) {
+    text += QString("to proc%1 :a :b\n"
+                    "if :a > :b [output :a - :b]\n"
+                    "make \"c (list :a :b [x y z] %1)\n"
+                    "output sum :a product :b %1\n"
+                    "end\n")
+                .arg(i)
+                .toUtf8();
+  }
+  text += "make \"loaded \"true\n";
+  writeFile(sourcePath, text);
+
+  Controller c;
+  QString load =
+      QString("setprefix \"|%1|\nload \"bench.lg\n").arg(sourceDir.path());
+  QCOMPARE(c.run(load + "print :loaded\n"), QString("true\n"));
+  QBENCHMARK {
+    if (!isCached)
+      QFile::remove(imagePath);
+    c.run(load);
+  }
+}
+
 void TestQLogo::testKernel_data() {
   QTest::addColumn<QString>("input");
   QTest::addColumn<QString>("expectedOuput");
@@ -104,6 +326,16 @@ void TestQLogo::testKernel_data() {
                                      "line two]"
                                   << "[this is a list [test line two]]\n";
 
+  QTest::newRow("READLIST nested") << "show readlist\n"
+                                      "a [b {c d}@0 [[e]]] |f g|h ~\n"
+                                      "i\n"
+                                   << "[a [b {c d} [[e]]] f gh i]\n";
+
+  QTest::newRow("PARSE deep") << "make \"s \"x\n"
+                                 "repeat 2000 [make \"s (word char 91 :s char 93)]\n"
+                                 "show count parse (word :s char 32 \"y)\n"
+                              << "2\n";
+
   QTest::newRow("READLIST expression") << "show readlist\n"
                                           "this is 1*2+3\n"
                                        << "[this is 1*2+3]\n";
@@ -260,6 +492,19 @@ void TestQLogo::testKernel_data() {
                            "show :a\n"
                         << "[hello there]\n";
 
+  QTest::newRow("LIST new each time") << "to f\n"
+                                         "output list 1 2\n"
+                                         "end\n"
+                                         "make \"a f\n"
+                                         ".setfirst :a 9\n"
+                                         "show :a\n"
+                                         "show f\n"
+                                         "show .eq f f\n"
+                                      << "f defined\n"
+                                         "[9 2]\n"
+                                         "[1 2]\n"
+                                         "false\n";
+
   QTest::newRow("SENTENCE") << "make \"a se [hello there [you]] \"guys\n"
                                "show :a\n"
                             << "[hello there [you] guys]\n";
@@ -427,6 +672,143 @@ void TestQLogo::testKernel_data() {
                                     "show :a\n"
                                  << "[hello bye you]\n";
 
+  QTest::newRow("dotSETBF shared list") << "make \"a [1 2 3 4 5]\n"
+                                           "make \"b bf bf :a\n"
+                                           ".setbf bf :a [x y]\n"
+                                           "show :a\n"
+                                           "show :b\n"
+                                        << "[1 2 x y]\n"
+                                           "[3 4 5]\n";
+
+  QTest::newRow("dotSETBF longer shared tail") << "make \"a [1 2 3 4 5]\n"
+                                                  ".setbf bf :a [x y z w v u]\n"
+                                                  "show :a\n"
+                                                  "show count :a\n"
+                                                  "show last :a\n"
+                                               << "[1 2 x y z w v u]\n"
+                                                  "8\n"
+                                                  "u\n";
+
+  QTest::newRow("dotSETBF tconc") << "make \"q [a]\n"
+                                     "make \"e :q\n"
+                                     ".setbf :e [b]\n"
+                                     "make \"e bf :e\n"
+                                     ".setbf :e [c]\n"
+                                     "show :q\n"
+                                     "show count :q\n"
+                                  << "[a b c]\n"
+                                     "3\n";
+
+  QTest::newRow("long list") << "make \"a []\n"
+                                "repeat 20 [make \"a fput repcount :a]\n"
+                                "show :a\n"
+                                "show item 12 :a\n"
+                                "show last :a\n"
+                                "show count bf bf :a\n"
+                                "show butlast bf :a\n"
+                             << "[20 19 18 17 16 15 14 13 12 11 10 9 8 7 6 5 4 3 2 1]\n"
+                                "9\n"
+                                "1\n"
+                                "18\n"
+                                "[19 18 17 16 15 14 13 12 11 10 9 8 7 6 5 4 3 2]\n";
+
+  QTest::newRow("shared lput") << "make \"a []\n"
+                                  "repeat 10 [make \"a lput repcount :a]\n"
+                                  "make \"b lput \"x :a\n"
+                                  "make \"c lput \"y :a\n"
+                                  "make \"d butlast :c\n"
+                                  "show :a\n"
+                                  "show :b\n"
+                                  "show :c\n"
+                                  "show lput \"z :d\n"
+                                  "show (sentence 0 :a [] :b)\n"
+                                  "show :b\n"
+                               << "[1 2 3 4 5 6 7 8 9 10]\n"
+                                  "[1 2 3 4 5 6 7 8 9 10 x]\n"
+                                  "[1 2 3 4 5 6 7 8 9 10 y]\n"
+                                  "[1 2 3 4 5 6 7 8 9 10 z]\n"
+                                  "[0 1 2 3 4 5 6 7 8 9 10 1 2 3 4 5 6 7 8 9 10 x]\n"
+                                  "[1 2 3 4 5 6 7 8 9 10 x]\n";
+
+  QTest::newRow("FPUT after BUTFIRST") << "make \"a [1 2 3]\n"
+                                          "make \"n item 2 item 6 nodes\n"
+                                          "make \"b fput \"x bf :a\n"
+                                          "show (item 2 item 6 nodes) - :n\n"
+                                          "make \"c fput \"y :b\n"
+                                          ".setfirst :b \"z\n"
+                                          "show :a\n"
+                                          "show :b\n"
+                                          "show :c\n"
+                                       << "1\n"
+                                          "[1 2 3]\n"
+                                          "[z 2 3]\n"
+                                          "[y z 2 3]\n";
+
+  QTest::newRow("LPUT copies") << "make \"a [1 2 3]\n"
+                                  "make \"b lput 4 :a\n"
+                                  ".setbf :a [9]\n"
+                                  "show :a\n"
+                                  "show :b\n"
+                                  "show item 3 :b\n"
+                                  ".setfirst :b \"x\n"
+                                  ".setitem 2 :b \"y\n"
+                                  "show :a\n"
+                                  "show :b\n"
+                               << "[1 9]\n"
+                                  "[1 2 3 4]\n"
+                                  "3\n"
+                                  "[1 9]\n"
+                                  "[x y 3 4]\n";
+
+  QTest::newRow("BUTLAST copies") << "make \"a [1 2 3]\n"
+                                     "make \"b butlast :a\n"
+                                     ".setfirst :a \"x\n"
+                                     ".setitem 2 :b \"y\n"
+                                     "show :a\n"
+                                     "show :b\n"
+                                     ".setbf :b [z]\n"
+                                     ".setbf bf :a [w]\n"
+                                     "show :a\n"
+                                     "show :b\n"
+                                  << "[x 2 3]\n"
+                                     "[1 y]\n"
+                                     "[x 2 w]\n"
+                                     "[1 z]\n";
+
+  QTest::newRow("SENTENCE copies") << "make \"a [1 2]\n"
+                                      "make \"b se 0 :a\n"
+                                      ".setfirst :a \"x\n"
+                                      ".setitem 3 :b \"y\n"
+                                      "show :a\n"
+                                      "show :b\n"
+                                      ".setbf :a [9]\n"
+                                      ".setbf :b [z]\n"
+                                      "show :a\n"
+                                      "show :b\n"
+                                   << "[x 2]\n"
+                                      "[0 1 y]\n"
+                                      "[x 9]\n"
+                                      "[0 z]\n";
+
+  QTest::newRow("item cursor") << "make \"a []\n"
+                                  "repeat 30 [make \"a lput repcount :a]\n"
+                                  "make \"s 0\n"
+                                  "repeat 30 [make \"s :s + item repcount :a]\n"
+                                  "show :s\n"
+                                  "show item 20 :a\n"
+                                  "setitem 21 :a \"x\n"
+                                  "show item 21 :a\n"
+                                  ".setbf bf bf :a [y z]\n"
+                                  "show item 5 :a\n"
+                                  "show item 4 :a\n"
+                                  "show :a\n"
+                               << "465\n"
+                                  "20\n"
+                                  "x\n"
+                                  "z\n"
+                                  "y\n"
+                                  "[1 2 3 y z]\n";
+
   QTest::newRow("dotSETBF array") << "make \"a {hello there}"
                                      ".setbf :a {bye you}\n"
                                      "show :a\n"
@@ -500,6 +882,24 @@ void TestQLogo::testKernel_data() {
   QTest::newRow("EQUAL? 9") << "show equalp [{hello}] [{hellO}]\n"
                             << "false\n";
 
+  QTest::newRow("EQUAL? 10") << "make \"a [x y]\n"
+                                ".setfirst bf :a :a\n"
+                                "make \"b [x y]\n"
+                                ".setfirst bf :b :b\n"
+                                "show :a\n"
+                                "show equalp :a :b\n"
+                                "show equalp :a [x [x y]]\n"
+                                "show equalp :a :b\n"
+                                "make \"c []\n"
+                                "make \"d []\n"
+                                "repeat 300 [make \"c list :c \"x make \"d list :d \"x]\n"
+                                "show equalp :c :d\n"
+                             << "[x ...]\n"
+                                "true\n"
+                                "false\n"
+                                "true\n"
+                                "true\n";
+
   QTest::newRow("NOTEQUAL? 1") << "show notequal? [{hello}] [{hello}]\n"
                                << "false\n";
 
@@ -542,6 +942,12 @@ void TestQLogo::testKernel_data() {
                               "show .eq :a :b\n"
                            << "true\n";
 
+  QTest::newRow("dotEQ 3") << "show .eq sum 1 1 sum 1 1\n"
+                              "make \"a 2\n"
+                              "show .eq :a sum 1 1\n"
+                           << "false\n"
+                              "false\n";
+
   QTest::newRow("MEMBERP 1") << "show memberp \"this [this is a test]\n"
                              << "true\n";
 
@@ -920,6 +1326,18 @@ void TestQLogo::testKernel_data() {
                             << "qw defined\n"
                                "Hello, 10 4\n";
 
+  QTest::newRow("DEFINE 8") << "define \"fw [[] [print later 3]]\n"
+                               "define \"later [[n] [output :n*2]]\n"
+                               "fw\n"
+                            << "6\n";
+
+  QTest::newRow("DEFINE 9") << "define \"inc [[n] [output :n+1]]\n"
+                               "define \"twice [[] [print inc 1]]\n"
+                               "twice\n"
+                               "define \"inc [[n] [output :n*10]]\n"
+                               "twice\n"
+                            << "2\n10\n";
+
   QTest::newRow("DEFINE notList error")
       << "define \"proc1 [[] [print \"hello] \"show\\ 5+5]\n"
       << "define doesn't like [[] [print \"hello] \"show 5+5] as input\n";
@@ -976,6 +1394,12 @@ void TestQLogo::testKernel_data() {
   QTest::newRow("unary minus with var in list") << "show runparse \"1\\ -:a\n"
                                                 << "[1 0 -- :a]\n";
 
+  QTest::newRow("mixed operators") << "make \"a 3\n"
+                                      "print ( -:a <= 2-5 ) <> ( 1 >= 2 )\n"
+                                      "print 10 % 4 * -:a\n"
+                                   << "true\n"
+                                      "-6\n";
+
   QTest::newRow("number format 1") << "show 2e2\n"
                                    << "200\n";
 
@@ -1010,6 +1434,20 @@ void TestQLogo::testKernel_data() {
                                        "show -:a\n"
                                     << "-10\n";
 
+  QTest::newRow("number format 13") << "show 1234567 + 0\n"
+                                       "show 0.1 + 0.2\n"
+                                       "show sum 1e15 1\n"
+                                       "show word 2.5 1\n"
+                                       "show 1e2 + .5\n"
+                                       "make \"a \"x12\n"
+                                       "show (list numberp :a numberp :a equalp :a 12)\n"
+                                    << "1234567\n"
+                                       "0.30000000000000004\n"
+                                       "1000000000000001\n"
+                                       "2.51\n"
+                                       "100.5\n"
+                                       "[false false false]\n";
+
   QTest::newRow("define operator +") << "to +\n"
                                      << "+ is already defined\n";
 
@@ -1202,6 +1640,9 @@ void TestQLogo::testKernel_data() {
   QTest::newRow("sum 4") << "show (sum 7 8 9)\n"
                          << "24\n";
 
+  QTest::newRow("sum 5") << "show (list sum 1 2 sum 2 1 sum 1000 1000 sum 0.5 1)\n"
+                         << "[3 3 2000 1.5]\n";
+
   QTest::newRow("product 1") << "show (product)\n"
                              << "1\n";
 
@@ -1793,6 +2234,94 @@ void TestQLogo::testKernel_data() {
                               "local doesn't like {a} as input in qw\n"
                               "[local {a}]\n";
 
+  QTest::newRow("LOCAL 5") << "to qw :p1\n"
+                              "local \"a\n"
+                              "make \"a :p1\n"
+                              "if :p1 > 0 [ignore qw :p1 - 1]\n"
+                              "output :a\n"
+                              "end\n"
+                              "show qw 50\n"
+                           << "qw defined\n"
+                              "50\n";
+
+  QTest::newRow("LOCAL 6") << "to qw\n"
+                              "local \"a\n"
+                              "make \"a 5\n"
+                              "erase [[] [a]]\n"
+                              "show :a\n"
+                              "end\n"
+                              "make \"a 1\n"
+                              "qw\n"
+                              "show :a\n"
+                           << "qw defined\n"
+                              "1\n"
+                              "1\n";
+
+  QTest::newRow("GLOBAL 1") << "to qw\n"
+                               "local \"a\n"
+                               "make \"a 5\n"
+                               "global \"a\n"
+                               "make \"a 6\n"
+                               "show :a\n"
+                               "end\n"
+                               "make \"a 1\n"
+                               "qw\n"
+                               "show :a\n"
+                            << "qw defined\n"
+                               "6\n"
+                               "a has no value\n";
+
+  QTest::newRow("NODES 1") << "show count nodes\n"
+                              "show first item 3 nodes\n"
+                           << "8\n"
+                              "word\n";
+
+  QTest::newRow("NODES 2") << "make \"a []\n"
+                              "repeat 100000 [make \"a fput 1 :a]\n"
+                              "make \"a []\n"
+                              "gc\n"
+                              "show count :a\n"
+                           << "0\n";
+
+  QTest::newRow("NODES 3") << "make \"a []\n"
+                              "make \"n first nodes\n"
+                              "repeat 20000 [make \"a fput repcount :a]\n"
+                              "make \"a []\n"
+                              "show (first nodes) - :n < 1000\n"
+                           << "true\n";
+
+  QTest::newRow("NODESTATS 1") << "make \"s nodestats\n"
+                                  "show count :s\n"
+                                  "show item 1 :s\n"
+                                  "show item 1 item 2 :s\n"
+                                  "make \"s nodestats\n"
+                                  "repeat 10 [make \"a array 2]\n"
+                                  "make \"s nodestats\n"
+                                  "show item 12 item 8 :s\n"
+                                  "show first nodesjson\n"
+                               << "14\n"
+                                  "word\n"
+                                  "live\n"
+                                  "10\n"
+                                  "{\n";
+
+  QTest::newRow("RECYCLE 1") << "repeat 100 [make \"a list \"x \"y "
+                                ".setfirst :a word \"x repcount "
+                                ".setfirst bf :a :a]\n"
+                                "make \"b array 2\n"
+                                ".setitem 1 :b :b\n"
+                                ".setitem 2 :b word \"x \"y\n"
+                                "make \"c :b\n"
+                                "make \"a 0\n"
+                                "make \"b 0\n"
+                                "show recycle\n"
+                                "make \"c 0\n"
+                                "show recycle\n"
+                                "show recycle\n"
+                             << "300\n"
+                                "2\n"
+                                "0\n";
+
   QTest::newRow("PLIST 1") << "pprop 1 2 3\n"
                               "show gprop 1 2\n"
                            << "3\n";
@@ -1832,6 +2361,10 @@ void TestQLogo::testKernel_data() {
                               "show plist 2\n"
                            << "[]\n";
 
+  QTest::newRow("PLIST 9") << "pprop \"Abc \"Def 3\n"
+                              "show gprop \"aBC \"dEF\n"
+                           << "3\n";
+
   QTest::newRow("PROCEDUREP 1") << "show procedurep \"show\n"
                                 << "true\n";
 
@@ -1934,6 +2467,17 @@ void TestQLogo::testKernel_data() {
                                 "true\n"
                                 "false\n";
 
+  QTest::newRow(("NAMEP 6")) << "make \"n word \"zz 1\n"
+                                "show namep :n\n"
+                                "show procedurep :n\n"
+                                "make :n 5\n"
+                                "show namep :n\n"
+                                "show thing :n\n"
+                             << "false\n"
+                                "false\n"
+                                "true\n"
+                                "5\n";
+
   QTest::newRow("PLISTP 1") << "pprop 1 2 3\n"
                                "show plistp 1\n"
                             << "true\n";
@@ -2414,6 +2958,18 @@ void TestQLogo::testKernel_data() {
                               " l3 stops\n"
                               "l4 stops\n";
 
+  QTest::newRow("TRACE 8") << "to sq\n"
+                              "output 2*3\n"
+                              "end\n"
+                              "print sq\n"
+                              "trace [[*]]\n"
+                              "print sq\n"
+                           << "sq defined\n"
+                              "6\n"
+                              "( * 2 3 )\n"
+                              "* outputs 6\n"
+                              "6\n";
+
   QTest::newRow("TRACEDP 1") << "trace \"tracedproc\n"
                                 "show tracedp [tracedproc]\n"
                              << "true\n";
@@ -2510,6 +3066,37 @@ void TestQLogo::testKernel_data() {
       << "repeat 3 [repeat 3[show repcount]] show repcount\n"
       << "1\n2\n3\n1\n2\n3\n1\n2\n3\n-1\n";
 
+  QTest::newRow("REPCOUNT after STOP")
+      << "to f\n"
+         "repeat 3 [if repcount = 2 [stop] print repcount]\n"
+         "end\n"
+         "f\n"
+         "show repcount\n"
+      << "f defined\n"
+         "1\n"
+         "-1\n";
+
+  QTest::newRow("OUTPUT from IFELSE in REPEAT")
+      << "to g :n\n"
+         "repeat 5 [ifelse repcount = :n [output repcount * 10] [type "
+         "repcount]]\n"
+         "end\n"
+         "print g 3\n"
+      << "g defined\n"
+         "1230\n";
+
+  QTest::newRow("IF bad condition") << "if 3 [print 1]\n"
+                                    << "if doesn't like 3 as input\n";
+
+  QTest::newRow("REPEAT bad count") << "repeat -1 [print 1]\n"
+                                    << "repeat doesn't like -1 as input\n";
+
+  QTest::newRow("REPEAT changed runlist") << "make \"a [repeat 2 [print 1]]\n"
+                                             "run :a\n"
+                                             ".setitem 2 item 3 :a 2\n"
+                                             "run :a\n"
+                                          << "1\n1\n2\n2\n";
+
   QTest::newRow("FOREVER")
       << "to f :p1\n"
          "forever [print repcount if repcount=:p1 [output \"end]]\n"
@@ -3179,6 +3766,20 @@ void TestQLogo::testKernel_data() {
          "if doesn't like [output \"true] as input in az\n"
          "[if [output \"true] [output 0]]\n";
 
+  QTest::newRow("redefine procedure used by cached list")
+      << "to foo\n"
+         "print 1\n"
+         "end\n"
+         "make \"a [foo]\n"
+         "run :a\n"
+         "to foo\n"
+         "print 2\n"
+         "end\n"
+         "run :a\n"
+      << "foo defined\n"
+         "1\n"
+         "foo defined\n"
+         "2\n";
 }
 
 QTEST_APPLESS_MAIN(TestQLogo)
@@ -26,107 +26,151 @@
 
 #include "vars.h"
 #include "QDebug"
-#include <QSet>
 
 const QString tf = "*tf*";
 
+static Symbol tfSymbol() {
+  static Symbol retval = symbolForKey(tf);
+  return retval;
+}
+
 Vars::Vars() { upScope(); }
 
-void Vars::setDatumForName(DatumP &aDatum, const QString &name) {
-  for (auto &variables : levels) {
-    if (variables.contains(name)) {
-      variables[name] = aDatum;
-      return;
-    }
+Vars::Binding &Vars::bindingForName(Symbol name) {
+  if (name >= bindings.size()) {
+    Binding unbound = {nothing, -1};
+    int oldSize = bindings.size();
+    bindings.resize(name + 1);
+    for (int i = oldSize; i < bindings.size(); ++i)
+      bindings[i] = unbound;
   }
-  levels.last().insert(name, aDatum);
+  return bindings[name];
 }
 
-DatumP Vars::datumForName(const QString &name) {
-  for (auto &variables : levels) {
-    auto result = variables.find(name);
-    if (result != variables.end()) {
-      return *result;
-    }
-  }
-  return nothing;
+void Vars::setDatumForName(DatumP &aDatum, Symbol name) {
+  Binding &b = bindingForName(name);
+  b.value = aDatum;
+  if (b.level < 0)
+    b.level = 0;
 }
 
-void Vars::setVarAsLocal(const QString &name) {
-  levels.first().insert(name, nothing);
+DatumP Vars::datumForName(Symbol name) {
+  if ((name != noSymbol) && (name < bindings.size()))
+    return bindings[name].value;
+  return nothing;
 }
 
-void Vars::setVarAsGlobal(const QString &name) {
-  levels.last().insert(name, nothing);
+// Bind name in the current level, saving whatever binding it hides.
+void Vars::bindLocal(Symbol name, DatumP aDatum) {
+  int level = currentLevel();
+  Binding &b = bindingForName(name);
+  if (b.level != level) {
+    SavedBinding saved = {name, b, true};
+    savedBindings.push_back(saved);
+    b.level = level;
+  }
+  b.value = aDatum;
 }
 
-void Vars::upScope() {
-  QHash<QString, DatumP> a;
-  levels.push_front(a);
-}
+void Vars::setVarAsLocal(Symbol name) { bindLocal(name, nothing); }
 
-void Vars::downScope() { levels.pop_front(); }
+void Vars::setVarAsGlobal(Symbol name) {
+  Binding &b = bindingForName(name);
+  if (b.level <= 0) {
+    b.value = nothing;
+    b.level = 0;
+    return;
+  }
 
-int Vars::currentScope() { return levels.size(); }
+  // The global binding is hidden. The oldest saved binding for this name is
+  // the one that will be restored when the outermost local goes away.
+  for (auto &saved : savedBindings) {
+    if (saved.isValid && (saved.name == name)) {
+      saved.binding.value = nothing;
+      saved.binding.level = 0;
+      return;
+    }
+  }
+}
+
+void Vars::upScope() { scopeMarks.push_back(savedBindings.size()); }
 
-bool Vars::doesExist(const QString &name) {
-  for (auto &variables : levels) {
-    if (variables.contains(name))
-      return true;
+void Vars::downScope() {
+  int mark = scopeMarks.takeLast();
+  while (savedBindings.size() > mark) {
+    SavedBinding saved = savedBindings.takeLast();
+    if (saved.isValid)
+      bindings[saved.name] = saved.binding;
   }
-  return false;
+}
+
+int Vars::currentScope() { return scopeMarks.size(); }
+
+bool Vars::doesExist(Symbol name) {
+  return (name != noSymbol) && (name < bindings.size()) &&
+         (bindings[name].level >= 0);
 }
 
 DatumP Vars::allVariables(showContents_t showWhat) {
   List *retval = new List;
-  QSet<const QString> seenVars;
-
-  for (auto &levelIter : levels) {
-    for (auto &varname : levelIter.keys()) {
-      if (!seenVars.contains(varname)) {
-        seenVars.insert(varname);
 
-        if (shouldInclude(showWhat, varname))
-          retval->append(DatumP(new Word(varname)));
-      }
-    }
+  for (Symbol name = 0; name < bindings.size(); ++name) {
+    if ((bindings[name].level >= 0) && shouldInclude(showWhat, name))
+      retval->append(DatumP(new Word(keyForSymbol(name))));
   }
 
   return DatumP(retval);
 }
 
 void Vars::eraseAll() {
-  for (auto &levelIter : levels) {
-    for (auto &varname : levelIter.keys()) {
-      if (!isBuried(varname))
-        levelIter.remove(varname);
-    }
+  Binding unbound = {nothing, -1};
+  for (Symbol name = 0; name < bindings.size(); ++name) {
+    if (!isBuried(name))
+      bindings[name] = unbound;
+  }
+  for (auto &saved : savedBindings) {
+    if (saved.isValid && !isBuried(saved.name))
+      saved.isValid = false;
   }
 }
 
-void Vars::eraseVar(const QString &name) {
-  for (auto &variables : levels) {
-    if (variables.remove(name) > 0)
+void Vars::eraseVar(Symbol name) {
+  if (!doesExist(name))
+    return;
+  Binding &b = bindings[name];
+  if (b.level == 0) {
+    b.value = nothing;
+    b.level = -1;
+    return;
+  }
+
+  // Uncover the binding that the local one was hiding.
+  for (int i = savedBindings.size() - 1; i >= 0; --i) {
+    SavedBinding &saved = savedBindings[i];
+    if (saved.isValid && (saved.name == name)) {
+      saved.isValid = false;
+      b = saved.binding;
       return;
+    }
   }
 }
 
 void Vars::setTest(bool isTrue) {
   DatumP t = new Word(isTrue ? 0 : 1);
-  levels.first().insert(tf, t);
+  bindLocal(tfSymbol(), t);
 }
 
-bool Vars::isTested() { return datumForName(tf).isWord(); }
+bool Vars::isTested() { return datumForName(tfSymbol()).isWord(); }
 
 bool Vars::isTrue() {
-  DatumP retval = datumForName(tf);
+  DatumP retval = datumForName(tfSymbol());
   if (retval.isWord() && (retval.wordValue()->numberValue() == 0))
     return true;
   return false;
 }
 
 bool Vars::isFalse() {
-  DatumP retval = datumForName(tf);
+  DatumP retval = datumForName(tfSymbol());
   if (retval.isWord() && (retval.wordValue()->numberValue() == 1))
     return true;
   return false;
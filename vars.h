@@ -28,23 +28,61 @@
 
 #include "datum.h"
 #include "workspace.h"
-#include <QHash>
-#include <QList>
+#include <QVector>
 
+// Variables are shallow bound. Each name's Symbol indexes the binding that is
+// currently visible. When a name is made local, the binding it hides is pushed
+// onto savedBindings, and downScope() restores everything pushed since the
+// matching upScope().
 class Vars : public Workspace {
-  QList<QHash<QString, DatumP>> levels;
+  struct Binding {
+    DatumP value;
+    int level; // 0 is global, -1 is unbound
+  };
+
+  struct SavedBinding {
+    Symbol name;
+    Binding binding;
+    bool isValid; // false if the local binding was erased
+  };
+
+  QVector<Binding> bindings;
+  QVector<SavedBinding> savedBindings;
+
+  // The size of savedBindings at each upScope()
+  QVector<int> scopeMarks;
+
+  int currentLevel() { return scopeMarks.size() - 1; }
+  Binding &bindingForName(Symbol name);
+  void bindLocal(Symbol name, DatumP aDatum);
 
 public:
   Vars();
-  DatumP datumForName(const QString &name);
-  void setDatumForName(DatumP &aDatum, const QString &name);
+  DatumP datumForName(Symbol name);
+  void setDatumForName(DatumP &aDatum, Symbol name);
+
+  void setVarAsLocal(Symbol name);
+  void setVarAsGlobal(Symbol name);
+  bool doesExist(Symbol name);
+  void eraseVar(Symbol name);
+
+  // Convenience versions that take a key value. Only the ones that bind a
+  // name create its Symbol.
+  DatumP datumForName(const QString &name) {
+    return datumForName(findSymbol(name));
+  }
+  void setDatumForName(DatumP &aDatum, const QString &name) {
+    setDatumForName(aDatum, symbolForKey(name));
+  }
+  void setVarAsLocal(const QString &name) { setVarAsLocal(symbolForKey(name)); }
+  void setVarAsGlobal(const QString &name) {
+    setVarAsGlobal(symbolForKey(name));
+  }
+  bool doesExist(const QString &name) { return doesExist(findSymbol(name)); }
+  void eraseVar(const QString &name) { eraseVar(findSymbol(name)); }
 
-  void setVarAsLocal(const QString &name);
-  void setVarAsGlobal(const QString &name);
   void upScope();   // more local
   void downScope(); // more global
-  bool doesExist(const QString &name);
-  void eraseVar(const QString &name);
   void eraseAll();
   int currentScope();
   void setTest(bool isTrue);
@@ -30,31 +30,31 @@
 
 Workspace::Workspace() {}
 
-void Workspace::bury(const QString &aName) { buriedNames.insert(aName); }
+void Workspace::bury(Symbol aName) { buriedNames.insert(aName); }
 
-bool Workspace::isBuried(const QString &aName) {
+bool Workspace::isBuried(Symbol aName) {
   return buriedNames.contains(aName);
 }
 
-void Workspace::unbury(const QString &aName) { buriedNames.remove(aName); }
+void Workspace::unbury(Symbol aName) { buriedNames.remove(aName); }
 
-void Workspace::step(const QString &aName) { steppedNames.insert(aName); }
+void Workspace::step(Symbol aName) { steppedNames.insert(aName); }
 
-bool Workspace::isStepped(const QString &aName) {
+bool Workspace::isStepped(Symbol aName) {
   return steppedNames.contains(aName);
 }
 
-void Workspace::unstep(const QString &aName) { steppedNames.remove(aName); }
+void Workspace::unstep(Symbol aName) { steppedNames.remove(aName); }
 
-void Workspace::trace(const QString &aName) { tracedNames.insert(aName); }
+void Workspace::trace(Symbol aName) { tracedNames.insert(aName); }
 
-bool Workspace::isTraced(const QString &aName) {
+bool Workspace::isTraced(Symbol aName) {
   return tracedNames.contains(aName);
 }
 
-void Workspace::untrace(const QString &aName) { tracedNames.remove(aName); }
+void Workspace::untrace(Symbol aName) { tracedNames.remove(aName); }
 
-bool Workspace::shouldInclude(showContents_t showWhat, const QString &name) {
+bool Workspace::shouldInclude(showContents_t showWhat, Symbol name) {
   switch (showWhat) {
   case showUnburied:
     if (!isBuried(name))
@@ -27,32 +27,50 @@
 ///
 //===----------------------------------------------------------------------===//
 
+#include "datum.h"
 #include <QSet>
 #include <QString>
 
 enum showContents_t { showUnburied, showBuried, showTraced, showStepped };
 
 class Workspace {
-  QSet<QString> buriedNames;
-  QSet<QString> steppedNames;
-  QSet<QString> tracedNames;
+  QSet<Symbol> buriedNames;
+  QSet<Symbol> steppedNames;
+  QSet<Symbol> tracedNames;
 
 public:
   Workspace();
+  virtual ~Workspace() {}
 
-  void bury(const QString &aName);
-  bool isBuried(const QString &aName);
-  void unbury(const QString &aName);
+  void bury(Symbol aName);
+  bool isBuried(Symbol aName);
+  void unbury(Symbol aName);
 
-  void step(const QString &aName);
-  bool isStepped(const QString &aName);
-  void unstep(const QString &aName);
+  // Subclasses may need to know when these change.
+  virtual void step(Symbol aName);
+  bool isStepped(Symbol aName);
+  virtual void unstep(Symbol aName);
 
-  void trace(const QString &aName);
-  bool isTraced(const QString &aName);
-  void untrace(const QString &aName);
+  virtual void trace(Symbol aName);
+  bool isTraced(Symbol aName);
+  virtual void untrace(Symbol aName);
 
-  bool shouldInclude(showContents_t showWhat, const QString &name);
+  bool shouldInclude(showContents_t showWhat, Symbol name);
+
+  // Convenience versions that take a key value. The queries don't create a
+  // Symbol for the name.
+  void bury(const QString &aName) { bury(symbolForKey(aName)); }
+  bool isBuried(const QString &aName) { return isBuried(findSymbol(aName)); }
+  void unbury(const QString &aName) { unbury(findSymbol(aName)); }
+  void step(const QString &aName) { step(symbolForKey(aName)); }
+  bool isStepped(const QString &aName) { return isStepped(findSymbol(aName)); }
+  void unstep(const QString &aName) { unstep(findSymbol(aName)); }
+  void trace(const QString &aName) { trace(symbolForKey(aName)); }
+  bool isTraced(const QString &aName) { return isTraced(findSymbol(aName)); }
+  void untrace(const QString &aName) { untrace(findSymbol(aName)); }
+  bool shouldInclude(showContents_t showWhat, const QString &name) {
+    return shouldInclude(showWhat, findSymbol(name));
+  }
 };
 
 #endif // WORKSPACE_H
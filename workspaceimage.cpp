@@ -0,0 +1,285 @@
+//===-- qlogo/workspaceimage.cpp - WorkspaceImage class implementation -------*- C++ -*-===//
+//
+// This file is part of QLogo.
+//
+// QLogo is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 2 of the License, or
+// (at your option) any later version.
+//
+// QLogo is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with QLogo.  If not, see <http://www.gnu.org/licenses/>.
+//
+//===----------------------------------------------------------------------===//
+///
+/// \file
+/// This file contains the implementation of the WorkspaceImage class, which
+/// holds a Logo source text after it has been read, so that it can be run
+/// again without reading and tokenizing the text.
+///
+/// An image file is a QDataStream holding a header, the key of the text it
+/// was made from, and the entries. Each Datum is written in prefix order: a
+/// tag, then the Word's text, or the size of the List or Array followed by
+/// its items.
+///
+//===----------------------------------------------------------------------===//
+
+#include "workspaceimage.h"
+
+#include <QCryptographicHash>
+#include <QDataStream>
+#include <QDir>
+#include <QFile>
+#include <QFileInfo>
+#include <QSaveFile>
+#include <QStandardPaths>
+
+// "QLGI"
+const quint32 imageMagic = 0x514c4749;
+
+// Change this whenever the layout of an image file changes.
+const quint32 imageFormatVersion = 1;
+
+enum ImageTag : quint8 { nothingTag, wordTag, listTag, arrayTag };
+
+// A List or Array that is still waiting for some of its items.
+struct PendingContainer {
+  DatumP container;
+  int index;
+  int count;
+};
+
+void WorkspaceImage::addLine(DatumP line) {
+  Entry entry;
+  entry.line = line;
+  entries.push_back(entry);
+}
+
+void WorkspaceImage::addDefinition(DatumP cmd, DatumP procname, DatumP text,
+                                   DatumP sourceText) {
+  // The definition belongs to the TO line that was just added.
+  if (entries.isEmpty()) {
+    isReplayable = false;
+    return;
+  }
+  Entry &entry = entries.last();
+  entry.cmd = cmd;
+  entry.procname = procname;
+  entry.text = text;
+  entry.sourceText = sourceText;
+}
+
+QByteArray WorkspaceImage::keyForText(const QString &source,
+                                      const QByteArray &text) {
+  QByteArray data(LOGOVERSION);
+  data.append('\0');
+  data.append(source.toUtf8());
+  data.append('\0');
+  data.append(text);
+  return QCryptographicHash::hash(data, QCryptographicHash::Sha1);
+}
+
+// Set by setCacheDirectory(). Empty means the user's cache directory.
+static QString cacheDirectory;
+
+void WorkspaceImage::setCacheDirectory(const QString &aPath) {
+  cacheDirectory = aPath;
+}
+
+QString WorkspaceImage::cachePath(const QString &name) {
+  QString dirPath = cacheDirectory;
+  if (dirPath.isEmpty())
+    dirPath = QStandardPaths::writableLocation(QStandardPaths::CacheLocation);
+  if (dirPath.isEmpty())
+    return "";
+  return QDir(dirPath).filePath("images/" + name);
+}
+
+QString WorkspaceImage::cachePathForFile(const QString &absolutePath) {
+  QByteArray pathHash =
+      QCryptographicHash::hash(absolutePath.toUtf8(), QCryptographicHash::Sha1);
+  return cachePath(QString::fromLatin1(pathHash.toHex()) + ".qli");
+}
+
+static void writeDatum(QDataStream &out, DatumP root) {
+  // Datums still to be written, the next one last.
+  QVector<DatumP> stack;
+  QVector<DatumP> items;
+  stack.push_back(root);
+  while (!stack.isEmpty()) {
+    DatumP d = stack.takeLast();
+    switch (d.isa()) {
+    case Datum::wordType:
+      out << quint8(wordTag) << d.wordValue()->rawValue()
+          << d.wordValue()->isForeverSpecial;
+      break;
+    case Datum::listType: {
+      items.clear();
+      ListIterator iter = d.listValue()->newIterator();
+      while (iter.elementExists()) {
+        items.push_back(iter.element());
+      }
+      out << quint8(listTag) << qint32(items.size());
+      for (int i = items.size() - 1; i >= 0; --i) {
+        stack.push_back(items[i]);
+      }
+      break;
+    }
+    case Datum::arrayType: {
+      Array *a = d.arrayValue();
+      int size = a->size();
+      out << quint8(arrayTag) << qint32(a->origin) << qint32(size);
+      for (int i = size - 1; i >= 0; --i) {
+        stack.push_back(a->datumAtIndex(a->origin + i));
+      }
+      break;
+    }
+    default:
+      out << quint8(nothingTag);
+      break;
+    }
+  }
+}
+
+static bool readDatum(QDataStream &in, DatumP &retval) {
+  QVector<PendingContainer> stack;
+  forever {
+    quint8 tag;
+    in >> tag;
+    if (in.status() != QDataStream::Ok)
+      return false;
+
+    DatumP d;
+    qint32 count = 0;
+    switch (tag) {
+    case nothingTag:
+      break;
+    case wordTag: {
+      QString rawValue;
+      bool isForeverSpecial;
+      in >> rawValue >> isForeverSpecial;
+      d = DatumP(new Word(rawValue, isForeverSpecial));
+      break;
+    }
+    case listTag:
+      in >> count;
+      d = DatumP(new List);
+      break;
+    case arrayTag: {
+      qint32 origin;
+      in >> origin >> count;
+      if (count < 0)
+        return false;
+      d = DatumP(new Array(origin, count));
+      break;
+    }
+    default:
+      return false;
+    }
+    if ((in.status() != QDataStream::Ok) || (count < 0))
+      return false;
+
+    if (stack.isEmpty()) {
+      retval = d;
+    } else {
+      PendingContainer &parent = stack.last();
+      if (parent.container.isList()) {
+        parent.container.listValue()->append(d);
+      } else {
+        Array *a = parent.container.arrayValue();
+        a->setItem(a->origin + parent.index, d);
+      }
+      ++parent.index;
+    }
+    if (count > 0)
+      stack.push_back({d, 0, count});
+
+    while (!stack.isEmpty() && (stack.last().index == stack.last().count)) {
+      stack.pop_back();
+    }
+    if (stack.isEmpty())
+      return true;
+  }
+}
+
+bool WorkspaceImage::readFromFile(const QString &path, const QByteArray &key) {
+  entries.clear();
+  if (path.isEmpty())
+    return false;
+  QFile file(path);
+  if (!file.open(QIODevice::ReadOnly))
+    return false;
+
+  QDataStream in(&file);
+  in.setVersion(QDataStream::Qt_5_0);
+  quint32 magic, formatVersion;
+  QByteArray fileKey;
+  qint32 count;
+  in >> magic >> formatVersion >> fileKey >> count;
+  if ((in.status() != QDataStream::Ok) || (magic != imageMagic) ||
+      (formatVersion != imageFormatVersion) || (fileKey != key) || (count < 0))
+    return false;
+
+  entries.reserve(count);
+  for (int i = 0; i < count; ++i) {
+    Entry entry;
+    bool isDefinition;
+    in >> isDefinition;
+    if (!readDatum(in, entry.line)) {
+      entries.clear();
+      return false;
+    }
+    if (isDefinition) {
+      if (!readDatum(in, entry.cmd) || !readDatum(in, entry.procname) ||
+          !readDatum(in, entry.text) || !readDatum(in, entry.sourceText) ||
+          !entry.cmd.isWord() || !entry.procname.isWord() ||
+          !entry.text.isList()) {
+        entries.clear();
+        return false;
+      }
+    }
+    entries.push_back(entry);
+  }
+  return true;
+}
+
+bool WorkspaceImage::writeToFile(const QString &path,
+                                 const QByteArray &key) const {
+  if (path.isEmpty() || !isReplayable)
+    return false;
+  // If the cache can't be written, the image just isn't saved.
+  QFileInfo dirInfo(QFileInfo(path).absolutePath());
+  if (!dirInfo.exists() && !QDir().mkpath(dirInfo.absoluteFilePath()))
+    return false;
+  dirInfo.refresh();
+  if (!dirInfo.isDir() || !dirInfo.isWritable())
+    return false;
+  QSaveFile file(path);
+  if (!file.open(QIODevice::WriteOnly))
+    return false;
+
+  QDataStream out(&file);
+  out.setVersion(QDataStream::Qt_5_0);
+  out << imageMagic << imageFormatVersion << key << qint32(entries.size());
+  for (auto &entry : entries) {
+    bool isDefinition = (entry.cmd != nothing);
+    out << isDefinition;
+    writeDatum(out, entry.line);
+    if (isDefinition) {
+      writeDatum(out, entry.cmd);
+      writeDatum(out, entry.procname);
+      writeDatum(out, entry.text);
+      writeDatum(out, entry.sourceText);
+    }
+  }
+  if (out.status() != QDataStream::Ok) {
+    file.cancelWriting();
+    return false;
+  }
+  return file.commit();
+}
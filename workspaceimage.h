@@ -0,0 +1,85 @@
+#ifndef WORKSPACEIMAGE_H
+#define WORKSPACEIMAGE_H
+
+//===-- qlogo/workspaceimage.h - WorkspaceImage class definition -------*- C++ -*-===//
+//
+// This file is part of QLogo.
+//
+// QLogo is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 2 of the License, or
+// (at your option) any later version.
+//
+// QLogo is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with QLogo.  If not, see <http://www.gnu.org/licenses/>.
+//
+//===----------------------------------------------------------------------===//
+///
+/// \file
+/// This file contains the declaration of the WorkspaceImage class, which holds
+/// a Logo source text after it has been read, so that it can be run again
+/// without reading and tokenizing the text.
+///
+//===----------------------------------------------------------------------===//
+
+#include "datum.h"
+
+#include <QByteArray>
+#include <QVector>
+
+class WorkspaceImage {
+public:
+  /// One top-level line of the source text. For a line that begins a
+  /// procedure definition with TO, the definition is recorded as well, and
+  /// replaying the entry defines the procedure instead of running the line.
+  struct Entry {
+    DatumP line;
+    DatumP cmd;
+    DatumP procname;
+    DatumP text;
+    DatumP sourceText;
+  };
+
+  QVector<Entry> entries;
+
+  /// False if running the text did something that replaying the entries
+  /// would not repeat, such as reading from the text with READLIST.
+  bool isReplayable = true;
+
+  void addLine(DatumP line);
+  void addDefinition(DatumP cmd, DatumP procname, DatumP text,
+                     DatumP sourceText);
+
+  /// Returns a key that identifies this version of QLogo reading text from
+  /// source.
+  static QByteArray keyForText(const QString &source, const QByteArray &text);
+
+  /// Returns the path of the cache file for images with the given name. The
+  /// file and its directory might not exist.
+  static QString cachePath(const QString &name);
+
+  /// Returns the path of the cache file for the image of the source file at
+  /// absolutePath.
+  static QString cachePathForFile(const QString &absolutePath);
+
+  /// Keep image files in aPath instead of the user's cache directory. The
+  /// tests use this so that they don't write to the user's cache.
+  static void setCacheDirectory(const QString &aPath);
+
+  /// Read the image from the file at path. Returns false, and leaves the image
+  /// empty, if the file doesn't exist, is damaged, or was written with a
+  /// different key.
+  bool readFromFile(const QString &path, const QByteArray &key);
+
+  /// Write the image to the file at path, making its directory if needed.
+  /// Returns false, without writing anything, if the directory can't be
+  /// written.
+  bool writeToFile(const QString &path, const QByteArray &key) const;
+};
+
+#endif // WORKSPACEIMAGE_H